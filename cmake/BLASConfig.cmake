@@ -8,7 +8,7 @@ include( "cmake/util.cmake" )
 # Check if this file has already been run with these settings (see bottom).
 set( run_ true )
 if (DEFINED blas_config_cache
-    AND "${blas_config_cache}" STREQUAL "${BLAS_LIBRARIES}")
+    AND "${blas_config_cache}" STREQUAL "${BLAS_LIBRARIES};${use_cblas}")
 
     message( DEBUG "BLAS config already done for '${BLAS_LIBRARIES}'" )
     set( run_ false )
@@ -167,46 +167,17 @@ endif()
 # todo: detect Cray libsci
 
 #-------------------------------------------------------------------------------
-message( STATUS "Checking BLAS complex return type" )
-
-try_run(
-    run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
-    SOURCES
-        "${CMAKE_CURRENT_SOURCE_DIR}/config/return_complex.cc"
-    LINK_LIBRARIES
-        ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
-    COMPILE_DEFINITIONS
-        ${blaspp_defs_}
-    COMPILE_OUTPUT_VARIABLE
-        compile_output
-    RUN_OUTPUT_VARIABLE
-        run_output
-)
-# For cross-compiling, user must provide extra info.
-if (CMAKE_CROSSCOMPILING AND compile_result)
-    message( DEBUG "cross: blas_complex_return = '${blas_complex_return}'" )
-    set( run_result "0"  CACHE STRING "" FORCE )
-    if (blas_complex_return STREQUAL "return")
-        set( run_output "ok" CACHE STRING "" FORCE )
-    elseif (blas_complex_return STREQUAL "argument")
-        set( run_output "failed" CACHE STRING "" FORCE )
-    else()
-        message( FATAL_ERROR " ${red}When cross-compiling, one must define either\n"
-                 " `blas_complex_return=return` (GNU gfortran convention) or\n"
-                 " `blas_complex_return=argument` (Intel ifort convention).${plain}" )
-    endif()
-endif()
-debug_try_run( "return_complex.cc" "${compile_result}" "${compile_output}"
-                                   "${run_result}" "${run_output}" )
-
-if (compile_result AND "${run_output}" MATCHES "ok")
-    message( "${blue}   BLAS (zdotc) returns complex (GNU gfortran convention)${plain}" )
-    # nothing to define
+# With use_cblas, complex dot products are returned via an argument
+# (cblas_zdotc_sub), so the Fortran convention doesn't matter.
+if (use_cblas)
+    message( STATUS "Using CBLAS; skipping BLAS complex return type check" )
 else()
+    message( STATUS "Checking BLAS complex return type" )
+
     try_run(
         run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
         SOURCES
-            "${CMAKE_CURRENT_SOURCE_DIR}/config/return_complex_argument.cc"
+            "${CMAKE_CURRENT_SOURCE_DIR}/config/return_complex.cc"
         LINK_LIBRARIES
             ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
         COMPILE_DEFINITIONS
@@ -218,20 +189,55 @@ else()
     )
     # For cross-compiling, user must provide extra info.
     if (CMAKE_CROSSCOMPILING AND compile_result)
-        message( DEBUG "cross: blas_complex_return = '${blas_complex_return}' (2)" )
+        message( DEBUG "cross: blas_complex_return = '${blas_complex_return}'" )
         set( run_result "0"  CACHE STRING "" FORCE )
-        set( run_output "ok" CACHE STRING "" FORCE )
-        assert( blas_complex_return STREQUAL "argument" )  # follows from above
+        if (blas_complex_return STREQUAL "return")
+            set( run_output "ok" CACHE STRING "" FORCE )
+        elseif (blas_complex_return STREQUAL "argument")
+            set( run_output "failed" CACHE STRING "" FORCE )
+        else()
+            message( FATAL_ERROR " ${red}When cross-compiling, one must define either\n"
+                     " `blas_complex_return=return` (GNU gfortran convention) or\n"
+                     " `blas_complex_return=argument` (Intel ifort convention).${plain}" )
+        endif()
     endif()
-    debug_try_run( "return_complex_argument.cc"
-                   "${compile_result}" "${compile_output}"
-                   "${run_result}" "${run_output}" )
+    debug_try_run( "return_complex.cc" "${compile_result}" "${compile_output}"
+                                       "${run_result}" "${run_output}" )
 
     if (compile_result AND "${run_output}" MATCHES "ok")
-        message( "${blue}   BLAS (zdotc) returns complex as hidden argument (Intel ifort convention)${plain}" )
-        list( APPEND blaspp_defs_ "-DBLAS_COMPLEX_RETURN_ARGUMENT" )
+        message( "${blue}   BLAS (zdotc) returns complex (GNU gfortran convention)${plain}" )
+        # nothing to define
     else()
-        message( FATAL_ERROR "Error - Cannot detect zdotc return value. Please check the BLAS installation." )
+        try_run(
+            run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+            SOURCES
+                "${CMAKE_CURRENT_SOURCE_DIR}/config/return_complex_argument.cc"
+            LINK_LIBRARIES
+                ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
+            COMPILE_DEFINITIONS
+                ${blaspp_defs_}
+            COMPILE_OUTPUT_VARIABLE
+                compile_output
+            RUN_OUTPUT_VARIABLE
+                run_output
+        )
+        # For cross-compiling, user must provide extra info.
+        if (CMAKE_CROSSCOMPILING AND compile_result)
+            message( DEBUG "cross: blas_complex_return = '${blas_complex_return}' (2)" )
+            set( run_result "0"  CACHE STRING "" FORCE )
+            set( run_output "ok" CACHE STRING "" FORCE )
+            assert( blas_complex_return STREQUAL "argument" )  # follows from above
+        endif()
+        debug_try_run( "return_complex_argument.cc"
+                       "${compile_result}" "${compile_output}"
+                       "${run_result}" "${run_output}" )
+
+        if (compile_result AND "${run_output}" MATCHES "ok")
+            message( "${blue}   BLAS (zdotc) returns complex as hidden argument (Intel ifort convention)${plain}" )
+            list( APPEND blaspp_defs_ "-DBLAS_COMPLEX_RETURN_ARGUMENT" )
+        else()
+            message( FATAL_ERROR "Error - Cannot detect zdotc return value. Please check the BLAS installation." )
+        endif()
     endif()
 endif()
 
@@ -299,11 +305,73 @@ else()
     endif()
 endif()
 
+#-------------------------------------------------------------------------------
+message( STATUS "Checking BLAS for gemmt" )
+
+try_run(
+    run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+    SOURCES
+        "${CMAKE_CURRENT_SOURCE_DIR}/config/blas_gemmt.cc"
+    LINK_LIBRARIES
+        ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
+    COMPILE_DEFINITIONS
+        ${blaspp_defs_}
+    COMPILE_OUTPUT_VARIABLE
+        compile_output
+    RUN_OUTPUT_VARIABLE
+        run_output
+)
+# For cross-compiling, trust that it links.
+if (CMAKE_CROSSCOMPILING AND compile_result)
+    set( run_result "0"  CACHE STRING "" FORCE )
+    set( run_output "ok" CACHE STRING "" FORCE )
+endif()
+debug_try_run( "blas_gemmt.cc" "${compile_result}" "${compile_output}"
+                               "${run_result}" "${run_output}" )
+
+if (compile_result AND "${run_output}" MATCHES "ok")
+    message( "${blue}   BLAS provides gemmt${plain}" )
+    list( APPEND blaspp_defs_ "-DBLAS_HAVE_GEMMT" )
+else()
+    message( "   BLAS does not provide gemmt; using BLAS++ implementation" )
+endif()
+
+#-------------------------------------------------------------------------------
+message( STATUS "Checking BLAS for gemm3m" )
+
+try_run(
+    run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+    SOURCES
+        "${CMAKE_CURRENT_SOURCE_DIR}/config/blas_gemm3m.cc"
+    LINK_LIBRARIES
+        ${BLAS_LIBRARIES} ${openmp_lib} # not "..." quoted; screws up OpenMP
+    COMPILE_DEFINITIONS
+        ${blaspp_defs_}
+    COMPILE_OUTPUT_VARIABLE
+        compile_output
+    RUN_OUTPUT_VARIABLE
+        run_output
+)
+# For cross-compiling, trust that it links.
+if (CMAKE_CROSSCOMPILING AND compile_result)
+    set( run_result "0"  CACHE STRING "" FORCE )
+    set( run_output "ok" CACHE STRING "" FORCE )
+endif()
+debug_try_run( "blas_gemm3m.cc" "${compile_result}" "${compile_output}"
+                                "${run_result}" "${run_output}" )
+
+if (compile_result AND "${run_output}" MATCHES "ok")
+    message( "${blue}   BLAS provides gemm3m${plain}" )
+    list( APPEND blaspp_defs_ "-DBLAS_HAVE_GEMM3M" )
+else()
+    message( "   BLAS does not provide gemm3m; using BLAS++ 3M implementation" )
+endif()
+
 endif() # run_
 #===============================================================================
 
 # Mark as already run (see top).
-set( blas_config_cache "${BLAS_LIBRARIES}" CACHE INTERNAL "" )
+set( blas_config_cache "${BLAS_LIBRARIES};${use_cblas}" CACHE INTERNAL "" )
 
 #-------------------------------------------------------------------------------
 message( DEBUG "
@@ -0,0 +1,52 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <stdio.h>
+#include <complex>
+
+#include "config.h"
+
+//------------------------------------------------------------------------------
+// gemm3m is an extension provided by MKL and OpenBLAS,
+// but is not in reference BLAS.
+#define BLAS_zgemm3m FORTRAN_NAME( zgemm3m, ZGEMM3M )
+
+#ifdef __cplusplus
+extern "C"
+#endif
+void BLAS_zgemm3m( const char* transA, const char* transB,
+                   const blas_int* m, const blas_int* n, const blas_int* k,
+                   const std::complex<double>* alpha,
+                   const std::complex<double>* A, const blas_int* lda,
+                   const std::complex<double>* B, const blas_int* ldb,
+                   const std::complex<double>* beta,
+                   std::complex<double>* C, const blas_int* ldc
+                   #ifdef BLAS_FORTRAN_STRLEN_END
+                   , size_t transA_len, size_t transB_len
+                   #endif
+                   );
+
+//------------------------------------------------------------------------------
+int main()
+{
+    // C = A B, 1-by-1 so the result is exact: (1 + 2i) (3 + 4i) = -5 + 10i.
+    blas_int n = 1;
+    std::complex<double> alpha = 1, beta = 0;
+    std::complex<double> A = { 1, 2 };
+    std::complex<double> B = { 3, 4 };
+    std::complex<double> C = { -1, -1 };
+    BLAS_zgemm3m( "n", "n", &n, &n, &n,
+                  &alpha, &A, &n, &B, &n, &beta, &C, &n
+                  #ifdef BLAS_FORTRAN_STRLEN_END
+                  , 1, 1
+                  #endif
+                  );
+    printf( "C = %.1f + %.1fi; should be -5.0 + 10.0i\n",
+            real( C ), imag( C ) );
+
+    bool okay = (C == std::complex<double>( -5, 10 ));
+    printf( "%s\n", okay ? "ok" : "failed" );
+    return ! okay;
+}
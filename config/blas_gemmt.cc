@@ -0,0 +1,51 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <stdio.h>
+
+#include "config.h"
+
+//------------------------------------------------------------------------------
+// gemmt is an extension provided by MKL, BLIS, and recent OpenBLAS,
+// but is not in reference BLAS.
+#define BLAS_dgemmt FORTRAN_NAME( dgemmt, DGEMMT )
+
+#ifdef __cplusplus
+extern "C"
+#endif
+void BLAS_dgemmt( const char* uplo, const char* transA, const char* transB,
+                  const blas_int* n, const blas_int* k,
+                  const double* alpha,
+                  const double* A, const blas_int* lda,
+                  const double* B, const blas_int* ldb,
+                  const double* beta,
+                  double* C, const blas_int* ldc
+                  #ifdef BLAS_FORTRAN_STRLEN_END
+                  , size_t uplo_len, size_t transA_len, size_t transB_len
+                  #endif
+                  );
+
+//------------------------------------------------------------------------------
+int main()
+{
+    // C = A B, lower triangle only; C(0, 1) must remain untouched.
+    blas_int n = 2, k = 2;
+    double alpha = 1, beta = 0;
+    double A[] = { 1, 2, 3, 4 };  // column-major [ 1 3; 2 4 ]
+    double B[] = { 5, 6, 7, 8 };  // column-major [ 5 7; 6 8 ]
+    double C[] = { -1, -1, -1, -1 };
+    BLAS_dgemmt( "l", "n", "n", &n, &k,
+                 &alpha, A, &n, B, &n, &beta, C, &n
+                 #ifdef BLAS_FORTRAN_STRLEN_END
+                 , 1, 1, 1
+                 #endif
+                 );
+    printf( "C = [ %.1f %.1f; %.1f %.1f ]; should be [ 23.0 -1.0; 34.0 50.0 ]\n",
+            C[ 0 ], C[ 2 ], C[ 1 ], C[ 3 ] );
+
+    bool okay = (C[ 0 ] == 23 && C[ 1 ] == 34 && C[ 2 ] == -1 && C[ 3 ] == 50);
+    printf( "%s\n", okay ? "ok" : "failed" );
+    return ! okay;
+}
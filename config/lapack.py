@@ -394,8 +394,19 @@ def cblas():
     i = config.choose( 'Choose CBLAS library:', labels )
     config.environ.merge( passed[i][1] )
     config.environ.append( 'CXXFLAGS', define('HAVE_CBLAS') )
+    if (use_cblas()):
+        config.environ.append( 'CXXFLAGS', define('USE_CBLAS') )
 # end cblas
 
+#-------------------------------------------------------------------------------
+def use_cblas():
+    '''
+    Returns true if use_cblas is set, so BLAS++ calls BLAS via CBLAS
+    instead of the Fortran interface.
+    '''
+    return config.environ['use_cblas'].lower() in ('1', 'y', 'yes', 'true', 'on')
+# end use_cblas
+
 #-------------------------------------------------------------------------------
 # This code is structured similarly to blas().
 def lapack():
@@ -517,6 +528,32 @@ def blas_float_return():
         raise Error( "Could not determine return type of sdot; check log." )
 # end
 
+#-------------------------------------------------------------------------------
+def blas_gemmt():
+    '''
+    Checks whether BLAS provides the gemmt extension (MKL, BLIS, OpenBLAS).
+    If not, BLAS++ uses its own triangle-only gemm.
+    '''
+    (rc, out, err) = config.compile_run(
+        'config/blas_gemmt.cc', {},
+        'BLAS provides gemmt' )
+    if (rc == 0):
+        config.environ.append( 'CXXFLAGS', define('HAVE_GEMMT') )
+# end
+
+#-------------------------------------------------------------------------------
+def blas_gemm3m():
+    '''
+    Checks whether BLAS provides the gemm3m extension (MKL, OpenBLAS).
+    If not, BLAS++ uses its own 3M complex gemm.
+    '''
+    (rc, out, err) = config.compile_run(
+        'config/blas_gemm3m.cc', {},
+        'BLAS provides gemm3m' )
+    if (rc == 0):
+        config.environ.append( 'CXXFLAGS', define('HAVE_GEMM3M') )
+# end
+
 #-------------------------------------------------------------------------------
 def blas_complex_return():
     '''
@@ -65,13 +65,20 @@ def main():
     config.lapack.blas()
     print()
     config.lapack.blas_float_return()
-    config.lapack.blas_complex_return()
+    if (not config.lapack.use_cblas()):
+        # cblas_zdotc_sub returns complex via an argument.
+        config.lapack.blas_complex_return()
+    config.lapack.blas_gemmt()
+    config.lapack.blas_gemm3m()
     config.lapack.vendor_version()
 
     # Must test mkl_version before cblas and lapacke, to define HAVE_MKL.
     try:
         config.lapack.cblas()
-    except Error:
+    except Error as ex:
+        if (config.lapack.use_cblas()):
+            print_warn( 'use_cblas requires CBLAS.' )
+            raise( ex )
         print_warn( 'BLAS++ needs CBLAS for testers.' )
 
     try:
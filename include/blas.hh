@@ -9,6 +9,7 @@
 #include "blas/defines.h"
 
 #include "blas/counter.hh"
+#include "blas/parallel.hh"
 
 // Version is updated by make_release.py; DO NOT EDIT.
 // Version 2024.10.26
@@ -27,23 +28,36 @@ const char* blaspp_id();
 // Level 1 BLAS template implementations
 
 #include "blas/asum.hh"
+#include "blas/asum2.hh"
+#include "blas/axpby.hh"
 #include "blas/axpy.hh"
+#include "blas/axpyi.hh"
 #include "blas/copy.hh"
 #include "blas/dot.hh"
+#include "blas/dot2.hh"
+#include "blas/dot_axpy.hh"
 #include "blas/dotu.hh"
+#include "blas/doti.hh"
+#include "blas/gthr.hh"
 #include "blas/iamax.hh"
+#include "blas/maxpy.hh"
+#include "blas/mdot.hh"
 #include "blas/nrm2.hh"
 #include "blas/rot.hh"
+#include "blas/rot_sequence.hh"
 #include "blas/rotg.hh"
 #include "blas/rotm.hh"
 #include "blas/rotmg.hh"
 #include "blas/scal.hh"
+#include "blas/sctr.hh"
 #include "blas/swap.hh"
+#include "blas/waxpby.hh"
 
 // =============================================================================
 // Level 2 BLAS template implementations
 
 #include "blas/gemv.hh"
+#include "blas/gemv2.hh"
 #include "blas/ger.hh"
 #include "blas/geru.hh"
 #include "blas/hemv.hh"
@@ -59,6 +73,8 @@ const char* blaspp_id();
 // Level 3 BLAS template implementations
 
 #include "blas/gemm.hh"
+#include "blas/gemmt.hh"
+#include "blas/gemm_pack.hh"
 #include "blas/hemm.hh"
 #include "blas/herk.hh"
 #include "blas/her2k.hh"
@@ -67,6 +83,8 @@ const char* blaspp_id();
 #include "blas/syr2k.hh"
 #include "blas/trmm.hh"
 #include "blas/trsm.hh"
+#include "blas/fixed.hh"
+#include "blas/gemm_epilogue.hh"
 
 // =============================================================================
 // Device BLAS
@@ -7,11 +7,63 @@
 #define BLAS_ASUM_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of asum. For real types and std::complex, the sum is
+/// split across vector lanes, so the loop vectorizes.
+/// @ingroup asum_internal
+template <typename T>
+real_type<T> asum_kernel( int64_t n, T const* x )
+{
+    using scalar_t = scalar_type<T>;
+    using real_t = real_type<T>;
+
+    // Converting to scalar_t first, e.g., float16 to float, avoids
+    // converting |x_i| back to float16.
+    real_t result = 0;
+    if constexpr (std::is_floating_point_v<real_t>) {
+        #pragma omp simd reduction(+: result)
+        for (int64_t i = 0; i < n; ++i) {
+            result += abs1( scalar_t( x[i] ) );
+        }
+    }
+    else {
+        for (int64_t i = 0; i < n; ++i) {
+            result += abs1( x[i] );
+        }
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by asum. For most types, this is the inline
+/// asum_kernel, compiled for the application's instruction set.
+/// @ingroup asum_internal
+template <typename T>
+inline real_type<T> asum_kernel_simd( int64_t n, T const* x )
+{
+    return asum_kernel( n, x );
+}
+
+/// For float16 and bfloat16, the kernel is compiled in the library in
+/// variants for several instruction sets, selected at runtime.
+/// See set_simd_isa.
+float asum_kernel_simd( int64_t n, float16 const* x );
+
+float asum_kernel_simd( int64_t n, bfloat16 const* x );
+
+}  // namespace internal
+
 // =============================================================================
 /// @return 1-norm of vector,
 ///     $|| Re(x) ||_1 + || Im(x) ||_1
@@ -42,12 +94,26 @@ asum(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread sums a contiguous part; parts are added in order.
+        std::vector<real_t> partial( nthreads );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            partial[ t ] = asum< T >( i1 - i0, &x[ i0*incx ], incx );
+        }
+        real_t result = 0;
+        for (int t = 0; t < nthreads; ++t)
+            result += partial[ t ];
+        return result;
+    }
+
     real_t result = 0;
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += abs1( x[i] );
-        }
+        result = internal::asum_kernel_simd( n, x );
     }
     else {
         // non-unit stride
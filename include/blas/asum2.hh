@@ -0,0 +1,156 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_ASUM2_HH
+#define BLAS_ASUM2_HH
+
+#include "blas/util.hh"
+#include "blas/dot2.hh"
+#include "blas/parallel.hh"
+
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Computes sum_i |Re(x_i)| + |Im(x_i)| as the unevaluated sum hi + lo,
+/// with the Sum2 algorithm.
+/// @ingroup asum2_internal
+template <typename scalar_t>
+void asum2_kernel(
+    int64_t n,
+    scalar_t const* x, int64_t incx,
+    real_type<scalar_t>* hi, real_type<scalar_t>* lo )
+{
+    using real_t = real_type<scalar_t>;
+    constexpr int lanes = compensated_lanes;
+
+    real_t s[ lanes ], c[ lanes ];
+    for (int l = 0; l < lanes; ++l) {
+        s[ l ] = c[ l ] = 0;
+    }
+
+    // Complex values are accessed as real and imaginary parts, avoiding
+    // std::complex operations, so the loop vectorizes.
+    real_t const* x_ = reinterpret_cast<real_t const*>( x );
+
+    auto sum = [&]( int64_t i0, int64_t ib, int64_t incx_ ) {
+        for (int64_t l = 0; l < ib; ++l) {
+            if constexpr (is_complex_v<scalar_t>) {
+                compensated_add( s[ l ], c[ l ],
+                                 std::abs( x_[ 2*(i0 + l)*incx_ ] ) );
+                compensated_add( s[ l ], c[ l ],
+                                 std::abs( x_[ 2*(i0 + l)*incx_ + 1 ] ) );
+            }
+            else {
+                compensated_add( s[ l ], c[ l ],
+                                 std::abs( x_[ (i0 + l)*incx_ ] ) );
+            }
+        }
+    };
+
+    int64_t n_lanes = n - n % lanes;
+    if (incx == 1) {
+        for (int64_t i = 0; i < n_lanes; i += lanes)
+            sum( i, lanes, 1 );
+    }
+    else {
+        for (int64_t i = 0; i < n_lanes; i += lanes)
+            sum( i, lanes, incx );
+    }
+    sum( n_lanes, n - n_lanes, incx );
+
+    compensated_reduce( s, c, *hi, *lo );
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by asum2. For most types, this is the inline
+/// asum2_kernel, compiled for the application's instruction set.
+/// @ingroup asum2_internal
+template <typename scalar_t>
+inline void asum2_kernel_simd(
+    int64_t n,
+    scalar_t const* x, int64_t incx,
+    real_type<scalar_t>* hi, real_type<scalar_t>* lo )
+{
+    asum2_kernel( n, x, incx, hi, lo );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void asum2_kernel_simd(
+    int64_t n, float const* x, int64_t incx,
+    float* hi, float* lo );
+
+void asum2_kernel_simd(
+    int64_t n, double const* x, int64_t incx,
+    double* hi, double* lo );
+
+void asum2_kernel_simd(
+    int64_t n, std::complex<float> const* x, int64_t incx,
+    float* hi, float* lo );
+
+void asum2_kernel_simd(
+    int64_t n, std::complex<double> const* x, int64_t incx,
+    double* hi, double* lo );
+
+}  // namespace internal
+
+// =============================================================================
+/// @return 1-norm of vector,
+///     $|| Re(x) ||_1 + || Im(x) ||_1
+///         = \sum_{i=0}^{n-1} |Re(x_i)| + |Im(x_i)|$,
+/// as accurate as if computed in twice the working precision, then rounded
+/// to working precision. Uses the compensated Sum2 algorithm of Ogita,
+/// Rump, and Oishi. As all terms are nonnegative, the relative error is
+/// at most $u + \gamma_n^2$, with unit roundoff u and
+/// $\gamma_n = n u / (1 - n u)$, compared to $\gamma_n$ for asum.
+/// @see asum for the usual version.
+///
+/// Generic implementation for IEEE floating point types.
+///
+/// @param[in] n
+///     Number of elements in x. n >= 0.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*incx + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx > 0.
+///
+/// @ingroup asum2
+
+template <typename T>
+real_type<T> asum2(
+    int64_t n,
+    T const *x, int64_t incx )
+{
+    typedef real_type<T> real_t;
+
+    // check arguments
+    blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
+    blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
+
+    // Each thread sums a contiguous part; parts are added in order,
+    // also with compensation.
+    int nthreads = internal::parallel_num_threads( n );
+    std::vector<real_t> hi( nthreads ), lo( nthreads );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( n, nthreads, t     );
+        int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+        internal::asum2_kernel_simd( i1 - i0, &x[ i0*incx ], incx,
+                                     &hi[ t ], &lo[ t ] );
+    }
+    return internal::compensated_combine( nthreads, hi.data(), lo.data() );
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_ASUM2_HH
@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_AXPBY_HH
+#define BLAS_AXPBY_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+// =============================================================================
+/// Add scaled vectors, $y = \alpha x + \beta y$.
+/// Fuses scal and axpy, so y is read and written only once.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] n
+///     Number of elements in x and y. n >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, y need not be set on input.
+///     If alpha is zero and beta is one, y is not updated.
+///
+/// @param[in, out] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @ingroup axpby
+
+template <typename TX, typename TY>
+void axpby(
+    int64_t n,
+    blas::scalar_type<TX, TY> alpha,
+    TX const *x, int64_t incx,
+    blas::scalar_type<TX, TY> beta,
+    TY       *y, int64_t incy )
+{
+    typedef blas::scalar_type<TX, TY> scalar_t;
+
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // quick return
+    if (alpha == scalar_t(0) && beta == scalar_t(1))
+        return;
+
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous part of the vectors.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            axpby< TX, TY >( i1 - i0,
+                             alpha, internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                             beta,  internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        return;
+    }
+
+    if (incx == 1 && incy == 1) {
+        // unit stride
+        if (beta == scalar_t(0)) {
+            for (int64_t i = 0; i < n; ++i) {
+                y[i] = alpha*x[i];
+            }
+        }
+        else {
+            for (int64_t i = 0; i < n; ++i) {
+                y[i] = alpha*x[i] + beta*y[i];
+            }
+        }
+    }
+    else {
+        // non-unit stride
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        for (int64_t i = 0; i < n; ++i) {
+            if (beta == scalar_t(0))
+                y[iy] = alpha*x[ix];
+            else
+                y[iy] = alpha*x[ix] + beta*y[iy];
+            ix += incx;
+            iy += incy;
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_AXPBY_HH
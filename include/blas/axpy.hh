@@ -7,11 +7,65 @@
 #define BLAS_AXPY_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of axpy, y = alpha x + y.
+/// @ingroup axpy_internal
+template <typename TX, typename TY>
+void axpy_kernel(
+    int64_t n, scalar_type<TX, TY> alpha,
+    TX const* x, TY* y )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        y[i] += alpha*x[i];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by axpy. For most types, this is the inline
+/// axpy_kernel, compiled for the application's instruction set.
+/// @ingroup axpy_internal
+template <typename TX, typename TY>
+inline void axpy_kernel_simd(
+    int64_t n, scalar_type<TX, TY> alpha,
+    TX const* x, TY* y )
+{
+    axpy_kernel( n, alpha, x, y );
+}
+
+/// For float16, bfloat16, and float x with double y, the kernel is
+/// compiled in the library in variants for several instruction sets,
+/// selected at runtime. See set_simd_isa.
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    float16 const* x, float16* y );
+
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    bfloat16 const* x, bfloat16* y );
+
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    float16 const* x, float* y );
+
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    bfloat16 const* x, float* y );
+
+void axpy_kernel_simd(
+    int64_t n, double alpha,
+    float const* x, double* y );
+
+}  // namespace internal
+
 // =============================================================================
 /// Add scaled vector, $y = \alpha x + y$.
 ///
@@ -57,11 +111,23 @@ void axpy(
     if (alpha == scalar_t(0))
         return;
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous part of the vectors.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            axpy< TX, TY >( i1 - i0, alpha,
+                            internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                            internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        return;
+    }
+
     if (incx == 1 && incy == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            y[i] += alpha*x[i];
-        }
+        internal::axpy_kernel_simd( n, alpha, x, y );
     }
     else {
         // non-unit stride
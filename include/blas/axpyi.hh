@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_AXPYI_HH
+#define BLAS_AXPYI_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Computes $y(indx) = \alpha x + y(indx)$ for nz elements.
+/// Indices must be distinct, so the loop can be vectorized, with
+/// gathers and scatters if the compiler deems them profitable.
+/// @ingroup axpyi_internal
+template <typename TX, typename TY>
+void axpyi_kernel(
+    int64_t nz,
+    scalar_type<TX, TY> alpha,
+    TX const* x, int64_t const* indx,
+    TY* y )
+{
+    if constexpr (is_complex_v<TX> && is_complex_v<TY>) {
+        // Complex values are accessed as real and imaginary parts,
+        // avoiding std::complex operations, so the loop vectorizes.
+        using real_t = real_type< scalar_type<TX, TY> >;
+        real_t ar = real( alpha );
+        real_t ai = imag( alpha );
+        auto x_ = reinterpret_cast< real_type<TX> const* >( x );
+        auto y_ = reinterpret_cast< real_type<TY>* >( y );
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            real_t xr = x_[ 2*i     ];
+            real_t xi = x_[ 2*i + 1 ];
+            int64_t k = 2*indx[ i ];
+            y_[ k     ] += ar*xr - ai*xi;
+            y_[ k + 1 ] += ar*xi + ai*xr;
+        }
+    }
+    else {
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            y[ indx[ i ] ] += alpha*x[ i ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by axpyi. For most types, this is the inline
+/// axpyi_kernel, compiled for the application's instruction set.
+/// @ingroup axpyi_internal
+template <typename TX, typename TY>
+inline void axpyi_kernel_simd(
+    int64_t nz,
+    scalar_type<TX, TY> alpha,
+    TX const* x, int64_t const* indx,
+    TY* y )
+{
+    axpyi_kernel( nz, alpha, x, indx, y );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void axpyi_kernel_simd(
+    int64_t nz, float alpha,
+    float const* x, int64_t const* indx,
+    float* y );
+
+void axpyi_kernel_simd(
+    int64_t nz, double alpha,
+    double const* x, int64_t const* indx,
+    double* y );
+
+void axpyi_kernel_simd(
+    int64_t nz, std::complex<float> alpha,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y );
+
+void axpyi_kernel_simd(
+    int64_t nz, std::complex<double> alpha,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y );
+
+}  // namespace internal
+
+// =============================================================================
+/// Add scaled sparse vector to dense vector,
+/// $y(indx) = \alpha x + y(indx)$, that is,
+/// $y_{indx_i} = \alpha x_i + y_{indx_i}$ for i = 0, ..., nz-1,
+/// where x is a sparse vector in compressed form with nonzeros x and
+/// indices indx, and y is a dense vector.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, y is not updated.
+///
+/// @param[in] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///     Indices must be distinct.
+///
+/// @param[in, out] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///
+/// @ingroup axpyi
+
+template <typename TX, typename TY>
+void axpyi(
+    int64_t nz,
+    blas::scalar_type<TX, TY> alpha,
+    TX const *x, int64_t const *indx,
+    TY       *y )
+{
+    typedef blas::scalar_type<TX, TY> scalar_t;
+
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    // quick return
+    if (alpha == scalar_t(0))
+        return;
+
+    // As indices are distinct, each thread updates a contiguous part
+    // of the index list independently.
+    int nthreads = internal::parallel_num_threads( nz );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( nz, nthreads, t     );
+        int64_t i1 = internal::parallel_part( nz, nthreads, t + 1 );
+        internal::axpyi_kernel_simd( i1 - i0, alpha, &x[ i0 ], &indx[ i0 ], y );
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_AXPYI_HH
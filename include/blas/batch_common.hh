@@ -987,6 +987,206 @@ void syr2k_check(
     }
 }
 
+// -----------------------------------------------------------------------------
+// Level 1 batch checks set internal_info[ i ] per problem, then call
+// level1_info to set info and throw, as in the Level 3 checks.
+inline void level1_info(
+        int64_t* internal_info, const size_t batchCount,
+        std::vector<int64_t> &info)
+{
+    if (info.size() == 1) {
+        // do a reduction that finds the first argument to encounter an error
+        int64_t lerror = INTERNAL_INFO_DEFAULT;
+        #pragma omp parallel for reduction(max:lerror)
+        for (size_t i = 0; i < batchCount; ++i) {
+            if (internal_info[i] == 0)
+                continue;    // skip problems that passed error checks
+            lerror = std::max(lerror, internal_info[i]);
+        }
+        info[0] = (lerror == INTERNAL_INFO_DEFAULT) ? 0 : lerror;
+
+        // delete the internal vector
+        delete[] internal_info;
+
+        // throw an exception if needed
+        blas_error_if_msg( info[0] != 0, "info = %lld", llong( info[0] ) );
+    }
+    else {
+        int64_t info_ = 0;
+        #pragma omp parallel for reduction(+:info_)
+        for (size_t i = 0; i < batchCount; ++i) {
+            info_ += info[i];
+        }
+        blas_error_if_msg( info_ != 0, "One or more non-zero entry in vector info");
+    }
+}
+
+// -----------------------------------------------------------------------------
+// batch axpy check
+template <typename T>
+void axpy_check(
+        std::vector<int64_t> const &n,
+        std::vector<T >      const &alpha,
+        std::vector<T*>      const &x, std::vector<int64_t> const &incx,
+        std::vector<T*>      const &y, std::vector<int64_t> const &incy,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    // size error checking
+    blas_error_if( (n.size()     != 1 && n.size()     != batchCount) );
+    blas_error_if( (alpha.size() != 1 && alpha.size() != batchCount) );
+    blas_error_if( (incx.size()  != 1 && incx.size()  != batchCount) );
+    blas_error_if( (incy.size()  != 1 && incy.size()  != batchCount) );
+
+    blas_error_if( (x.size() != 1 && x.size() < batchCount) );
+    blas_error_if(  y.size() < batchCount );
+
+    blas_error_if( x.size() == 1 && (n.size() > 1 || incx.size() > 1) );
+
+    int64_t* internal_info;
+    if (info.size() == 1) {
+        internal_info = new int64_t[batchCount];
+    }
+    else {
+        internal_info = &info[0];
+    }
+
+    // Level 1 problems are cheap to check, so use a static schedule.
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t n_    = extract<int64_t>(n,    i);
+        int64_t incx_ = extract<int64_t>(incx, i);
+        int64_t incy_ = extract<int64_t>(incy, i);
+
+        internal_info[i] = 0;
+        if (n_ < 0) internal_info[i] = -1;
+        else if (incx_ == 0) internal_info[i] = -4;
+        else if (incy_ == 0) internal_info[i] = -6;
+    }
+
+    level1_info( internal_info, batchCount, info );
+}
+
+// -----------------------------------------------------------------------------
+// batch dot check
+template <typename T>
+void dot_check(
+        std::vector<int64_t> const &n,
+        std::vector<T*>      const &x, std::vector<int64_t> const &incx,
+        std::vector<T*>      const &y, std::vector<int64_t> const &incy,
+        std::vector<T >      const &result,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    // size error checking
+    blas_error_if( (n.size()    != 1 && n.size()    != batchCount) );
+    blas_error_if( (incx.size() != 1 && incx.size() != batchCount) );
+    blas_error_if( (incy.size() != 1 && incy.size() != batchCount) );
+
+    blas_error_if( (x.size() != 1 && x.size() < batchCount) );
+    blas_error_if( (y.size() != 1 && y.size() < batchCount) );
+    blas_error_if(  result.size() < batchCount );
+
+    blas_error_if( x.size() == 1 && (n.size() > 1 || incx.size() > 1) );
+    blas_error_if( y.size() == 1 && (n.size() > 1 || incy.size() > 1) );
+
+    int64_t* internal_info;
+    if (info.size() == 1) {
+        internal_info = new int64_t[batchCount];
+    }
+    else {
+        internal_info = &info[0];
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t n_    = extract<int64_t>(n,    i);
+        int64_t incx_ = extract<int64_t>(incx, i);
+        int64_t incy_ = extract<int64_t>(incy, i);
+
+        internal_info[i] = 0;
+        if (n_ < 0) internal_info[i] = -1;
+        else if (incx_ == 0) internal_info[i] = -3;
+        else if (incy_ == 0) internal_info[i] = -5;
+    }
+
+    level1_info( internal_info, batchCount, info );
+}
+
+// -----------------------------------------------------------------------------
+// batch nrm2 check
+template <typename T>
+void nrm2_check(
+        std::vector<int64_t>            const &n,
+        std::vector<T*>                 const &x, std::vector<int64_t> const &incx,
+        std::vector< real_type<T> >     const &result,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    // size error checking
+    blas_error_if( (n.size()    != 1 && n.size()    != batchCount) );
+    blas_error_if( (incx.size() != 1 && incx.size() != batchCount) );
+
+    blas_error_if( (x.size() != 1 && x.size() < batchCount) );
+    blas_error_if(  result.size() < batchCount );
+
+    blas_error_if( x.size() == 1 && (n.size() > 1 || incx.size() > 1) );
+
+    int64_t* internal_info;
+    if (info.size() == 1) {
+        internal_info = new int64_t[batchCount];
+    }
+    else {
+        internal_info = &info[0];
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t n_    = extract<int64_t>(n,    i);
+        int64_t incx_ = extract<int64_t>(incx, i);
+
+        internal_info[i] = 0;
+        if (n_ < 0) internal_info[i] = -1;
+        else if (incx_ <= 0) internal_info[i] = -3;
+    }
+
+    level1_info( internal_info, batchCount, info );
+}
+
+// -----------------------------------------------------------------------------
+// batch scal check
+template <typename T>
+void scal_check(
+        std::vector<int64_t> const &n,
+        std::vector<T >      const &alpha,
+        std::vector<T*>      const &x, std::vector<int64_t> const &incx,
+        const size_t batchCount, std::vector<int64_t> &info)
+{
+    // size error checking
+    blas_error_if( (n.size()     != 1 && n.size()     != batchCount) );
+    blas_error_if( (alpha.size() != 1 && alpha.size() != batchCount) );
+    blas_error_if( (incx.size()  != 1 && incx.size()  != batchCount) );
+
+    blas_error_if(  x.size() < batchCount );
+
+    int64_t* internal_info;
+    if (info.size() == 1) {
+        internal_info = new int64_t[batchCount];
+    }
+    else {
+        internal_info = &info[0];
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < batchCount; ++i) {
+        int64_t n_    = extract<int64_t>(n,    i);
+        int64_t incx_ = extract<int64_t>(incx, i);
+
+        internal_info[i] = 0;
+        if (n_ < 0) internal_info[i] = -1;
+        else if (incx_ <= 0) internal_info[i] = -4;
+    }
+
+    level1_info( internal_info, batchCount, info );
+}
+
 }  // namespace batch
 }  // namespace blas
 
@@ -7,11 +7,59 @@
 #define BLAS_COPY_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of copy, y = x, converting from TX to TY.
+/// @ingroup copy_internal
+template <typename TX, typename TY>
+void copy_kernel( int64_t n, TX const* x, TY* y )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        y[i] = x[i];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by copy. For most types, this is the inline
+/// copy_kernel, compiled for the application's instruction set.
+/// @ingroup copy_internal
+template <typename TX, typename TY>
+inline void copy_kernel_simd( int64_t n, TX const* x, TY* y )
+{
+    copy_kernel( n, x, y );
+}
+
+/// For conversions between float16 or bfloat16 and float, and between
+/// float and double, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void copy_kernel_simd(
+    int64_t n, float16 const* x, float* y );
+
+void copy_kernel_simd(
+    int64_t n, float const* x, float16* y );
+
+void copy_kernel_simd(
+    int64_t n, bfloat16 const* x, float* y );
+
+void copy_kernel_simd(
+    int64_t n, float const* x, bfloat16* y );
+
+void copy_kernel_simd(
+    int64_t n, float const* x, double* y );
+
+void copy_kernel_simd(
+    int64_t n, double const* x, float* y );
+
+}  // namespace internal
+
 // =============================================================================
 /// Copy vector, $y = x$.
 ///
@@ -47,11 +95,23 @@ void copy(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous part of the vectors.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            copy< TX, TY >( i1 - i0,
+                            internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                            internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        return;
+    }
+
     if (incx == 1 && incy == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            y[i] = x[i];
-        }
+        internal::copy_kernel_simd( n, x, y );
     }
     else {
         // non-unit stride
@@ -38,21 +38,36 @@ public:
     enum class Id {
         // Level 1 BLAS
         asum,
+        asum2,
+        axpby,
         axpy,
+        axpyi,
         copy,
         dot,
+        dot2,
+        dot_axpy,
         dotu,
+        doti,
+        dotui,
+        gthr,
+        gthrz,
         iamax,
+        maxpy,
+        mdot,
         nrm2,
         rot,
+        rot_sequence,
         rotg,
         rotm,
         rotmg,
         scal,
+        sctr,
         swap,
+        waxpby,
 
         // Level 2 BLAS
         gemv,
+        gemv2,
         ger,
         geru,
         hemv,
@@ -66,6 +81,7 @@ public:
 
         // Level 3 BLAS
         gemm,
+        gemmt,
         hemm,
         herk,
         her2k,
@@ -79,6 +95,7 @@ public:
         dev_copy,
         dev_dot,
         dev_gemm,
+        dev_gemmt,
         dev_hemm,
         dev_her2k,
         dev_herk,
@@ -108,14 +125,38 @@ public:
     typedef axpy_type copy_type;
     typedef axpy_type swap_type;
     typedef axpy_type dot_type;
+    typedef axpy_type dot2_type;
     typedef axpy_type dotu_type;
     typedef axpy_type nrm2_type;
     typedef axpy_type asum_type;
+    typedef axpy_type asum2_type;
     typedef axpy_type iamax_type;
     typedef axpy_type rot_type;
     typedef axpy_type rotm_type;
     typedef axpy_type rotg_type;
     typedef axpy_type rotmg_type;
+    typedef axpy_type axpby_type;
+    typedef axpy_type waxpby_type;
+    typedef axpy_type dot_axpy_type;
+
+    // sparse, with n = nz
+    typedef axpy_type axpyi_type;
+    typedef axpy_type doti_type;
+    typedef axpy_type dotui_type;
+    typedef axpy_type gthr_type;
+    typedef axpy_type gthrz_type;
+    typedef axpy_type sctr_type;
+
+    struct mdot_type {
+        int64_t n, k;
+    };
+
+    typedef mdot_type maxpy_type;
+
+    struct rot_sequence_type {
+        blas::Side side;
+        int64_t m, n, k;
+    };
 
     //==============================================================================
     // Level 2 BLAS
@@ -125,6 +166,8 @@ public:
         int64_t m, n;
     };
 
+    typedef gemv_type gemv2_type;
+
     //------------------------------------------------------------------------------
     struct hemv_type {
         blas::Uplo uplo;
@@ -163,6 +206,13 @@ public:
         int64_t m, n, k;
     };
 
+    //------------------------------------------------------------------------------
+    struct gemmt_type {
+        blas::Uplo uplo;
+        blas::Op transA, transB;
+        int64_t n, k;
+    };
+
     //------------------------------------------------------------------------------
     struct hemm_type {
         blas::Side side;
@@ -204,6 +254,7 @@ public:
     typedef axpy_type dev_swap_type;
 
     typedef gemm_type dev_gemm_type;
+    typedef gemmt_type dev_gemmt_type;
 
     typedef hemm_type dev_hemm_type;
     typedef hemm_type dev_symm_type;
@@ -305,6 +356,14 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::axpyi: {
+                        auto *ptr = static_cast<axpyi_type *>( iter->ptr );
+                        double flop = Gflop<double>::axpy( ptr->n ) * 1e9 * iter->count;
+                        printf( "axpyi( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::scal: {
                         auto *ptr = static_cast<scal_type *>( iter->ptr );
                         double flop = Gflop<double>::scal( ptr->n ) * 1e9 * iter->count;
@@ -313,6 +372,14 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::sctr: {
+                        auto *ptr = static_cast<sctr_type *>( iter->ptr );
+                        double flop = Gflop<double>::copy( ptr->n ) * 1e9 * iter->count;
+                        printf( "sctr( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::copy: {
                         auto *ptr = static_cast<copy_type *>( iter->ptr );
                         double flop = Gflop<double>::copy( ptr->n ) * 1e9 * iter->count;
@@ -337,6 +404,14 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::dot2: {
+                        auto *ptr = static_cast<dot2_type *>( iter->ptr );
+                        double flop = Gflop<double>::dot( ptr->n ) * 1e9 * iter->count;
+                        printf( "dot2( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::dotu: {
                         auto *ptr = static_cast<dotu_type *>( iter->ptr );
                         double flop = Gflop<double>::dot( ptr->n ) * 1e9 * iter->count;
@@ -345,6 +420,38 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::doti: {
+                        auto *ptr = static_cast<doti_type *>( iter->ptr );
+                        double flop = Gflop<double>::dot( ptr->n ) * 1e9 * iter->count;
+                        printf( "doti( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::dotui: {
+                        auto *ptr = static_cast<dotui_type *>( iter->ptr );
+                        double flop = Gflop<double>::dot( ptr->n ) * 1e9 * iter->count;
+                        printf( "dotui( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::gthr: {
+                        auto *ptr = static_cast<gthr_type *>( iter->ptr );
+                        double flop = Gflop<double>::copy( ptr->n ) * 1e9 * iter->count;
+                        printf( "gthr( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::gthrz: {
+                        auto *ptr = static_cast<gthrz_type *>( iter->ptr );
+                        double flop = Gflop<double>::copy( ptr->n ) * 1e9 * iter->count;
+                        printf( "gthrz( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::nrm2: {
                         auto *ptr = static_cast<nrm2_type *>( iter->ptr );
                         double flop = Gflop<double>::nrm2( ptr->n ) * 1e9 * iter->count;
@@ -361,6 +468,14 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::asum2: {
+                        auto *ptr = static_cast<asum2_type *>( iter->ptr );
+                        double flop = Gflop<double>::asum( ptr->n ) * 1e9 * iter->count;
+                        printf( "asum2( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::iamax: {
                         auto *ptr = static_cast<iamax_type *>( iter->ptr );
                         double flop = Gflop<double>::iamax( ptr->n ) * 1e9 * iter->count;
@@ -384,6 +499,15 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::rot_sequence: {
+                        auto *ptr = static_cast<rot_sequence_type *>( iter->ptr );
+                        double flop = Gflop<double>::rot_sequence( ptr->side, ptr->m, ptr->n, ptr->k ) * 1e9 * iter->count;
+                        printf( "rot_sequence( %c, %lld, %lld, %lld ) count %d, flop count %.2e\n",
+                                to_char( ptr->side ), llong( ptr->m ), llong( ptr->n ),
+                                llong( ptr->k ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::rotmg: {
                         // auto *ptr = static_cast<rotmg_type *>( iter->ptr );
                         // double flop = Gflop<double>::rotmg( ptr->n ) * 1e9;
@@ -399,6 +523,46 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::axpby: {
+                        auto *ptr = static_cast<axpby_type *>( iter->ptr );
+                        double flop = Gflop<double>::axpby( ptr->n ) * 1e9 * iter->count;
+                        printf( "axpby( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::waxpby: {
+                        auto *ptr = static_cast<waxpby_type *>( iter->ptr );
+                        double flop = Gflop<double>::waxpby( ptr->n ) * 1e9 * iter->count;
+                        printf( "waxpby( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::dot_axpy: {
+                        auto *ptr = static_cast<dot_axpy_type *>( iter->ptr );
+                        double flop = Gflop<double>::dot_axpy( ptr->n ) * 1e9 * iter->count;
+                        printf( "dot_axpy( %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::mdot: {
+                        auto *ptr = static_cast<mdot_type *>( iter->ptr );
+                        double flop = Gflop<double>::mdot( ptr->n, ptr->k ) * 1e9 * iter->count;
+                        printf( "mdot( %lld, %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), llong( ptr->k ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
+                    case Id::maxpy: {
+                        auto *ptr = static_cast<maxpy_type *>( iter->ptr );
+                        double flop = Gflop<double>::maxpy( ptr->n, ptr->k ) * 1e9 * iter->count;
+                        printf( "maxpy( %lld, %lld ) count %d, flop count %.2e\n",
+                                llong( ptr->n ), llong( ptr->k ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
 
                     // Level 2 BLAS
                     case Id::gemv: {
@@ -410,6 +574,15 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::gemv2: {
+                        auto *ptr = static_cast<gemv2_type *>( iter->ptr );
+                        double flop = Gflop<double>::gemv( ptr->m, ptr->n ) * 1e9 * iter->count;
+                        printf( "gemv2( %c, %lld, %lld ) count %d, flop count %.2e\n",
+                                op2char( ptr->trans ), llong( ptr->m ), llong( ptr->n ),
+                                iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::hemv: {
                         auto *ptr = static_cast<hemv_type *>( iter->ptr );
                         double flop = Gflop<double>::hemv( ptr->n ) * 1e9 * iter->count;
@@ -504,6 +677,16 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::gemmt: {
+                        auto *ptr = static_cast<gemmt_type *>( iter->ptr );
+                        double flop = Gflop<double>::gemmt( ptr->n, ptr->k ) * 1e9 * iter->count;
+                        printf( "gemmt( %c, %c, %c, %lld, %lld ) count %d, flop count %.2e\n",
+                                uplo2char( ptr->uplo ),
+                                op2char( ptr->transA ), op2char( ptr->transB ),
+                                llong( ptr->n ), llong( ptr->k ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::hemm: {
                         auto *ptr = static_cast<hemm_type *>( iter->ptr );
                         double flop = Gflop<double>::hemm( ptr->side, ptr->m, ptr->n ) * 1e9 * iter->count;
@@ -606,6 +789,16 @@ public:
                         totalflops += flop;
                         break;
                     }
+                    case Id::dev_gemmt: {
+                        auto *ptr = static_cast<dev_gemmt_type *>( iter->ptr );
+                        double flop = Gflop<double>::gemmt( ptr->n, ptr->k ) * 1e9 * iter->count;
+                        printf( "dev_gemmt( %c, %c, %c, %lld, %lld ) count %d, flop count %.2e\n",
+                                uplo2char( ptr->uplo ),
+                                op2char( ptr->transA ), op2char( ptr->transB ),
+                                llong( ptr->n ), llong( ptr->k ), iter->count, flop );
+                        totalflops += flop;
+                        break;
+                    }
                     case Id::dev_hemm: {
                         auto *ptr = static_cast<dev_hemm_type *>( iter->ptr );
                         double flop = Gflop<double>::hemm( ptr->side, ptr->m, ptr->n ) * 1e9 * iter->count;
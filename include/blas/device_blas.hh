@@ -255,6 +255,59 @@ void gemm(
     std::complex<double>*       C, int64_t ldc,
     blas::Queue& queue );
 
+//------------------------------------------------------------------------------
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc,
+    blas::Queue& queue );
+
 //------------------------------------------------------------------------------
 void hemm(
     blas::Layout layout,
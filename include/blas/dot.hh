@@ -7,11 +7,73 @@
 #define BLAS_DOT_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of dot, $x^H y$. For real types, the sum is split
+/// across vector lanes, so the loop vectorizes.
+/// @ingroup dot_internal
+template <typename TX, typename TY>
+scalar_type<TX, TY> dot_kernel(
+    int64_t n, TX const* x, TY const* y )
+{
+    using scalar_t = scalar_type<TX, TY>;
+
+    scalar_t result = 0;
+    if constexpr (std::is_floating_point_v<scalar_t>) {
+        #pragma omp simd reduction(+: result)
+        for (int64_t i = 0; i < n; ++i) {
+            result += scalar_t( x[i] ) * scalar_t( y[i] );
+        }
+    }
+    else {
+        for (int64_t i = 0; i < n; ++i) {
+            result += conj(x[i]) * y[i];
+        }
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by dot. For most types, this is the inline
+/// dot_kernel, compiled for the application's instruction set.
+/// @ingroup dot_internal
+template <typename TX, typename TY>
+inline scalar_type<TX, TY> dot_kernel_simd(
+    int64_t n, TX const* x, TY const* y )
+{
+    return dot_kernel( n, x, y );
+}
+
+/// For float16, bfloat16, and float x with double y, the kernel is
+/// compiled in the library in variants for several instruction sets,
+/// selected at runtime. See set_simd_isa.
+float dot_kernel_simd(
+    int64_t n, float16 const* x, float16 const* y );
+
+float dot_kernel_simd(
+    int64_t n, bfloat16 const* x, bfloat16 const* y );
+
+float dot_kernel_simd(
+    int64_t n, float16 const* x, float const* y );
+
+float dot_kernel_simd(
+    int64_t n, bfloat16 const* x, float const* y );
+
+double dot_kernel_simd(
+    int64_t n, float const* x, double const* y );
+
+}  // namespace internal
+
 // =============================================================================
 /// @return dot product, $x^H y$.
 /// @see dotu for unconjugated version, $x^T y$.
@@ -50,12 +112,28 @@ scalar_type<TX, TY> dot(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread sums a contiguous part; parts are added in order.
+        std::vector<scalar_t> partial( nthreads );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            partial[ t ] = dot< TX, TY >( i1 - i0,
+                internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        scalar_t result = 0;
+        for (int t = 0; t < nthreads; ++t)
+            result += partial[ t ];
+        return result;
+    }
+
     scalar_t result = 0;
     if (incx == 1 && incy == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += conj(x[i]) * y[i];
-        }
+        result = internal::dot_kernel_simd( n, x, y );
     }
     else {
         // non-unit stride
@@ -0,0 +1,293 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_DOT2_HH
+#define BLAS_DOT2_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <cmath>
+#include <vector>
+
+// Compensated (accurate) summation, using the error-free transformations
+// TwoSum and TwoProd of Ogita, Rump, and Oishi, "Accurate sum and dot
+// product", SIAM J. Sci. Comput., 2005. Results are as accurate as if
+// computed in twice the working precision, then rounded to working
+// precision. These rely on IEEE arithmetic, so must not be compiled with
+// -ffast-math or similar flags that reassociate floating point operations.
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+/// Compensated sums are split into this many interleaved partial sums,
+/// so the loops vectorize, and to hide the latency of the dependent
+/// operations of TwoSum.
+const int compensated_lanes = 16;
+
+//------------------------------------------------------------------------------
+/// Error-free transformation of a sum, TwoSum of Knuth:
+/// s = fl( a + b ) and s + e = a + b exactly.
+/// @ingroup dot2_internal
+template <typename real_t>
+inline void two_sum( real_t a, real_t b, real_t& s, real_t& e )
+{
+    s = a + b;
+    real_t z = s - a;
+    e = (a - (s - z)) + (b - z);
+}
+
+//------------------------------------------------------------------------------
+/// Error-free transformation of a product, TwoProd using FMA:
+/// p = fl( a b ) and p + e = a b exactly, barring underflow.
+/// @ingroup dot2_internal
+template <typename real_t>
+inline void two_prod( real_t a, real_t b, real_t& p, real_t& e )
+{
+    p = a*b;
+    e = std::fma( a, b, -p );
+}
+
+//------------------------------------------------------------------------------
+/// Adds a to the compensated sum s + c, where s is the running sum and
+/// c accumulates its rounding errors.
+/// @ingroup dot2_internal
+template <typename real_t>
+inline void compensated_add( real_t& s, real_t& c, real_t a )
+{
+    real_t e;
+    two_sum( s, a, s, e );
+    c += e;
+}
+
+//------------------------------------------------------------------------------
+/// Adds a b to the compensated sum s + c.
+/// @ingroup dot2_internal
+template <typename real_t>
+inline void compensated_add_prod( real_t& s, real_t& c, real_t a, real_t b )
+{
+    real_t p, e, q;
+    two_prod( a, b, p, e );
+    two_sum( s, p, s, q );
+    c += q + e;
+}
+
+//------------------------------------------------------------------------------
+/// Sums compensated_lanes partial sums s[ l ] + c[ l ] into hi + lo.
+/// @ingroup dot2_internal
+template <typename real_t>
+inline void compensated_reduce(
+    real_t const* s, real_t const* c, real_t& hi, real_t& lo )
+{
+    hi = 0;
+    lo = 0;
+    for (int l = 0; l < compensated_lanes; ++l) {
+        compensated_add( hi, lo, s[ l ] );
+        lo += c[ l ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes x^H y if conj_x, else x^T y, as the unevaluated sum hi + lo,
+/// with the Dot2 algorithm. Complex products are formed from
+/// real products, each added with TwoProd.
+/// Element i of x is x[ i*incx ], so incx < 0 must be handled by the caller.
+/// @ingroup dot2_internal
+template <typename scalar_t>
+void dot2_kernel(
+    bool conj_x, int64_t n,
+    scalar_t const* x, int64_t incx,
+    scalar_t const* y, int64_t incy,
+    scalar_t* hi, scalar_t* lo )
+{
+    using real_t = real_type<scalar_t>;
+    constexpr int lanes = compensated_lanes;
+
+    // real and imaginary parts, each with lanes partial sums
+    real_t sr[ lanes ], cr[ lanes ], si[ lanes ], ci[ lanes ];
+    for (int l = 0; l < lanes; ++l) {
+        sr[ l ] = cr[ l ] = si[ l ] = ci[ l ] = 0;
+    }
+
+    // Complex values are accessed as real and imaginary parts, avoiding
+    // std::complex operations, so the loop vectorizes.
+    // (xr + i xim) (yr + i yim), with xim = -imag( x ) for x^H.
+    real_t const* x_ = reinterpret_cast<real_t const*>( x );
+    real_t const* y_ = reinterpret_cast<real_t const*>( y );
+    real_t sign = conj_x ? -1 : 1;
+
+    auto sum = [&]( int64_t i0, int64_t ib, int64_t incx_, int64_t incy_ ) {
+        for (int64_t l = 0; l < ib; ++l) {
+            if constexpr (is_complex_v<scalar_t>) {
+                real_t xr  = x_[ 2*(i0 + l)*incx_ ];
+                real_t xim = x_[ 2*(i0 + l)*incx_ + 1 ] * sign;
+                real_t yr  = y_[ 2*(i0 + l)*incy_ ];
+                real_t yim = y_[ 2*(i0 + l)*incy_ + 1 ];
+                compensated_add_prod( sr[ l ], cr[ l ],  xr,  yr  );
+                compensated_add_prod( sr[ l ], cr[ l ], -xim, yim );
+                compensated_add_prod( si[ l ], ci[ l ],  xr,  yim );
+                compensated_add_prod( si[ l ], ci[ l ],  xim, yr  );
+            }
+            else {
+                compensated_add_prod( sr[ l ], cr[ l ],
+                                      x_[ (i0 + l)*incx_ ],
+                                      y_[ (i0 + l)*incy_ ] );
+            }
+        }
+    };
+
+    int64_t n_lanes = n - n % lanes;
+    if (incx == 1 && incy == 1) {
+        for (int64_t i = 0; i < n_lanes; i += lanes)
+            sum( i, lanes, 1, 1 );
+    }
+    else {
+        for (int64_t i = 0; i < n_lanes; i += lanes)
+            sum( i, lanes, incx, incy );
+    }
+    sum( n_lanes, n - n_lanes, incx, incy );
+
+    real_t hr, lr, hi_, li;
+    compensated_reduce( sr, cr, hr, lr );
+    compensated_reduce( si, ci, hi_, li );
+    *hi = make_scalar<scalar_t>( hr, hi_ );
+    *lo = make_scalar<scalar_t>( lr, li );
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by dot2 and gemv2. For most types, this is the inline
+/// dot2_kernel, compiled for the application's instruction set.
+/// @ingroup dot2_internal
+template <typename scalar_t>
+inline void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    scalar_t const* x, int64_t incx,
+    scalar_t const* y, int64_t incy,
+    scalar_t* hi, scalar_t* lo )
+{
+    dot2_kernel( conj_x, n, x, incx, y, incy, hi, lo );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime, so FMA is inlined
+/// and vectorized even if the library is built for a baseline instruction
+/// set without FMA. See set_simd_isa.
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    float const* x, int64_t incx,
+    float const* y, int64_t incy,
+    float* hi, float* lo );
+
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    double const* x, int64_t incx,
+    double const* y, int64_t incy,
+    double* hi, double* lo );
+
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>* hi, std::complex<float>* lo );
+
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>* hi, std::complex<double>* lo );
+
+//------------------------------------------------------------------------------
+/// Adds the unevaluated sums in hi[ t ] + lo[ t ], t = 0, ..., count-1,
+/// in order, and returns the result rounded to working precision.
+/// Used to combine the parts summed by each thread.
+/// @ingroup dot2_internal
+template <typename scalar_t>
+scalar_t compensated_combine(
+    int count, scalar_t const* hi, scalar_t const* lo )
+{
+    using real_t = real_type<scalar_t>;
+    real_t sr = 0, cr = 0, si = 0, ci = 0;
+    for (int t = 0; t < count; ++t) {
+        compensated_add( sr, cr, real( hi[ t ] ) );
+        compensated_add( si, ci, imag( hi[ t ] ) );
+        cr += real( lo[ t ] );
+        ci += imag( lo[ t ] );
+    }
+    return make_scalar<scalar_t>( sr + cr, si + ci );
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// @return dot product, $x^H y$, as accurate as if computed in twice the
+/// working precision, then rounded to working precision.
+/// Uses the compensated Dot2 algorithm of Ogita, Rump, and Oishi,
+/// with error-free transformations of each product and sum.
+/// The error is bounded by
+/// $u |x^H y| + \gamma_n^2 |x|^T |y|$, with unit roundoff u and
+/// $\gamma_n = n u / (1 - n u)$, compared to $\gamma_n |x|^T |y|$ for dot.
+/// For instance, residuals in single precision need not be promoted
+/// to double, which doubles memory traffic.
+/// @see dot for the usual version.
+///
+/// Generic implementation for IEEE floating point types.
+/// Assumes no overflow or underflow in intermediate products.
+///
+/// @param[in] n
+///     Number of elements in x and y. n >= 0.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @ingroup dot2
+
+template <typename T>
+T dot2(
+    int64_t n,
+    T const *x, int64_t incx,
+    T const *y, int64_t incy )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // with negative inc, element i is at (n - 1 - i)*|inc|
+    if (incx < 0)
+        x += (1 - n)*incx;
+    if (incy < 0)
+        y += (1 - n)*incy;
+
+    // Each thread sums a contiguous part; parts are added in order,
+    // also with compensation.
+    int nthreads = internal::parallel_num_threads( n );
+    std::vector<T> hi( nthreads ), lo( nthreads );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( n, nthreads, t     );
+        int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+        internal::dot2_kernel_simd( true, i1 - i0, &x[ i0*incx ], incx,
+                                    &y[ i0*incy ], incy, &hi[ t ], &lo[ t ] );
+    }
+    return internal::compensated_combine( nthreads, hi.data(), lo.data() );
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_DOT2_HH
@@ -0,0 +1,131 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_DOT_AXPY_HH
+#define BLAS_DOT_AXPY_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+
+// =============================================================================
+/// Add scaled vector, then take the dot product with the result,
+/// $y = \alpha x + y$, returning $y^H z$ for the updated y.
+/// Fuses axpy and dot, so y is read and written only once.
+/// For instance, in conjugate gradient the residual update and its norm,
+/// $r = r - \alpha q$, $\rho = r^H r$, is
+/// `rho = dot_axpy( n, -alpha, q, 1, r, 1, r, 1 )`.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] n
+///     Number of elements in x, y, and z. n >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in, out] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @param[in] z
+///     The n-element vector z, in an array of length (n-1)*abs(incz) + 1.
+///     z may be the same as y, with the same stride.
+///
+/// @param[in] incz
+///     Stride between elements of z. incz must not be zero.
+///     If incz < 0, uses elements of z in reverse order: z(n-1), ..., z(0).
+///
+/// @return dot product of updated y and z, $y^H z$.
+///
+/// @ingroup dot_axpy
+
+template <typename TX, typename TY, typename TZ>
+scalar_type<TX, TY, TZ> dot_axpy(
+    int64_t n,
+    scalar_type<TX, TY, TZ> alpha,
+    TX const *x, int64_t incx,
+    TY       *y, int64_t incy,
+    TZ const *z, int64_t incz )
+{
+    typedef scalar_type<TX, TY, TZ> scalar_t;
+
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+    blas_error_if( incz == 0 );
+
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread sums a contiguous part; parts are added in order.
+        std::vector<scalar_t> partial( nthreads );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            partial[ t ] = dot_axpy< TX, TY, TZ >( i1 - i0, alpha,
+                internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                internal::vector_block( y, n, incy, i0, i1 - i0 ), incy,
+                internal::vector_block( z, n, incz, i0, i1 - i0 ), incz );
+        }
+        scalar_t result = 0;
+        for (int t = 0; t < nthreads; ++t)
+            result += partial[ t ];
+        return result;
+    }
+
+    scalar_t result = 0;
+    if (incx == 1 && incy == 1 && incz == 1) {
+        // unit stride
+        if constexpr (std::is_floating_point< scalar_t >::value) {
+            // Reordering the sum lets it vectorize. z may alias y, but
+            // each z[i] is read after y[i] is updated in the same iteration.
+            #pragma omp simd reduction(+: result)
+            for (int64_t i = 0; i < n; ++i) {
+                y[i] += alpha*x[i];
+                result += y[i] * z[i];
+            }
+        }
+        else {
+            for (int64_t i = 0; i < n; ++i) {
+                y[i] += alpha*x[i];
+                result += conj(y[i]) * z[i];
+            }
+        }
+    }
+    else {
+        // non-unit stride
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        int64_t iz = (incz > 0 ? 0 : (-n + 1)*incz);
+        for (int64_t i = 0; i < n; ++i) {
+            y[iy] += alpha*x[ix];
+            result += conj(y[iy]) * z[iz];
+            ix += incx;
+            iy += incy;
+            iz += incz;
+        }
+    }
+    return result;
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_DOT_AXPY_HH
@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_DOTI_HH
+#define BLAS_DOTI_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+/// doti sums are split into this many interleaved partial sums, so the
+/// loop vectorizes, or, where gathers are emulated with scalar loads,
+/// to hide the latency of the dependent additions.
+const int doti_lanes = 16;
+
+//------------------------------------------------------------------------------
+/// @return $x^H y(indx)$ if conj_x, else $x^T y(indx)$, for nz elements.
+/// @ingroup doti_internal
+template <typename TX, typename TY>
+scalar_type<TX, TY> doti_kernel(
+    bool conj_x, int64_t nz,
+    TX const* x, int64_t const* indx,
+    TY const* y )
+{
+    using scalar_t = scalar_type<TX, TY>;
+    using real_t   = real_type<scalar_t>;
+    constexpr int lanes = doti_lanes;
+    int64_t nz_lanes = nz - nz % lanes;
+
+    if constexpr (is_complex_v<TX> && is_complex_v<TY>) {
+        // Complex values are accessed as real and imaginary parts,
+        // avoiding std::complex operations, so the loop vectorizes.
+        // (xr + i xim) (yr + i yim), with xim = -imag( x ) for x^H.
+        auto x_ = reinterpret_cast< real_type<TX> const* >( x );
+        auto y_ = reinterpret_cast< real_type<TY> const* >( y );
+        real_t sign = conj_x ? -1 : 1;
+        real_t sr[ lanes ] = {}, si[ lanes ] = {};
+        auto sum = [&]( int64_t i0, int64_t ib ) {
+            #pragma omp simd
+            for (int64_t l = 0; l < ib; ++l) {
+                real_t xr  = x_[ 2*(i0 + l) ];
+                real_t xim = x_[ 2*(i0 + l) + 1 ] * sign;
+                int64_t k  = 2*indx[ i0 + l ];
+                real_t yr  = y_[ k     ];
+                real_t yim = y_[ k + 1 ];
+                sr[ l ] += xr*yr  - xim*yim;
+                si[ l ] += xr*yim + xim*yr;
+            }
+        };
+        for (int64_t i = 0; i < nz_lanes; i += lanes)
+            sum( i, lanes );
+        sum( nz_lanes, nz - nz_lanes );
+
+        real_t rr = 0, ri = 0;
+        for (int l = 0; l < lanes; ++l) {
+            rr += sr[ l ];
+            ri += si[ l ];
+        }
+        return scalar_t( rr, ri );
+    }
+    else if constexpr (std::is_arithmetic_v<scalar_t>) {
+        scalar_t s[ lanes ] = {};
+        auto sum = [&]( int64_t i0, int64_t ib ) {
+            #pragma omp simd
+            for (int64_t l = 0; l < ib; ++l) {
+                s[ l ] += x[ i0 + l ] * y[ indx[ i0 + l ] ];
+            }
+        };
+        for (int64_t i = 0; i < nz_lanes; i += lanes)
+            sum( i, lanes );
+        sum( nz_lanes, nz - nz_lanes );
+
+        scalar_t result = 0;
+        for (int l = 0; l < lanes; ++l)
+            result += s[ l ];
+        return result;
+    }
+    else {
+        scalar_t result = 0;
+        for (int64_t i = 0; i < nz; ++i) {
+            result += (conj_x ? conj( x[ i ] ) : x[ i ]) * y[ indx[ i ] ];
+        }
+        return result;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by doti and dotui. For most types, this is the inline
+/// doti_kernel, compiled for the application's instruction set.
+/// @ingroup doti_internal
+template <typename TX, typename TY>
+inline scalar_type<TX, TY> doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    TX const* x, int64_t const* indx,
+    TY const* y )
+{
+    return doti_kernel( conj_x, nz, x, indx, y );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+float doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y );
+
+double doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y );
+
+std::complex<float> doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y );
+
+std::complex<double> doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y );
+
+//------------------------------------------------------------------------------
+/// @return $x^H y(indx)$ if conj_x, else $x^T y(indx)$.
+/// Each thread sums a contiguous part of the index list;
+/// parts are added in order.
+/// @ingroup doti_internal
+template <typename TX, typename TY>
+scalar_type<TX, TY> doti_parallel(
+    bool conj_x, int64_t nz,
+    TX const* x, int64_t const* indx,
+    TY const* y )
+{
+    using scalar_t = scalar_type<TX, TY>;
+
+    int nthreads = parallel_num_threads( nz );
+    std::vector<scalar_t> partial( nthreads );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = parallel_part( nz, nthreads, t     );
+        int64_t i1 = parallel_part( nz, nthreads, t + 1 );
+        partial[ t ] = doti_kernel_simd( conj_x, i1 - i0,
+                                         &x[ i0 ], &indx[ i0 ], y );
+    }
+    scalar_t result = 0;
+    for (int t = 0; t < nthreads; ++t)
+        result += partial[ t ];
+    return result;
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// @return sparse-dense dot product, $x^H y(indx)
+///     = \sum_{i=0}^{nz-1} \bar{x}_i y_{indx_i}$,
+/// where x is a sparse vector in compressed form with nonzeros x and
+/// indices indx, and y is a dense vector.
+/// @see dotui for unconjugated version, $x^T y(indx)$.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///
+/// @param[in] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///
+/// @ingroup doti
+
+template <typename TX, typename TY>
+scalar_type<TX, TY> doti(
+    int64_t nz,
+    TX const *x, int64_t const *indx,
+    TY const *y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    return internal::doti_parallel( true, nz, x, indx, y );
+}
+
+// =============================================================================
+/// @return unconjugated sparse-dense dot product, $x^T y(indx)
+///     = \sum_{i=0}^{nz-1} x_i y_{indx_i}$,
+/// where x is a sparse vector in compressed form with nonzeros x and
+/// indices indx, and y is a dense vector.
+/// @see doti for conjugated version, $x^H y(indx)$.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///
+/// @param[in] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///
+/// @ingroup dotui
+
+template <typename TX, typename TY>
+scalar_type<TX, TY> dotui(
+    int64_t nz,
+    TX const *x, int64_t const *indx,
+    TY const *y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    return internal::doti_parallel( false, nz, x, indx, y );
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_DOTI_HH
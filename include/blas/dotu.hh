@@ -7,8 +7,10 @@
 #define BLAS_DOTU_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
+#include <vector>
 
 namespace blas {
 
@@ -50,6 +52,24 @@ scalar_type<TX, TY> dotu(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread sums a contiguous part; parts are added in order.
+        std::vector<scalar_t> partial( nthreads );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            partial[ t ] = dotu< TX, TY >( i1 - i0,
+                internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        scalar_t result = 0;
+        for (int t = 0; t < nthreads; ++t)
+            result += partial[ t ];
+        return result;
+    }
+
     scalar_t result = 0;
     if (incx == 1 && incy == 1) {
         // unit stride
@@ -0,0 +1,377 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_FIXED_HH
+#define BLAS_FIXED_HH
+
+#include "blas/util.hh"
+
+#include <cassert>
+
+namespace blas {
+namespace fixed {
+
+//------------------------------------------------------------------------------
+/// Extent that is given at run time instead of compile time,
+/// e.g., blas::fixed::gemm< dynamic, dynamic, 8 >( ... ).
+constexpr int64_t dynamic = -1;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return extent E if it is known at compile time, otherwise the
+/// run-time extent n. For static extents, the result is a constant the
+/// compiler can use to fully unroll loops.
+template <int64_t E>
+inline int64_t extent( int64_t n )
+{
+    if constexpr (E == dynamic) {
+        return n;
+    }
+    else {
+        assert( n == E );
+        return E;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return element (i, j) of op(X), for column-major X.
+template <Op op, typename T>
+inline T op_elem( T const* X, int64_t ldx, int64_t i, int64_t j )
+{
+    using blas::conj;
+    if constexpr (op == Op::NoTrans)
+        return X[ i + j*ldx ];
+    else if constexpr (op == Op::Trans)
+        return X[ j + i*ldx ];
+    else
+        return conj( X[ j + i*ldx ] );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the MB-by-NB tile C(i0 : i0+MB, j0 : j0+NB), accumulating
+/// op(A) op(B) in a local array that the compiler can keep in registers,
+/// since C may alias A or B as far as it knows.
+template <int64_t MB, int64_t NB, Op opA, Op opB,
+          typename TA, typename TB, typename TC>
+inline void gemm_tile(
+    int64_t i0, int64_t j0, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    using scalar_t = scalar_type<TA, TB, TC>;
+
+    scalar_t ab[ NB ][ MB ] = {};
+    scalar_t a[ MB ];
+    for (int64_t l = 0; l < k; ++l) {
+        for (int64_t i = 0; i < MB; ++i)
+            a[ i ] = op_elem<opA>( A, lda, i0 + i, l );
+        for (int64_t j = 0; j < NB; ++j) {
+            scalar_t b = op_elem<opB>( B, ldb, l, j0 + j );
+            #pragma omp simd
+            for (int64_t i = 0; i < MB; ++i)
+                ab[ j ][ i ] += a[ i ]*b;
+        }
+    }
+
+    for (int64_t j = 0; j < NB; ++j) {
+        TC* Cj = &C[ i0 + (j0 + j)*ldc ];
+        if (beta == scalar_t( 0 )) {
+            for (int64_t i = 0; i < MB; ++i)
+                Cj[ i ] = alpha*ab[ j ][ i ];
+        }
+        else {
+            for (int64_t i = 0; i < MB; ++i)
+                Cj[ i ] = alpha*ab[ j ][ i ] + beta*Cj[ i ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes columns j0 : j0+NB of C, in MB-row tiles for static M.
+template <int64_t M, int64_t NB, Op opA, Op opB,
+          typename TA, typename TB, typename TC>
+inline void gemm_tile_cols(
+    int64_t j0, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    constexpr int64_t mb = (M < 8 ? M : 8);
+    constexpr int64_t mr = M % mb;
+    for (int64_t i0 = 0; i0 + mb <= M; i0 += mb) {
+        gemm_tile<mb, NB, opA, opB>(
+            i0, j0, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+    if constexpr (mr > 0) {
+        gemm_tile<mr, NB, opA, opB>(
+            M - mr, j0, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Column-major kernel for C = alpha op(A) op(B) + beta C, with the
+/// operations and any static extents fixed at compile time.
+/// No argument checks.
+template <int64_t M, int64_t N, int64_t K, Op opA, Op opB,
+          typename TA, typename TB, typename TC>
+inline void gemm(
+    int64_t m_, int64_t n_, int64_t k_,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    using scalar_t = scalar_type<TA, TB, TC>;
+
+    const int64_t m = extent<M>( m_ );
+    const int64_t n = extent<N>( n_ );
+    const int64_t k = extent<K>( k_ );
+
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    if constexpr (M != dynamic && M > 0) {
+        // register tiles of up to 8 rows by 4 columns
+        int64_t j = 0;
+        for (; j + 4 <= n; j += 4) {
+            gemm_tile_cols<M, 4, opA, opB>(
+                j, k, alpha, A, lda, B, ldb, beta, C, ldc );
+        }
+        if constexpr (N != dynamic) {
+            constexpr int64_t nr = N % 4;
+            if constexpr (nr > 0) {
+                gemm_tile_cols<M, nr, opA, opB>(
+                    N - nr, k, alpha, A, lda, B, ldb, beta, C, ldc );
+            }
+        }
+        else {
+            for (; j < n; ++j) {
+                gemm_tile_cols<M, 1, opA, opB>(
+                    j, k, alpha, A, lda, B, ldb, beta, C, ldc );
+            }
+        }
+    }
+    else {
+        for (int64_t j = 0; j < n; ++j) {
+            TC* Cj = &C[ j*ldc ];
+            if constexpr (opA == Op::NoTrans) {
+                // axpy form: C(:, j) += A(:, l) * alpha op(B)(l, j)
+                if (beta == zero) {
+                    for (int64_t i = 0; i < m; ++i)
+                        Cj[ i ] = zero;
+                }
+                else if (beta != one) {
+                    for (int64_t i = 0; i < m; ++i)
+                        Cj[ i ] *= beta;
+                }
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Blj = alpha*op_elem<opB>( B, ldb, l, j );
+                    TA const* Al = &A[ l*lda ];
+                    #pragma omp simd
+                    for (int64_t i = 0; i < m; ++i)
+                        Cj[ i ] += Al[ i ]*alpha_Blj;
+                }
+            }
+            else {
+                // dot form: C(i, j) = alpha op(A)(i, :) op(B)(:, j) + beta C(i, j)
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += op_elem<opA>( A, lda, i, l )
+                             * op_elem<opB>( B, ldb, l, j );
+                    if (beta == zero)
+                        Cj[ i ] = alpha*sum;
+                    else
+                        Cj[ i ] = alpha*sum + beta*Cj[ i ];
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Dispatches the run-time op(B) to a compile-time kernel.
+template <int64_t M, int64_t N, int64_t K, Op opA,
+          typename TA, typename TB, typename TC>
+inline void gemm(
+    Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    if (transB == Op::NoTrans)
+        gemm<M, N, K, opA, Op::NoTrans>(
+            m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    else if (transB == Op::Trans)
+        gemm<M, N, K, opA, Op::Trans>(
+            m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    else
+        gemm<M, N, K, opA, Op::ConjTrans>(
+            m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Dispatches the run-time op(A) and op(B) to a compile-time kernel.
+template <int64_t M, int64_t N, int64_t K,
+          typename TA, typename TB, typename TC>
+inline void gemm(
+    Op transA, Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    if (transA == Op::NoTrans)
+        gemm<M, N, K, Op::NoTrans>(
+            transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    else if (transA == Op::Trans)
+        gemm<M, N, K, Op::Trans>(
+            transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    else
+        gemm<M, N, K, Op::ConjTrans>(
+            transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// General matrix-matrix multiply with extents fixed at compile time:
+/// \[
+///     C = \alpha op(A) \times op(B) + \beta C,
+/// \]
+/// as in blas::gemm, for the small matrices where argument checks and
+/// calling the BLAS library cost more than the arithmetic.
+/// Each of M, N, K is either a compile-time extent or fixed::dynamic,
+/// in which case the run-time m, n, or k is used. Static extents let the
+/// compiler fully unroll and vectorize the loops.
+///
+/// Unlike blas::gemm, arguments are not checked, and alpha = 0 is not a
+/// special case. For extents that are static, the run-time m, n, or k
+/// must match; this is asserted only in debug builds.
+///
+/// Example:
+///
+///     // static K; dynamic M, N
+///     blas::fixed::gemm< blas::fixed::dynamic, blas::fixed::dynamic, 8 >(
+///         Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, n, 8,
+///         alpha, A, lda, B, ldb, beta, C, ldc );
+///
+/// @tparam M
+///     Number of rows of the matrix C and $op(A)$, or fixed::dynamic.
+///
+/// @tparam N
+///     Number of columns of the matrix C and $op(B)$, or fixed::dynamic.
+///
+/// @tparam K
+///     Number of columns of $op(A)$ and rows of $op(B)$, or fixed::dynamic.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] transA
+///     The operation $op(A)$ to be used: Op::NoTrans, Op::Trans, or Op::ConjTrans.
+///
+/// @param[in] transB
+///     The operation $op(B)$ to be used: Op::NoTrans, Op::Trans, or Op::ConjTrans.
+///
+/// @param[in] m
+///     Number of rows of the matrix C and $op(A)$. Must equal M, unless M is dynamic.
+///
+/// @param[in] n
+///     Number of columns of the matrix C and $op(B)$. Must equal N, unless N is dynamic.
+///
+/// @param[in] k
+///     Number of columns of $op(A)$ and rows of $op(B)$. Must equal K, unless K is dynamic.
+///
+/// @param[in] alpha
+///     Scalar alpha.
+///
+/// @param[in] A
+///     The matrix A, as in blas::gemm.
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///
+/// @param[in] B
+///     The matrix B, as in blas::gemm.
+///
+/// @param[in] ldb
+///     Leading dimension of B.
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, C need not be set on input.
+///
+/// @param[in,out] C
+///     The m-by-n matrix C, stored in an ldc-by-n array [RowMajor: m-by-ldc].
+///
+/// @param[in] ldc
+///     Leading dimension of C.
+///
+/// @ingroup gemm
+
+template <int64_t M, int64_t N, int64_t K,
+          typename TA, typename TB, typename TC>
+inline void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    if (layout == Layout::RowMajor) {
+        // C^T = op(B)^T op(A)^T, in column-major
+        internal::gemm<N, M, K>(
+            transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc );
+    }
+    else {
+        internal::gemm<M, N, K>(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// General matrix-matrix multiply with all extents M, N, K fixed at
+/// compile time. See the version with run-time m, n, k above.
+///
+/// @ingroup gemm
+
+template <int64_t M, int64_t N, int64_t K,
+          typename TA, typename TB, typename TC>
+inline void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    static_assert( M != dynamic && N != dynamic && K != dynamic,
+                   "dynamic extents require the m, n, k arguments" );
+    gemm<M, N, K>( layout, transA, transB, M, N, K,
+                   alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace fixed
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_FIXED_HH
@@ -0,0 +1,271 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_FLOAT16_HH
+#define BLAS_FLOAT16_HH
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace blas {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Reinterprets the bits of x as type T, which must be the same size.
+/// Equivalent to C++20 std::bit_cast.
+template <typename T, typename S>
+inline T bit_cast( S const& x )
+{
+    static_assert( sizeof(T) == sizeof(S), "bit_cast requires equal sizes" );
+    T y;
+    std::memcpy( &y, &x, sizeof(T) );
+    return y;
+}
+
+//------------------------------------------------------------------------------
+/// Converts IEEE binary16 bits to float, exactly.
+/// Branch free, so loops of conversions vectorize.
+inline float half_bits_to_float( uint16_t h )
+{
+    uint32_t sign = uint32_t( h & 0x8000 ) << 16;
+    uint32_t em   = h & 0x7fff;  // exponent and mantissa
+    // Shifting aligns the mantissa; the multiply rebiases the exponent
+    // from 15 to 127, which also normalizes subnormals.
+    float f = bit_cast<float>( em << 13 ) * 0x1p+112f;
+    // Inf and NaN get the all-ones exponent, keeping the mantissa.
+    // A mask rather than a select keeps loops free of control flow.
+    uint32_t infnan = uint32_t( -int32_t( em >= 0x7c00 ) ) & 0x7f800000;
+    return bit_cast<float>( bit_cast<uint32_t>( f ) | infnan | sign );
+}
+
+//------------------------------------------------------------------------------
+/// Converts float to IEEE binary16 bits, rounding to nearest even.
+/// Overflow gives Inf; NaN gives a quiet NaN.
+inline uint16_t float_to_half_bits( float f )
+{
+    uint32_t u    = bit_cast<uint32_t>( f );
+    uint32_t sign = (u >> 16) & 0x8000;
+    u &= 0x7fffffff;
+
+    uint32_t h;
+    if (u >= 0x47800000) {
+        // >= 2^16, Inf, or NaN
+        h = (u > 0x7f800000 ? 0x7e00 : 0x7c00);
+    }
+    else if (u < 0x38800000) {
+        // < 2^-14, subnormal or zero in binary16: adding 0.5 puts
+        // the rounded half mantissa in the low bits of the float mantissa.
+        float t = bit_cast<float>( u ) + 0.5f;
+        h = bit_cast<uint32_t>( t ) - 0x3f000000;
+    }
+    else {
+        // normal: rebias exponent from 127 to 15, round to nearest even;
+        // a carry out of the mantissa correctly increments the exponent.
+        uint32_t odd = (u >> 13) & 1;
+        u += 0xc8000fff + odd;
+        h = u >> 13;
+    }
+    return uint16_t( h | sign );
+}
+
+//------------------------------------------------------------------------------
+/// Converts bfloat16 bits to float, exactly.
+inline float bfloat16_bits_to_float( uint16_t b )
+{
+    return bit_cast<float>( uint32_t( b ) << 16 );
+}
+
+//------------------------------------------------------------------------------
+/// Converts float to bfloat16 bits, rounding to nearest even.
+/// NaN gives a quiet NaN.
+inline uint16_t float_to_bfloat16_bits( float f )
+{
+    uint32_t u = bit_cast<uint32_t>( f );
+    if ((u & 0x7fffffff) > 0x7f800000)
+        return uint16_t( (u >> 16) | 0x0040 );
+    uint32_t odd = (u >> 16) & 1;
+    return uint16_t( (u + 0x7fff + odd) >> 16 );
+}
+
+}  // namespace internal
+
+//==============================================================================
+/// IEEE 754 half precision (binary16) storage type: 1 sign, 5 exponent,
+/// and 10 mantissa bits, with range about 6e-8 to 65504.
+///
+/// Arithmetic is done in float: float16 converts implicitly to float,
+/// and scalar_type and real_type of float16 are float. Assigning a float
+/// rounds to nearest even. This halves the memory of float matrices,
+/// e.g., for gemm< float16, float16, float16 >, which packs blocks into
+/// float and accumulates in float.
+///
+class float16
+{
+public:
+    float16() = default;
+
+    /// Converts from float, rounding to nearest even.
+    float16( float x ):
+        bits_( internal::float_to_half_bits( x ) )
+    {}
+
+    /// Converts from double via float, and from integer types.
+    template <typename T,
+              typename = std::enable_if_t< std::is_arithmetic<T>::value > >
+    float16( T x ):
+        float16( float( x ) )
+    {}
+
+    /// Converts to float, exactly.
+    operator float() const
+        { return internal::half_bits_to_float( bits_ ); }
+
+    /// @return float16 with the given bit pattern.
+    static float16 from_bits( uint16_t bits )
+    {
+        float16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    /// @return bit pattern.
+    uint16_t bits() const
+        { return bits_; }
+
+    float16& operator += ( float x ) { return *this = float( *this ) + x; }
+    float16& operator -= ( float x ) { return *this = float( *this ) - x; }
+    float16& operator *= ( float x ) { return *this = float( *this ) * x; }
+    float16& operator /= ( float x ) { return *this = float( *this ) / x; }
+
+private:
+    uint16_t bits_;
+};
+
+//==============================================================================
+/// bfloat16 ("brain" floating point) storage type: 1 sign, 8 exponent,
+/// and 7 mantissa bits, i.e., float with the low 16 mantissa bits dropped,
+/// so it has the range of float with about 3 decimal digits.
+///
+/// Arithmetic is done in float, as for float16.
+///
+class bfloat16
+{
+public:
+    bfloat16() = default;
+
+    /// Converts from float, rounding to nearest even.
+    bfloat16( float x ):
+        bits_( internal::float_to_bfloat16_bits( x ) )
+    {}
+
+    /// Converts from double via float, and from integer types.
+    template <typename T,
+              typename = std::enable_if_t< std::is_arithmetic<T>::value > >
+    bfloat16( T x ):
+        bfloat16( float( x ) )
+    {}
+
+    /// Converts to float, exactly.
+    operator float() const
+        { return internal::bfloat16_bits_to_float( bits_ ); }
+
+    /// @return bfloat16 with the given bit pattern.
+    static bfloat16 from_bits( uint16_t bits )
+    {
+        bfloat16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    /// @return bit pattern.
+    uint16_t bits() const
+        { return bits_; }
+
+    bfloat16& operator += ( float x ) { return *this = float( *this ) + x; }
+    bfloat16& operator -= ( float x ) { return *this = float( *this ) - x; }
+    bfloat16& operator *= ( float x ) { return *this = float( *this ) * x; }
+    bfloat16& operator /= ( float x ) { return *this = float( *this ) / x; }
+
+private:
+    uint16_t bits_;
+};
+
+//------------------------------------------------------------------------------
+/// True for the 16-bit floating point storage types, float16 and bfloat16,
+/// whose arithmetic is done in float.
+template <typename T>
+struct is_float16:
+    std::integral_constant<bool, false>
+{};
+
+template <>
+struct is_float16< float16 >:
+    std::integral_constant<bool, true>
+{};
+
+template <>
+struct is_float16< bfloat16 >:
+    std::integral_constant<bool, true>
+{};
+
+template <typename T>
+constexpr bool is_float16_v = is_float16<T>::value;
+
+}  // namespace blas
+
+//------------------------------------------------------------------------------
+// numeric_limits, used by testers and error checks.
+namespace std {
+
+template <>
+class numeric_limits< blas::float16 >
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed      = true;
+    static constexpr bool is_integer     = false;
+    static constexpr bool is_exact       = false;
+    static constexpr bool has_infinity   = true;
+    static constexpr bool has_quiet_NaN  = true;
+    static constexpr int  digits         = 11;
+    static constexpr int  radix          = 2;
+
+    static blas::float16 min()           { return blas::float16::from_bits( 0x0400 ); }
+    static blas::float16 max()           { return blas::float16::from_bits( 0x7bff ); }
+    static blas::float16 lowest()        { return blas::float16::from_bits( 0xfbff ); }
+    static blas::float16 epsilon()       { return blas::float16::from_bits( 0x1400 ); }
+    static blas::float16 infinity()      { return blas::float16::from_bits( 0x7c00 ); }
+    static blas::float16 quiet_NaN()     { return blas::float16::from_bits( 0x7e00 ); }
+    static blas::float16 denorm_min()    { return blas::float16::from_bits( 0x0001 ); }
+};
+
+template <>
+class numeric_limits< blas::bfloat16 >
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed      = true;
+    static constexpr bool is_integer     = false;
+    static constexpr bool is_exact       = false;
+    static constexpr bool has_infinity   = true;
+    static constexpr bool has_quiet_NaN  = true;
+    static constexpr int  digits         = 8;
+    static constexpr int  radix          = 2;
+
+    static blas::bfloat16 min()          { return blas::bfloat16::from_bits( 0x0080 ); }
+    static blas::bfloat16 max()          { return blas::bfloat16::from_bits( 0x7f7f ); }
+    static blas::bfloat16 lowest()       { return blas::bfloat16::from_bits( 0xff7f ); }
+    static blas::bfloat16 epsilon()      { return blas::bfloat16::from_bits( 0x3c00 ); }
+    static blas::bfloat16 infinity()     { return blas::bfloat16::from_bits( 0x7f80 ); }
+    static blas::bfloat16 quiet_NaN()    { return blas::bfloat16::from_bits( 0x7fc0 ); }
+    static blas::bfloat16 denorm_min()   { return blas::bfloat16::from_bits( 0x0001 ); }
+};
+
+}  // namespace std
+
+#endif        //  #ifndef BLAS_FLOAT16_HH
@@ -27,6 +27,37 @@ inline double fmuls_axpy( double n )
 inline double fadds_axpy( double n )
     { return n; }
 
+// -----------------------------------------------------------------------------
+inline double fmuls_axpby( double n )
+    { return 2*n; }
+
+inline double fadds_axpby( double n )
+    { return n; }
+
+// -----------------------------------------------------------------------------
+// axpy, then dot
+inline double fmuls_dot_axpy( double n )
+    { return 2*n; }
+
+inline double fadds_dot_axpy( double n )
+    { return 2*n - 1; }
+
+// -----------------------------------------------------------------------------
+// k axpy
+inline double fmuls_maxpy( double n, double k )
+    { return n*k; }
+
+inline double fadds_maxpy( double n, double k )
+    { return n*k; }
+
+// -----------------------------------------------------------------------------
+// k dot
+inline double fmuls_mdot( double n, double k )
+    { return n*k; }
+
+inline double fadds_mdot( double n, double k )
+    { return (n - 1)*k; }
+
 // -----------------------------------------------------------------------------
 inline double fmuls_iamax( double n )
     { return 0; }
@@ -63,6 +94,25 @@ inline double fmuls_rot( double n )
 inline double fadds_rot( double n )
     { return 2 * n; }
 
+// -----------------------------------------------------------------------------
+// k sequences of rotations of adjacent columns (Right) or rows (Left)
+// of an m-by-n matrix.
+inline double fmuls_rot_sequence( blas::Side side, double m, double n, double k )
+{
+    if (side == blas::Side::Left)
+        return k * max( m - 1, 0.0 ) * fmuls_rot( n );
+    else
+        return k * max( n - 1, 0.0 ) * fmuls_rot( m );
+}
+
+inline double fadds_rot_sequence( blas::Side side, double m, double n, double k )
+{
+    if (side == blas::Side::Left)
+        return k * max( m - 1, 0.0 ) * fadds_rot( n );
+    else
+        return k * max( n - 1, 0.0 ) * fadds_rot( m );
+}
+
 // -----------------------------------------------------------------------------
 inline double fmuls_rotm( double n )
     { return 2 * n; }
@@ -184,10 +234,30 @@ public:
     static double asum( double n )
         { return 1e-9 * (n * sizeof(T)); }
 
+    // read x, y; write y
+    static double axpby( double n )
+        { return 1e-9 * (3*n * sizeof(T)); }
+
     // read x, y; write y
     static double axpy( double n )
         { return 1e-9 * (3*n * sizeof(T)); }
 
+    // read x, y, z; write y
+    static double dot_axpy( double n )
+        { return 1e-9 * (4*n * sizeof(T)); }
+
+    // read X, y; write y
+    static double maxpy( double n, double k )
+        { return 1e-9 * ((n*k + 2*n) * sizeof(T)); }
+
+    // read X, y
+    static double mdot( double n, double k )
+        { return 1e-9 * ((n*k + n) * sizeof(T)); }
+
+    // read x, y; write w
+    static double waxpby( double n )
+        { return 1e-9 * (3*n * sizeof(T)); }
+
     // read x; write y
     static double copy( double n )
         { return 1e-9 * (2*n * sizeof(T)); }
@@ -204,6 +274,27 @@ public:
     static double dot( double n )
         { return 1e-9 * (2*n * sizeof(T)); }
 
+    // Sparse x with nz nonzeros and indices indx.
+    // read x, indx, y(indx); write y(indx)
+    static double axpyi( double nz )
+        { return 1e-9 * (nz * (3*sizeof(T) + sizeof(int64_t))); }
+
+    // read x, indx, y(indx)
+    static double doti( double nz )
+        { return 1e-9 * (nz * (2*sizeof(T) + sizeof(int64_t))); }
+
+    // read indx, y(indx); write x
+    static double gthr( double nz )
+        { return 1e-9 * (nz * (2*sizeof(T) + sizeof(int64_t))); }
+
+    // read indx, y(indx); write x, y(indx)
+    static double gthrz( double nz )
+        { return 1e-9 * (nz * (3*sizeof(T) + sizeof(int64_t))); }
+
+    // read x, indx; write y(indx)
+    static double sctr( double nz )
+        { return 1e-9 * (nz * (2*sizeof(T) + sizeof(int64_t))); }
+
     // read x; write x
     static double scal( double n )
         { return 1e-9 * (2*n * sizeof(T)); }
@@ -212,6 +303,14 @@ public:
     static double swap( double n )
         { return 1e-9 * (4*n * sizeof(T)); }
 
+    // read C, S; read A; write A
+    static double rot_sequence( blas::Side side, double m, double n, double k )
+    {
+        double nrot = (side == blas::Side::Left ? m - 1 : n - 1);
+        return 1e-9 * (k*nrot * (sizeof(real_type<T>) + sizeof(T))
+                       + 2*m*n * sizeof(T));
+    }
+
     // ----------------------------------------
     // Level 2 BLAS
     // read A, x; write y
@@ -260,6 +359,10 @@ public:
     static double gemm( double m, double n, double k )
         { return 1e-9 * ((m*k + k*n + 2*m*n) * sizeof(T)); }
 
+    // read A, B, triangle of C; write triangle of C
+    static double gemmt( double n, double k )
+        { return her2k( n, k ); }
+
     static double hemm( blas::Side side, double m, double n )
     {
         // read A, B, C; write C
@@ -342,10 +445,29 @@ public:
         { return 1e-9 * (mul_ops*fmuls_asum(n) +
                          add_ops*fadds_asum(n)); }
 
+    static double axpby( double n )
+        { return 1e-9 * (mul_ops*fmuls_axpby(n) +
+                         add_ops*fadds_axpby(n)); }
+
     static double axpy( double n )
         { return 1e-9 * (mul_ops*fmuls_axpy(n) +
                          add_ops*fadds_axpy(n)); }
 
+    static double dot_axpy( double n )
+        { return 1e-9 * (mul_ops*fmuls_dot_axpy(n) +
+                         add_ops*fadds_dot_axpy(n)); }
+
+    static double maxpy( double n, double k )
+        { return 1e-9 * (mul_ops*fmuls_maxpy(n, k) +
+                         add_ops*fadds_maxpy(n, k)); }
+
+    static double mdot( double n, double k )
+        { return 1e-9 * (mul_ops*fmuls_mdot(n, k) +
+                         add_ops*fadds_mdot(n, k)); }
+
+    static double waxpby( double n )
+        { return axpby( n ); }
+
     static double copy( double n )
         { return 0; }
 
@@ -372,6 +494,10 @@ public:
         { return 1e-9 * (mul_ops*fmuls_rot(n) +
                          add_ops*fadds_rot(n)); }
 
+    static double rot_sequence( blas::Side side, double m, double n, double k )
+        { return 1e-9 * (mul_ops*fmuls_rot_sequence(side, m, n, k) +
+                         add_ops*fadds_rot_sequence(side, m, n, k)); }
+
     static double rotm( double n )
         { return 1e-9 * (mul_ops*fmuls_rotm(n) +
                          add_ops*fadds_rotm(n)); }
@@ -417,6 +543,10 @@ public:
         { return 1e-9 * (mul_ops*fmuls_gemm(m, n, k) +
                          add_ops*fadds_gemm(m, n, k)); }
 
+    // triangle of C, same count as herk
+    static double gemmt(double n, double k)
+        { return herk( n, k ); }
+
     static double gbmm(double m, double n, double k, double kl, double ku)
         { return 1e-9 * (mul_ops*fmuls_gbmm(m, n, k, kl, ku) +
                          add_ops*fadds_gbmm(m, n, k, kl, ku)); }
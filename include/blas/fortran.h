@@ -971,6 +971,206 @@ void BLAS_zgemm_base(
     #define BLAS_zgemm( ... ) BLAS_zgemm_base( __VA_ARGS__ )
 #endif
 
+// -----------------------------------------------------------------------------
+// gemm3m is an extension in MKL and OpenBLAS, not in reference BLAS;
+// see config/blas_gemm3m.cc.
+#define BLAS_cgemm3m_base BLAS_FORTRAN_NAME( cgemm3m, CGEMM3M )
+void BLAS_cgemm3m_base(
+    char const *transA, char const *transB,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    blas_complex_float const *alpha,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float const *B, blas_int const *ldb,
+    blas_complex_float const *beta,
+    blas_complex_float       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#define BLAS_zgemm3m_base BLAS_FORTRAN_NAME( zgemm3m, ZGEMM3M )
+void BLAS_zgemm3m_base(
+    char const *transA, char const *transB,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    blas_complex_double const *alpha,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double const *B, blas_int const *ldb,
+    blas_complex_double const *beta,
+    blas_complex_double       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#ifdef BLAS_FORTRAN_STRLEN_END
+    // Pass 1 for string lengths.
+    #define BLAS_cgemm3m( ... ) BLAS_cgemm3m_base( __VA_ARGS__, 1, 1 )
+    #define BLAS_zgemm3m( ... ) BLAS_zgemm3m_base( __VA_ARGS__, 1, 1 )
+#else
+    #define BLAS_cgemm3m( ... ) BLAS_cgemm3m_base( __VA_ARGS__ )
+    #define BLAS_zgemm3m( ... ) BLAS_zgemm3m_base( __VA_ARGS__ )
+#endif
+
+// -----------------------------------------------------------------------------
+// gemm_pack and gemm_compute are extensions in MKL, for float and double;
+// see src/gemm_pack.cc.
+#define BLAS_sgemm_pack_get_size_base BLAS_FORTRAN_NAME( sgemm_pack_get_size, SGEMM_PACK_GET_SIZE )
+size_t BLAS_sgemm_pack_get_size_base(
+    char const *identifier,
+    blas_int const *m, blas_int const *n, blas_int const *k
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t identifier_len
+    #endif
+    );
+
+#define BLAS_dgemm_pack_get_size_base BLAS_FORTRAN_NAME( dgemm_pack_get_size, DGEMM_PACK_GET_SIZE )
+size_t BLAS_dgemm_pack_get_size_base(
+    char const *identifier,
+    blas_int const *m, blas_int const *n, blas_int const *k
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t identifier_len
+    #endif
+    );
+
+#define BLAS_sgemm_pack_base BLAS_FORTRAN_NAME( sgemm_pack, SGEMM_PACK )
+void BLAS_sgemm_pack_base(
+    char const *identifier, char const *trans,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    float const *alpha,
+    float const *src, blas_int const *ld,
+    float       *dest
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t identifier_len, size_t trans_len
+    #endif
+    );
+
+#define BLAS_dgemm_pack_base BLAS_FORTRAN_NAME( dgemm_pack, DGEMM_PACK )
+void BLAS_dgemm_pack_base(
+    char const *identifier, char const *trans,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    double const *alpha,
+    double const *src, blas_int const *ld,
+    double       *dest
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t identifier_len, size_t trans_len
+    #endif
+    );
+
+#define BLAS_sgemm_compute_base BLAS_FORTRAN_NAME( sgemm_compute, SGEMM_COMPUTE )
+void BLAS_sgemm_compute_base(
+    char const *transA, char const *transB,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    float const *A, blas_int const *lda,
+    float const *B, blas_int const *ldb,
+    float const *beta,
+    float       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#define BLAS_dgemm_compute_base BLAS_FORTRAN_NAME( dgemm_compute, DGEMM_COMPUTE )
+void BLAS_dgemm_compute_base(
+    char const *transA, char const *transB,
+    blas_int const *m, blas_int const *n, blas_int const *k,
+    double const *A, blas_int const *lda,
+    double const *B, blas_int const *ldb,
+    double const *beta,
+    double       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#ifdef BLAS_FORTRAN_STRLEN_END
+    // Pass 1 for string lengths.
+    #define BLAS_sgemm_pack_get_size( ... ) BLAS_sgemm_pack_get_size_base( __VA_ARGS__, 1 )
+    #define BLAS_dgemm_pack_get_size( ... ) BLAS_dgemm_pack_get_size_base( __VA_ARGS__, 1 )
+    #define BLAS_sgemm_pack( ... ) BLAS_sgemm_pack_base( __VA_ARGS__, 1, 1 )
+    #define BLAS_dgemm_pack( ... ) BLAS_dgemm_pack_base( __VA_ARGS__, 1, 1 )
+    #define BLAS_sgemm_compute( ... ) BLAS_sgemm_compute_base( __VA_ARGS__, 1, 1 )
+    #define BLAS_dgemm_compute( ... ) BLAS_dgemm_compute_base( __VA_ARGS__, 1, 1 )
+#else
+    #define BLAS_sgemm_pack_get_size( ... ) BLAS_sgemm_pack_get_size_base( __VA_ARGS__ )
+    #define BLAS_dgemm_pack_get_size( ... ) BLAS_dgemm_pack_get_size_base( __VA_ARGS__ )
+    #define BLAS_sgemm_pack( ... ) BLAS_sgemm_pack_base( __VA_ARGS__ )
+    #define BLAS_dgemm_pack( ... ) BLAS_dgemm_pack_base( __VA_ARGS__ )
+    #define BLAS_sgemm_compute( ... ) BLAS_sgemm_compute_base( __VA_ARGS__ )
+    #define BLAS_dgemm_compute( ... ) BLAS_dgemm_compute_base( __VA_ARGS__ )
+#endif
+
+// -----------------------------------------------------------------------------
+// gemmt is an extension in MKL, BLIS, and OpenBLAS >= 0.3.22,
+// not in reference BLAS; see config/blas_gemmt.cc.
+#define BLAS_sgemmt_base BLAS_FORTRAN_NAME( sgemmt, SGEMMT )
+void BLAS_sgemmt_base(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    float const *alpha,
+    float const *A, blas_int const *lda,
+    float const *B, blas_int const *ldb,
+    float const *beta,
+    float       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t uplo_len, size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#define BLAS_dgemmt_base BLAS_FORTRAN_NAME( dgemmt, DGEMMT )
+void BLAS_dgemmt_base(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    double const *alpha,
+    double const *A, blas_int const *lda,
+    double const *B, blas_int const *ldb,
+    double const *beta,
+    double       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t uplo_len, size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#define BLAS_cgemmt_base BLAS_FORTRAN_NAME( cgemmt, CGEMMT )
+void BLAS_cgemmt_base(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    blas_complex_float const *alpha,
+    blas_complex_float const *A, blas_int const *lda,
+    blas_complex_float const *B, blas_int const *ldb,
+    blas_complex_float const *beta,
+    blas_complex_float       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t uplo_len, size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#define BLAS_zgemmt_base BLAS_FORTRAN_NAME( zgemmt, ZGEMMT )
+void BLAS_zgemmt_base(
+    char const *uplo, char const *transA, char const *transB,
+    blas_int const *n, blas_int const *k,
+    blas_complex_double const *alpha,
+    blas_complex_double const *A, blas_int const *lda,
+    blas_complex_double const *B, blas_int const *ldb,
+    blas_complex_double const *beta,
+    blas_complex_double       *C, blas_int const *ldc
+    #ifdef BLAS_FORTRAN_STRLEN_END
+    , size_t uplo_len, size_t transA_len, size_t transB_len
+    #endif
+    );
+
+#ifdef BLAS_FORTRAN_STRLEN_END
+    // Pass 1 for string lengths.
+    #define BLAS_sgemmt( ... ) BLAS_sgemmt_base( __VA_ARGS__, 1, 1, 1 )
+    #define BLAS_dgemmt( ... ) BLAS_dgemmt_base( __VA_ARGS__, 1, 1, 1 )
+    #define BLAS_cgemmt( ... ) BLAS_cgemmt_base( __VA_ARGS__, 1, 1, 1 )
+    #define BLAS_zgemmt( ... ) BLAS_zgemmt_base( __VA_ARGS__, 1, 1, 1 )
+#else
+    #define BLAS_sgemmt( ... ) BLAS_sgemmt_base( __VA_ARGS__ )
+    #define BLAS_dgemmt( ... ) BLAS_dgemmt_base( __VA_ARGS__ )
+    #define BLAS_cgemmt( ... ) BLAS_cgemmt_base( __VA_ARGS__ )
+    #define BLAS_zgemmt( ... ) BLAS_zgemmt_base( __VA_ARGS__ )
+#endif
+
 // -----------------------------------------------------------------------------
 #define BLAS_ssymm_base BLAS_FORTRAN_NAME( ssymm, SSYMM )
 void BLAS_ssymm_base(
@@ -7,11 +7,150 @@
 #define BLAS_GEMM_HH
 
 #include "blas/util.hh"
+#include "blas/gemm_blocked.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unblocked gemm, C = alpha op(A) op(B) + beta C, for column-major matrices,
+/// using simple loop nests. Used by gemm for small problems,
+/// where packing in gemm_blocked does not pay off.
+///
+/// Arguments are as for gemm, with layout ColMajor. Arguments are
+/// assumed to be valid, m, n, k > 0, and alpha != 0; gemm does the checks.
+/// @ingroup gemm_internal
+template <typename TA, typename TB, typename TC>
+void gemm_loops(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // constants
+    const scalar_t zero = 0;
+
+    if (transA == Op::NoTrans) {
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Blj = alpha*B(l, j);
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += A(i, l)*alpha_Blj;
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Bjl = alpha*B(j, l);
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += A(i, l)*alpha_Bjl;
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i)
+                    C(i, j) *= beta;
+                for (int64_t l = 0; l < k; ++l) {
+                    scalar_t alpha_Bjl = alpha*conj(B(j, l));
+                    for (int64_t i = 0; i < m; ++i)
+                        C(i, j) += A(i, l)*alpha_Bjl;
+                }
+            }
+        }
+    }
+    else if (transA == Op::Trans) {
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(l, i)*B(l, j);
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(l, i)*B(j, l);
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(l, i)*conj(B(j, l));
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+    }
+    else { // transA == Op::ConjTrans
+        if (transB == Op::NoTrans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += conj(A(l, i))*B(l, j);
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += conj(A(l, i))*B(j, l);
+                    C(i, j) = alpha*sum + beta*C(i, j);
+                }
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    scalar_t sum = zero;
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(l, i)*B(j, l); // little improvement here
+                    C(i, j) = alpha*conj(sum) + beta*C(i, j);
+                }
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+    #undef C
+}
+
+}  // namespace internal
+
 // =============================================================================
 /// General matrix-matrix multiply:
 /// \[
@@ -25,6 +164,7 @@ namespace blas {
 /// $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -99,8 +239,10 @@ void gemm(
     TC       *C, int64_t ldc )
 {
     // redirect if row major
+    // explicit template arguments keep this in the generic template,
+    // rather than resolving to a vendor BLAS overload
     if (layout == Layout::RowMajor) {
-        return gemm(
+        return gemm<TB, TA, TC>(
              Layout::ColMajor,
              transB,
              transA,
@@ -164,104 +306,39 @@ void gemm(
     }
 
     // alpha != zero
-    if (transA == Op::NoTrans) {
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Blj = alpha*B(l, j);
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Blj;
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Bjl = alpha*B(j, l);
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Bjl;
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i)
-                    C(i, j) *= beta;
-                for (int64_t l = 0; l < k; ++l) {
-                    scalar_t alpha_Bjl = alpha*conj(B(j, l));
-                    for (int64_t i = 0; i < m; ++i)
-                        C(i, j) += A(i, l)*alpha_Bjl;
-                }
-            }
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    if (nthreads > 1) {
+        // 2-D partition of C into one tile per thread. Tiles are serial,
+        // since nested calls are inside the OpenMP parallel region.
+        int64_t mt, nt;
+        internal::parallel_grid( nthreads, m, n, &mt, &nt );
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int64_t ij = 0; ij < mt*nt; ++ij) {
+            int64_t i0 = internal::parallel_part( m, mt, ij % mt     );
+            int64_t i1 = internal::parallel_part( m, mt, ij % mt + 1 );
+            int64_t j0 = internal::parallel_part( n, nt, ij / mt     );
+            int64_t j1 = internal::parallel_part( n, nt, ij / mt + 1 );
+            TA const* Ai = (transA == Op::NoTrans ? &A(i0, 0) : &A(0, i0));
+            TB const* Bj = (transB == Op::NoTrans ? &B(0, j0) : &B(j0, 0));
+            gemm<TA, TB, TC>( Layout::ColMajor, transA, transB,
+                              i1 - i0, j1 - j0, k,
+                              alpha, Ai, lda, Bj, ldb, beta, &C(i0, j0), ldc );
         }
     }
-    else if (transA == Op::Trans) {
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(l, j);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(j, l);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*conj(B(j, l));
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
+    else if (internal::gemm_use_blocked<scalar_t>( m, n, k )
+             || ! std::is_same< TC, scalar_t >::value
+             || get_reproducible()) {
+        // The loops accumulate in C, so if C is narrower than scalar_t
+        // (e.g., float16), use the blocked engine, which accumulates in scalar_t.
+        // In reproducible mode, always use the blocked engine, so the order
+        // of sums doesn't depend on the tile sizes of the parallel partition.
+        internal::gemm_blocked( transA, transB, m, n, k,
+                                alpha, A, lda, B, ldb, beta, C, ldc );
     }
-    else { // transA == Op::ConjTrans
-        if (transB == Op::NoTrans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += conj(A(l, i))*B(l, j);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else if (transB == Op::Trans) {
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += conj(A(l, i))*B(j, l);
-                    C(i, j) = alpha*sum + beta*C(i, j);
-                }
-            }
-        }
-        else { // transB == Op::ConjTrans
-            for (int64_t j = 0; j < n; ++j) {
-                for (int64_t i = 0; i < m; ++i) {
-                    scalar_t sum = zero;
-                    for (int64_t l = 0; l < k; ++l)
-                        sum += A(l, i)*B(j, l); // little improvement here
-                    C(i, j) = alpha*conj(sum) + beta*C(i, j);
-                }
-            }
-        }
+    else {
+        internal::gemm_loops( transA, transB, m, n, k,
+                              alpha, A, lda, B, ldb, beta, C, ldc );
     }
 
     #undef A
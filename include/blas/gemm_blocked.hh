@@ -0,0 +1,524 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMM_BLOCKED_HH
+#define BLAS_GEMM_BLOCKED_HH
+
+#include "blas/util.hh"
+
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block sizes for the blocked, packing gemm engine.
+///
+/// - mr-by-nr is the register tile computed by the micro-kernel.
+/// - mc-by-kc is the packed panel of op(A), sized to stay in L2 cache.
+/// - kc-by-nr is a sliver of the packed panel of op(B), sized for L1 cache.
+/// - kc-by-nc is the packed panel of op(B), sized for L3 cache.
+///
+/// mc must be a multiple of mr, and nc a multiple of nr.
+/// The default 2 x 2 tile suits arbitrary types such as long double
+/// or user-defined scalars, whose arithmetic isn't vectorized and which
+/// quickly exhaust registers; specialize this template to tune a type.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+struct gemm_blocking {
+    static constexpr int64_t mr = 2;
+    static constexpr int64_t nr = 2;
+    static constexpr int64_t mc = 64;
+    static constexpr int64_t kc = 256;
+    static constexpr int64_t nc = 2048;
+};
+
+/// float: 16 x 4 tile holds 64 accumulators; A panel is 128 KiB.
+template <>
+struct gemm_blocking< float > {
+    static constexpr int64_t mr = 16;
+    static constexpr int64_t nr = 4;
+    static constexpr int64_t mc = 128;
+    static constexpr int64_t kc = 256;
+    static constexpr int64_t nc = 4096;
+};
+
+/// double: 8 x 4 tile holds 32 accumulators; A panel is 192 KiB.
+template <>
+struct gemm_blocking< double > {
+    static constexpr int64_t mr = 8;
+    static constexpr int64_t nr = 4;
+    static constexpr int64_t mc = 96;
+    static constexpr int64_t kc = 256;
+    static constexpr int64_t nc = 4096;
+};
+
+/// complex<float>: 4 x 4 tile; A panel is 128 KiB.
+template <>
+struct gemm_blocking< std::complex<float> > {
+    static constexpr int64_t mr = 4;
+    static constexpr int64_t nr = 4;
+    static constexpr int64_t mc = 128;
+    static constexpr int64_t kc = 128;
+    static constexpr int64_t nc = 2048;
+};
+
+/// complex<double>: 4 x 2 tile; A panel is 192 KiB.
+template <>
+struct gemm_blocking< std::complex<double> > {
+    static constexpr int64_t mr = 4;
+    static constexpr int64_t nr = 2;
+    static constexpr int64_t mc = 96;
+    static constexpr int64_t kc = 128;
+    static constexpr int64_t nc = 2048;
+};
+
+//------------------------------------------------------------------------------
+/// Returns true if an m-by-n-by-k product is large enough that packing
+/// pays for itself, so gemm should use gemm_blocked instead of gemm_loops.
+/// Each dimension must fill at least a register tile; otherwise the
+/// zero padding in the micro-kernel wastes most of its work.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+inline bool gemm_use_blocked( int64_t m, int64_t n, int64_t k )
+{
+    using blocking = gemm_blocking< scalar_t >;
+    return m >= blocking::mr
+        && n >= blocking::nr
+        && k >= 8
+        && m*n*k >= 32*32*32;
+}
+
+//------------------------------------------------------------------------------
+/// Packs the mc-by-kc block of op(A) into Ap, converting to scalar_t and
+/// conjugating if needed. Ap is stored as ceil( mc / mr ) micro-panels,
+/// each mr-by-kc with rows contiguous for each column, i.e.,
+/// Ap[ i + p*mr ] = op(A)( i, p ) within a micro-panel.
+/// Rows past mc in the last micro-panel are padded with zeros.
+///
+/// @param[in] transA
+///     The operation op(A): Op::NoTrans, Op::Trans, or Op::ConjTrans.
+///
+/// @param[in] mc
+///     Number of rows of the block of op(A).
+///
+/// @param[in] kc
+///     Number of columns of the block of op(A).
+///
+/// @param[in] A
+///     Pointer to the first element of the block, i.e., op(A)(0, 0).
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///
+/// @param[out] Ap
+///     Packed panel, of length ceil( mc / mr ) * mr * kc.
+///
+/// @ingroup gemm_internal
+template <typename TA, typename scalar_t>
+void gemm_pack_a(
+    blas::Op transA,
+    int64_t mc, int64_t kc,
+    TA const* A, int64_t lda,
+    scalar_t* Ap )
+{
+    constexpr int64_t mr = gemm_blocking< scalar_t >::mr;
+    const scalar_t zero = 0;
+
+    for (int64_t i0 = 0; i0 < mc; i0 += mr) {
+        int64_t ib = min( mr, mc - i0 );
+        if (transA == Op::NoTrans) {
+            for (int64_t p = 0; p < kc; ++p) {
+                TA const* Ap_col = &A[ i0 + p*lda ];
+                for (int64_t i = 0; i < ib; ++i)
+                    Ap[ i ] = scalar_t( Ap_col[ i ] );
+                for (int64_t i = ib; i < mr; ++i)
+                    Ap[ i ] = zero;
+                Ap += mr;
+            }
+        }
+        else if (transA == Op::Trans) {
+            for (int64_t p = 0; p < kc; ++p) {
+                for (int64_t i = 0; i < ib; ++i)
+                    Ap[ i ] = scalar_t( A[ p + (i0 + i)*lda ] );
+                for (int64_t i = ib; i < mr; ++i)
+                    Ap[ i ] = zero;
+                Ap += mr;
+            }
+        }
+        else { // transA == Op::ConjTrans
+            for (int64_t p = 0; p < kc; ++p) {
+                for (int64_t i = 0; i < ib; ++i)
+                    Ap[ i ] = scalar_t( conj( A[ p + (i0 + i)*lda ] ) );
+                for (int64_t i = ib; i < mr; ++i)
+                    Ap[ i ] = zero;
+                Ap += mr;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Packs the kc-by-nc block of op(B) into Bp, converting to scalar_t and
+/// conjugating if needed. Bp is stored as ceil( nc / nr ) micro-panels,
+/// each kc-by-nr with columns contiguous for each row, i.e.,
+/// Bp[ j + p*nr ] = op(B)( p, j ) within a micro-panel.
+/// Columns past nc in the last micro-panel are padded with zeros.
+///
+/// @param[in] transB
+///     The operation op(B): Op::NoTrans, Op::Trans, or Op::ConjTrans.
+///
+/// @param[in] kc
+///     Number of rows of the block of op(B).
+///
+/// @param[in] nc
+///     Number of columns of the block of op(B).
+///
+/// @param[in] B
+///     Pointer to the first element of the block, i.e., op(B)(0, 0).
+///
+/// @param[in] ldb
+///     Leading dimension of B.
+///
+/// @param[out] Bp
+///     Packed panel, of length ceil( nc / nr ) * nr * kc.
+///
+/// @ingroup gemm_internal
+template <typename TB, typename scalar_t>
+void gemm_pack_b(
+    blas::Op transB,
+    int64_t kc, int64_t nc,
+    TB const* B, int64_t ldb,
+    scalar_t* Bp )
+{
+    constexpr int64_t nr = gemm_blocking< scalar_t >::nr;
+    const scalar_t zero = 0;
+
+    for (int64_t j0 = 0; j0 < nc; j0 += nr) {
+        int64_t jb = min( nr, nc - j0 );
+        if (transB == Op::NoTrans) {
+            for (int64_t p = 0; p < kc; ++p) {
+                for (int64_t j = 0; j < jb; ++j)
+                    Bp[ j ] = scalar_t( B[ p + (j0 + j)*ldb ] );
+                for (int64_t j = jb; j < nr; ++j)
+                    Bp[ j ] = zero;
+                Bp += nr;
+            }
+        }
+        else if (transB == Op::Trans) {
+            for (int64_t p = 0; p < kc; ++p) {
+                TB const* Bp_row = &B[ j0 + p*ldb ];
+                for (int64_t j = 0; j < jb; ++j)
+                    Bp[ j ] = scalar_t( Bp_row[ j ] );
+                for (int64_t j = jb; j < nr; ++j)
+                    Bp[ j ] = zero;
+                Bp += nr;
+            }
+        }
+        else { // transB == Op::ConjTrans
+            for (int64_t p = 0; p < kc; ++p) {
+                TB const* Bp_row = &B[ j0 + p*ldb ];
+                for (int64_t j = 0; j < jb; ++j)
+                    Bp[ j ] = scalar_t( conj( Bp_row[ j ] ) );
+                for (int64_t j = jb; j < nr; ++j)
+                    Bp[ j ] = zero;
+                Bp += nr;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Micro-kernel computes the mr-by-nr tile AB = Ap * Bp,
+/// where Ap is an mr-by-kc micro-panel and Bp a kc-by-nr micro-panel,
+/// both packed by gemm_pack_a and gemm_pack_b.
+/// The extents are compile-time constants, so the compiler fully unrolls
+/// the j and i loops, holds AB in registers, and vectorizes over i.
+///
+/// @param[in] kc
+///     Inner dimension.
+///
+/// @param[in] Ap
+///     Packed micro-panel of op(A), of length mr*kc.
+///
+/// @param[in] Bp
+///     Packed micro-panel of op(B), of length kc*nr.
+///
+/// @param[out] AB
+///     The mr-by-nr product, stored column-wise in an array of length mr*nr.
+///
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void gemm_micro_kernel(
+    int64_t kc,
+    scalar_t const* Ap,
+    scalar_t const* Bp,
+    scalar_t* AB )
+{
+    constexpr int64_t mr = gemm_blocking< scalar_t >::mr;
+    constexpr int64_t nr = gemm_blocking< scalar_t >::nr;
+
+    scalar_t ab[ nr ][ mr ];
+    for (int64_t j = 0; j < nr; ++j)
+        for (int64_t i = 0; i < mr; ++i)
+            ab[ j ][ i ] = scalar_t( 0 );
+
+    scalar_t a[ mr ];
+    for (int64_t p = 0; p < kc; ++p) {
+        for (int64_t i = 0; i < mr; ++i)
+            a[ i ] = Ap[ i ];
+        for (int64_t j = 0; j < nr; ++j) {
+            scalar_t b_j = Bp[ j ];
+            #pragma omp simd
+            for (int64_t i = 0; i < mr; ++i)
+                ab[ j ][ i ] += a[ i ] * b_j;
+        }
+        Ap += mr;
+        Bp += nr;
+    }
+
+    for (int64_t j = 0; j < nr; ++j)
+        for (int64_t i = 0; i < mr; ++i)
+            AB[ i + j*mr ] = ab[ j ][ i ];
+}
+
+//------------------------------------------------------------------------------
+/// Micro-kernel called by gemm_macro_kernel. For most types, this is the
+/// inline gemm_micro_kernel, compiled for the application's instruction set.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+inline void gemm_micro_kernel_simd(
+    int64_t kc,
+    scalar_t const* Ap,
+    scalar_t const* Bp,
+    scalar_t* AB )
+{
+    gemm_micro_kernel( kc, Ap, Bp, AB );
+}
+
+/// For float and double, the micro-kernel is compiled in the library in
+/// variants for several instruction sets, selected at runtime, so
+/// mixed-precision gemm uses wide vectors and FMA even if the application
+/// is compiled for a baseline instruction set. See set_simd_isa.
+/// Complex types stay inline: their multiply calls the runtime's
+/// NaN-checking complex multiply, which wider vectors don't speed up.
+void gemm_micro_kernel_simd(
+    int64_t kc, float const* Ap, float const* Bp, float* AB );
+
+void gemm_micro_kernel_simd(
+    int64_t kc, double const* Ap, double const* Bp, double* AB );
+
+//------------------------------------------------------------------------------
+/// Epilogue for plain gemm, which does nothing.
+/// gemm_epilogue_op in gemm_epilogue.hh defines the interface.
+/// @ingroup gemm_internal
+struct gemm_no_epilogue {
+    static constexpr bool active = false;
+
+    gemm_no_epilogue shift( int64_t, int64_t ) const
+    {
+        return *this;
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Updates the mb-by-nb tile C = alpha AB + beta C, where AB is an
+/// mr-by-nr tile from the micro-kernel and mb <= mr, nb <= nr.
+/// If beta is zero, C is not read, so it need not be set on input.
+///
+/// With an active epilogue, alpha is scaled by ep.scale( i, j ), and if
+/// this is the last block of k, ep.finish( i, j, c ) is applied to
+/// each element before it is stored, while the tile is in cache.
+/// @ingroup gemm_internal
+template <typename TC, typename scalar_t, typename Epilogue>
+void gemm_store_tile(
+    int64_t mb, int64_t nb,
+    scalar_t alpha,
+    scalar_t const* AB,
+    scalar_t beta,
+    TC* C, int64_t ldc,
+    Epilogue const& ep, bool last )
+{
+    constexpr int64_t mr = gemm_blocking< scalar_t >::mr;
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    if constexpr (Epilogue::active) {
+        for (int64_t j = 0; j < nb; ++j) {
+            for (int64_t i = 0; i < mb; ++i) {
+                scalar_t c = ep.scale( i, j ) * alpha * AB[ i + j*mr ];
+                if (beta != zero)
+                    c += beta * scalar_t( C[ i + j*ldc ] );
+                if (last)
+                    c = ep.finish( i, j, c );
+                C[ i + j*ldc ] = TC( c );
+            }
+        }
+    }
+    else if (beta == zero) {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = alpha*AB[ i + j*mr ];
+    }
+    else if (beta == one) {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] += alpha*AB[ i + j*mr ];
+    }
+    else {
+        for (int64_t j = 0; j < nb; ++j)
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = alpha*AB[ i + j*mr ] + beta*C[ i + j*ldc ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Macro-kernel computes the mc-by-nc block C = alpha Ap Bp + beta C,
+/// where Ap is the packed mc-by-kc panel of op(A), which stays in L2 cache,
+/// and Bp is the packed kc-by-nc panel of op(B). Each kc-by-nr sliver of Bp
+/// stays in L1 cache while the micro-kernel sweeps down Ap.
+/// The epilogue ep is relative to this block; last is true for the
+/// last block of k. See gemm_store_tile.
+/// @ingroup gemm_internal
+template <typename TC, typename scalar_t, typename Epilogue>
+void gemm_macro_kernel(
+    int64_t mc, int64_t nc, int64_t kc,
+    scalar_t alpha,
+    scalar_t const* Ap,
+    scalar_t const* Bp,
+    scalar_t beta,
+    TC* C, int64_t ldc,
+    Epilogue const& ep, bool last )
+{
+    constexpr int64_t mr = gemm_blocking< scalar_t >::mr;
+    constexpr int64_t nr = gemm_blocking< scalar_t >::nr;
+
+    scalar_t AB[ mr*nr ];
+    for (int64_t jr = 0; jr < nc; jr += nr) {
+        int64_t nb = min( nr, nc - jr );
+        for (int64_t ir = 0; ir < mc; ir += mr) {
+            int64_t mb = min( mr, mc - ir );
+            gemm_micro_kernel_simd( kc, &Ap[ ir*kc ], &Bp[ jr*kc ], AB );
+            gemm_store_tile( mb, nb, alpha, AB, beta, &C[ ir + jr*ldc ], ldc,
+                             ep.shift( ir, jr ), last );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Blocked gemm engine, in the style of GotoBLAS and BLIS:
+/// C = alpha op(A) op(B) + beta C, for column-major matrices.
+/// Panels of op(A) and op(B) are packed, converting to the scalar type,
+/// into contiguous buffers sized by gemm_blocking, then multiplied by
+/// the macro- and micro-kernels.
+///
+/// Arguments are as for gemm, with layout ColMajor. Arguments are
+/// assumed to be valid and m, n, k > 0; gemm does the checks.
+/// If beta is zero, C need not be set on input.
+/// The optional epilogue ep is fused into the update of C;
+/// see gemm_store_tile and gemm_epilogue.
+/// @ingroup gemm_internal
+template <typename TA, typename TB, typename TC,
+          typename Epilogue = gemm_no_epilogue>
+void gemm_blocked(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc,
+    Epilogue const& ep = Epilogue() )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+    using blocking = gemm_blocking< scalar_t >;
+    constexpr int64_t mr = blocking::mr;
+    constexpr int64_t nr = blocking::nr;
+    constexpr int64_t mc = blocking::mc;
+    constexpr int64_t kc = blocking::kc;
+    constexpr int64_t nc = blocking::nc;
+    static_assert( mc % mr == 0, "mc must be a multiple of mr" );
+    static_assert( nc % nr == 0, "nc must be a multiple of nr" );
+
+    const scalar_t one = 1;
+
+    if constexpr (! std::is_same< TC, scalar_t >::value) {
+        if (k > kc) {
+            const scalar_t zero = 0;
+
+            // C is stored in a narrower type than scalar_t, e.g., float16.
+            // Accumulate a block of columns of C in a scalar_t workspace W,
+            // so C is rounded once instead of after each block of k.
+            int64_t nw = max( nr, min( n, int64_t( 1 << 20 ) / m ) );
+            std::vector<scalar_t> W( m * nw );
+            for (int64_t j0 = 0; j0 < n; j0 += nw) {
+                int64_t jb = min( nw, n - j0 );
+                for (int64_t j = 0; j < jb; ++j) {
+                    for (int64_t i = 0; i < m; ++i) {
+                        W[ i + j*m ] = (beta == zero
+                                        ? zero
+                                        : beta * scalar_t( C[ i + (j0 + j)*ldc ] ));
+                    }
+                }
+                TB const* Bj = (transB == Op::NoTrans
+                                ? &B[ j0*ldb ]
+                                : &B[ j0 ]);
+                gemm_blocked<TA, TB, scalar_t>(
+                    transA, transB, m, jb, k,
+                    alpha, A, lda, Bj, ldb, one, W.data(), m,
+                    ep.shift( 0, j0 ) );
+                for (int64_t j = 0; j < jb; ++j) {
+                    for (int64_t i = 0; i < m; ++i)
+                        C[ i + (j0 + j)*ldc ] = TC( W[ i + j*m ] );
+                }
+            }
+            return;
+        }
+    }
+
+    // workspace, sized for this problem if it is smaller than the blocks
+    int64_t kc_max = min( kc, k );
+    int64_t mc_max = min( mc, ((m + mr - 1) / mr) * mr );
+    int64_t nc_max = min( nc, ((n + nr - 1) / nr) * nr );
+    std::vector<scalar_t> Ap( mc_max * kc_max );
+    std::vector<scalar_t> Bp( kc_max * nc_max );
+
+    for (int64_t jc = 0; jc < n; jc += nc) {
+        int64_t nb = min( nc, n - jc );
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            int64_t kb = min( kc, k - pc );
+
+            // beta applies only to the first block of k
+            scalar_t beta_pc = (pc == 0 ? beta : one);
+
+            // pack op(B)( pc : pc+kb, jc : jc+nb )
+            TB const* Bpc = (transB == Op::NoTrans
+                             ? &B[ pc + jc*ldb ]
+                             : &B[ jc + pc*ldb ]);
+            gemm_pack_b( transB, kb, nb, Bpc, ldb, Bp.data() );
+
+            for (int64_t ic = 0; ic < m; ic += mc) {
+                int64_t mb = min( mc, m - ic );
+
+                // pack op(A)( ic : ic+mb, pc : pc+kb )
+                TA const* Aic = (transA == Op::NoTrans
+                                 ? &A[ ic + pc*lda ]
+                                 : &A[ pc + ic*lda ]);
+                gemm_pack_a( transA, mb, kb, Aic, lda, Ap.data() );
+
+                gemm_macro_kernel( mb, nb, kb, alpha, Ap.data(), Bp.data(),
+                                   beta_pc, &C[ ic + jc*ldc ], ldc,
+                                   ep.shift( ic, jc ), pc + kb == k );
+            }
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMM_BLOCKED_HH
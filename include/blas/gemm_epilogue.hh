@@ -0,0 +1,480 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMM_EPILOGUE_HH
+#define BLAS_GEMM_EPILOGUE_HH
+
+#include "blas/util.hh"
+#include "blas/wrappers.hh"
+#include "blas/gemm_blocked.hh"
+#include "blas/parallel.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace blas {
+
+//------------------------------------------------------------------------------
+/// Elementwise activation functions for gemm_epilogue.
+/// All but None require a real data type.
+enum class Activation : char {
+    None    = 'N',  ///< f(x) = x
+    ReLU    = 'R',  ///< f(x) = max( x, 0 )
+    Clamp   = 'C',  ///< f(x) = min( max( x, lower ), upper )
+    Sigmoid = 'S',  ///< f(x) = 1 / (1 + exp( -x ))
+    Tanh    = 'T',  ///< f(x) = tanh( x )
+    GELU    = 'G',  ///< f(x) = x (1 + erf( x / sqrt( 2 ) )) / 2
+};
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Epilogue for gemm_epilogue, fused into the update of C by gemm_blocked.
+/// Each of the vectors may be null, meaning no scaling or bias.
+/// Indices are relative to the tile of C that the epilogue was shifted to.
+/// @ingroup gemm_internal
+template <typename scalar_t, typename Func>
+struct gemm_epilogue_op {
+    static constexpr bool active = true;
+
+    scalar_t const* scale_row;
+    scalar_t const* scale_col;
+    scalar_t const* bias_row;
+    scalar_t const* bias_col;
+    Func const* func;
+
+    /// @return epilogue for the tile of C starting at (i0, j0).
+    gemm_epilogue_op shift( int64_t i0, int64_t j0 ) const
+    {
+        return gemm_epilogue_op {
+            scale_row ? scale_row + i0 : nullptr,
+            scale_col ? scale_col + j0 : nullptr,
+            bias_row  ? bias_row  + i0 : nullptr,
+            bias_col  ? bias_col  + j0 : nullptr,
+            func };
+    }
+
+    /// @return scale_row[ i ] * scale_col[ j ], the factor applied to alpha.
+    scalar_t scale( int64_t i, int64_t j ) const
+    {
+        scalar_t s = 1;
+        if (scale_row)
+            s *= scale_row[ i ];
+        if (scale_col)
+            s *= scale_col[ j ];
+        return s;
+    }
+
+    /// @return f( c + bias_row[ i ] + bias_col[ j ] ).
+    scalar_t finish( int64_t i, int64_t j, scalar_t c ) const
+    {
+        if (bias_row)
+            c += bias_row[ i ];
+        if (bias_col)
+            c += bias_col[ j ];
+        return (*func)( c );
+    }
+
+    /// Updates column j of a tile, C_ij = f( alpha_j r_i W_ij + beta C_ij
+    /// + b_i + bias_j ), where alpha_j and bias_j include the column
+    /// scaling and bias. Template flags for the optional terms keep
+    /// branches out of the loop, so it vectorizes.
+    template <bool has_scale_row, bool has_bias_row, bool has_beta,
+              typename TC>
+    void update_col(
+        int64_t mb,
+        scalar_t alpha_j, scalar_t const* Wj,
+        scalar_t beta, TC* Cj, scalar_t bias_j ) const
+    {
+        for (int64_t i = 0; i < mb; ++i) {
+            scalar_t c = alpha_j * Wj[ i ];
+            if constexpr (has_scale_row)
+                c *= scale_row[ i ];
+            if constexpr (has_beta)
+                c += beta * scalar_t( Cj[ i ] );
+            if constexpr (has_bias_row)
+                c += bias_row[ i ];
+            Cj[ i ] = TC( (*func)( c + bias_j ) );
+        }
+    }
+
+    /// Updates the mb-by-nb tile C = f( alpha r s W + beta C + b + c ),
+    /// where W is the product op(A) op(B), in one pass over C.
+    template <typename TC>
+    void update(
+        int64_t mb, int64_t nb,
+        scalar_t alpha, scalar_t const* W, int64_t ldw,
+        scalar_t beta, TC* C, int64_t ldc ) const
+    {
+        const scalar_t zero = 0;
+        for (int64_t j = 0; j < nb; ++j) {
+            scalar_t alpha_j = (scale_col ? alpha * scale_col[ j ] : alpha);
+            scalar_t bias_j  = (bias_col  ? bias_col[ j ] : zero);
+            scalar_t const* Wj = &W[ j*ldw ];
+            TC* Cj = &C[ j*ldc ];
+            if (scale_row) {
+                if (bias_row) {
+                    if (beta != zero)
+                        update_col<true, true, true>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                    else
+                        update_col<true, true, false>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                }
+                else {
+                    if (beta != zero)
+                        update_col<true, false, true>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                    else
+                        update_col<true, false, false>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                }
+            }
+            else {
+                if (bias_row) {
+                    if (beta != zero)
+                        update_col<false, true, true>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                    else
+                        update_col<false, true, false>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                }
+                else {
+                    if (beta != zero)
+                        update_col<false, false, true>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                    else
+                        update_col<false, false, false>( mb, alpha_j, Wj, beta, Cj, bias_j );
+                }
+            }
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Generic gemm_epilogue, for column-major matrices, fused into the
+/// blocked gemm engine: the epilogue is applied to each micro-tile of C
+/// as it is stored after the last block of k, while it is in registers.
+/// C is partitioned into tiles for OpenMP threads, as in gemm.
+///
+/// Arguments are as for gemm_epilogue, with layout ColMajor. Arguments are
+/// assumed to be valid, m, n > 0; gemm_epilogue does the checks.
+/// @ingroup gemm_internal
+template <typename TA, typename TB, typename TC, typename Func>
+void gemm_epilogue_generic(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc,
+    gemm_epilogue_op< scalar_type<TA, TB, TC>, Func > const& ep )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+    const scalar_t zero = 0;
+
+    // C = f( beta C + bias ); A and B are not accessed
+    if (k == 0 || alpha == zero) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                scalar_t c = (beta == zero
+                              ? zero
+                              : beta * scalar_t( C[ i + j*ldc ] ));
+                C[ i + j*ldc ] = TC( ep.finish( i, j, c ) );
+            }
+        }
+        return;
+    }
+
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    int64_t mt = 1, nt = 1;
+    if (nthreads > 1)
+        internal::parallel_grid( nthreads, m, n, &mt, &nt );
+
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i0 = internal::parallel_part( m, mt, ij % mt     );
+        int64_t i1 = internal::parallel_part( m, mt, ij % mt + 1 );
+        int64_t j0 = internal::parallel_part( n, nt, ij / mt     );
+        int64_t j1 = internal::parallel_part( n, nt, ij / mt + 1 );
+        TA const* Ai = (transA == Op::NoTrans ? &A[ i0 ] : &A[ i0*lda ]);
+        TB const* Bj = (transB == Op::NoTrans ? &B[ j0*ldb ] : &B[ j0 ]);
+        gemm_blocked<TA, TB, TC>(
+            transA, transB, i1 - i0, j1 - j0, k,
+            alpha, Ai, lda, Bj, ldb, beta, &C[ i0 + j0*ldc ], ldc,
+            ep.shift( i0, j0 ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// gemm_epilogue for types with a vendor BLAS gemm, for column-major
+/// matrices. The vendor gemm computes W = op(A) op(B) one tile of C at
+/// a time, into a workspace sized to stay in L2 cache, then the epilogue
+/// reads W and C and writes C, so C is read and written only once.
+///
+/// Arguments are as for gemm_epilogue, with layout ColMajor. Arguments are
+/// assumed to be valid, m, n > 0; gemm_epilogue does the checks.
+/// @ingroup gemm_internal
+template <typename scalar_t, typename Func>
+void gemm_epilogue_vendor(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const *A, int64_t lda,
+    scalar_t const *B, int64_t ldb,
+    scalar_t beta,
+    scalar_t       *C, int64_t ldc,
+    gemm_epilogue_op< scalar_t, Func > const& ep )
+{
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    if (k == 0 || alpha == zero) {
+        gemm_epilogue_generic<scalar_t, scalar_t, scalar_t>(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, ep );
+        return;
+    }
+
+    // 512-by-256 tiles of W hold 1 MiB of doubles, to stay in L2 cache.
+    // Tiles keep at least 16 columns, so the vendor gemm still gets a
+    // reasonable panel of B.
+    int64_t mb = min( m, int64_t( 512 ) );
+    int64_t nb = min( n, max( int64_t( 16 ), int64_t( 131072 ) / mb ) );
+    std::vector<scalar_t> W( mb * nb );
+
+    for (int64_t j0 = 0; j0 < n; j0 += nb) {
+        int64_t jb = min( nb, n - j0 );
+        scalar_t const* Bj = (transB == Op::NoTrans ? &B[ j0*ldb ] : &B[ j0 ]);
+        for (int64_t i0 = 0; i0 < m; i0 += mb) {
+            int64_t ib = min( mb, m - i0 );
+            scalar_t const* Ai = (transA == Op::NoTrans ? &A[ i0 ] : &A[ i0*lda ]);
+            blas::gemm( Layout::ColMajor, transA, transB, ib, jb, k,
+                        one, Ai, lda, Bj, ldb, zero, W.data(), ib );
+
+            ep.shift( i0, j0 ).update( ib, jb, alpha, W.data(), ib, beta,
+                                       &C[ i0 + j0*ldc ], ldc );
+        }
+    }
+}
+
+/// True if TA, TB, TC are the same type, with a vendor BLAS gemm.
+/// @ingroup gemm_internal
+template <typename TA, typename TB, typename TC>
+constexpr bool has_vendor_gemm_v =
+    std::is_same< TA, TC >::value
+    && std::is_same< TB, TC >::value
+    && (std::is_same< TC, float >::value
+        || std::is_same< TC, double >::value
+        || std::is_same< TC, std::complex<float> >::value
+        || std::is_same< TC, std::complex<double> >::value);
+
+}  // namespace internal
+
+//==============================================================================
+/// General matrix-matrix multiply with a fused epilogue:
+/// \[
+///     C_{ij} = f\left( \alpha\, r_i\, s_j\, (op(A) op(B))_{ij}
+///                      + \beta C_{ij} + b_i + c_j \right),
+/// \]
+/// where r and s are optional per-row and per-column scalings of alpha,
+/// b and c are optional per-row and per-column biases, and f is an
+/// elementwise function, such as an activation.
+/// This replaces a gemm followed by a separate pass over C, which reads
+/// and writes all of C again from memory: here the epilogue is applied
+/// to each tile of C while it is still in cache.
+///
+/// For float, double, and complex types with TA = TB = TC, the vendor
+/// BLAS gemm computes op(A) op(B) for one tile of C at a time into a
+/// workspace that stays in L2 cache, then the epilogue updates that tile.
+/// Other types use the generic blocked engine, with the epilogue fused
+/// into the store of each micro-tile of C; it is multi-threaded with
+/// OpenMP, see set_num_threads and set_parallel_threshold.
+///
+/// Arguments are as for gemm, plus:
+///
+/// @param[in] scale_row
+///     Vector r of length m, scaling row i of op(A) op(B) by r_i.
+///     May be null for r = 1.
+///
+/// @param[in] scale_col
+///     Vector s of length n, scaling column j of op(A) op(B) by s_j,
+///     i.e., a per-column alpha. May be null for s = 1.
+///
+/// @param[in] bias_row
+///     Vector b of length m, added to row i of C. May be null for b = 0.
+///
+/// @param[in] bias_col
+///     Vector c of length n, added to column j of C. May be null for c = 0.
+///
+/// @param[in] func
+///     Callable f, applied to each element of C as
+///     scalar_t f( scalar_t x ), after the biases are added.
+///     It may be called concurrently from several threads.
+///
+/// @ingroup gemm
+
+template <typename TA, typename TB, typename TC, typename Func>
+void gemm_epilogue(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc,
+    scalar_type<TA, TB, TC> const* scale_row,
+    scalar_type<TA, TB, TC> const* scale_col,
+    scalar_type<TA, TB, TC> const* bias_row,
+    scalar_type<TA, TB, TC> const* bias_col,
+    Func&& func )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+    using func_t = std::remove_reference_t<Func>;
+
+    // redirect if row major: row-major C is column-major C^T
+    if (layout == Layout::RowMajor) {
+        return gemm_epilogue<TB, TA, TC>(
+             Layout::ColMajor,
+             transB,
+             transA,
+             n, m, k,
+             alpha,
+             B, ldb,
+             A, lda,
+             beta,
+             C, ldc,
+             scale_col, scale_row,
+             bias_col,  bias_row,
+             func );
+    }
+    else {
+        // check layout
+        blas_error_if_msg( layout != Layout::ColMajor,
+            "layout != Layout::ColMajor && layout != Layout::RowMajor" );
+    }
+
+    // check arguments
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    blas_error_if( lda < ((transA != Op::NoTrans) ? k : m) );
+    blas_error_if( ldb < ((transB != Op::NoTrans) ? n : k) );
+    blas_error_if( ldc < m );
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    internal::gemm_epilogue_op< scalar_t, func_t > ep {
+        scale_row, scale_col, bias_row, bias_col, &func };
+
+    if constexpr (internal::has_vendor_gemm_v< TA, TB, TC >) {
+        internal::gemm_epilogue_vendor(
+            transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc, ep );
+    }
+    else {
+        internal::gemm_epilogue_generic<TA, TB, TC>(
+            transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc, ep );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// General matrix-matrix multiply with a fused epilogue, where f is
+/// one of the built-in activations. See gemm_epilogue above.
+///
+/// @param[in] activation
+///     Activation f. Except for Activation::None, requires a real type.
+///
+/// @param[in] lower
+///     Lower bound for Activation::Clamp; otherwise ignored.
+///
+/// @param[in] upper
+///     Upper bound for Activation::Clamp; otherwise ignored.
+///
+/// @ingroup gemm
+
+template <typename TA, typename TB, typename TC>
+void gemm_epilogue(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc,
+    scalar_type<TA, TB, TC> const* scale_row,
+    scalar_type<TA, TB, TC> const* scale_col,
+    scalar_type<TA, TB, TC> const* bias_row,
+    scalar_type<TA, TB, TC> const* bias_col,
+    Activation activation,
+    real_type< scalar_type<TA, TB, TC> > lower = 0,
+    real_type< scalar_type<TA, TB, TC> > upper = 0 )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    blas_error_if( activation != Activation::None &&
+                   activation != Activation::ReLU &&
+                   activation != Activation::Clamp &&
+                   activation != Activation::Sigmoid &&
+                   activation != Activation::Tanh &&
+                   activation != Activation::GELU );
+    blas_error_if_msg( is_complex_v<scalar_t>
+                       && activation != Activation::None,
+                       "activation requires a real type" );
+    blas_error_if( activation == Activation::Clamp && lower > upper );
+
+    // Dispatch outside the loops, so each activation is inlined.
+    auto run = [&]( auto func ) {
+        gemm_epilogue<TA, TB, TC>(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc,
+            scale_row, scale_col, bias_row, bias_col, func );
+    };
+    if constexpr (is_complex_v<scalar_t>) {
+        run( []( scalar_t x ) { return x; } );
+    }
+    else {
+        switch (activation) {
+            case Activation::None:
+                run( []( scalar_t x ) { return x; } );
+                break;
+            case Activation::ReLU:
+                run( []( scalar_t x ) { return (x < 0 ? scalar_t( 0 ) : x); } );
+                break;
+            case Activation::Clamp:
+                run( [=]( scalar_t x ) {
+                    return (x < lower ? lower : (x > upper ? upper : x));
+                } );
+                break;
+            case Activation::Sigmoid:
+                run( []( scalar_t x ) { return 1 / (1 + std::exp( -x )); } );
+                break;
+            case Activation::Tanh:
+                run( []( scalar_t x ) { return std::tanh( x ); } );
+                break;
+            case Activation::GELU:
+                run( []( scalar_t x ) {
+                    return x * (1 + std::erf( x / std::sqrt( scalar_t( 2 ) ) ))
+                           / 2;
+                } );
+                break;
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMM_EPILOGUE_HH
@@ -0,0 +1,249 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMM_PACK_HH
+#define BLAS_GEMM_PACK_HH
+
+#include "blas/util.hh"
+
+#include <vector>
+
+namespace blas {
+
+//------------------------------------------------------------------------------
+/// Operand of gemm held by a PackedMatrix.
+enum class Operand : char {
+    A = 'A',  ///< op(A), m-by-k
+    B = 'B',  ///< op(B), k-by-n
+};
+
+//------------------------------------------------------------------------------
+/// An operand of gemm, alpha op(A) or alpha op(B), packed once by
+/// gemm_pack for reuse across many gemm calls, avoiding repacking it
+/// in each call.
+///
+/// The packed format is opaque and depends on the BLAS library.
+/// With Intel MKL, float and double use MKL's ?gemm_pack format;
+/// otherwise, BLAS++ stores alpha op(X), already transposed, conjugated,
+/// and scaled, as the micro-panels of its blocked gemm engine
+/// (see gemm_blocking), so each gemm passes them to the macro-kernel
+/// without repacking that operand.
+///
+/// A PackedMatrix is valid only with the layout and dimensions it was
+/// packed with; gemm checks them.
+///
+/// @ingroup gemm
+template <typename scalar_t>
+class PackedMatrix
+{
+public:
+    /// Constructs an empty PackedMatrix; gemm_pack fills it.
+    PackedMatrix()
+        : layout_( Layout::ColMajor ),
+          operand_( Operand::A ),
+          m_( 0 ), n_( 0 ), k_( 0 ),
+          vendor_( false ),
+          empty_( true )
+    {}
+
+    /// @return layout the operand was packed with.
+    blas::Layout layout() const { return layout_; }
+
+    /// @return whether this holds op(A) or op(B).
+    blas::Operand operand() const { return operand_; }
+
+    /// @return dimensions of the gemm the operand was packed for.
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+    int64_t k() const { return k_; }
+
+    /// @return true if gemm_pack hasn't been called.
+    bool empty() const { return empty_; }
+
+    /// @return true if data is in the vendor's packed format.
+    bool vendor() const { return vendor_; }
+
+    /// @return packed data; its format is internal to BLAS++.
+    scalar_t*       data()       { return data_.data(); }
+    scalar_t const* data() const { return data_.data(); }
+
+    /// Sets the description and allocates size elements of packed data.
+    /// Used by gemm_pack.
+    void reset( blas::Layout layout, blas::Operand operand,
+                int64_t m, int64_t n, int64_t k,
+                bool vendor, size_t size )
+    {
+        layout_  = layout;
+        operand_ = operand;
+        m_ = m;
+        n_ = n;
+        k_ = k;
+        vendor_ = vendor;
+        empty_  = false;
+        data_.resize( size );
+    }
+
+private:
+    blas::Layout  layout_;
+    blas::Operand operand_;
+    int64_t m_, n_, k_;
+    bool vendor_;
+    bool empty_;
+    std::vector<scalar_t> data_;
+};
+
+//==============================================================================
+// CPU overloads, in src/gemm_pack.cc.
+
+//------------------------------------------------------------------------------
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const* X, int64_t ldx,
+    PackedMatrix<float>& Xp );
+
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const* X, int64_t ldx,
+    PackedMatrix<double>& Xp );
+
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* X, int64_t ldx,
+    PackedMatrix< std::complex<float> >& Xp );
+
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* X, int64_t ldx,
+    PackedMatrix< std::complex<double> >& Xp );
+
+//------------------------------------------------------------------------------
+// gemm with packed A.
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<float> const& A,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<double> const& A,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<float> > const& A,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<double> > const& A,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc );
+
+//------------------------------------------------------------------------------
+// gemm with packed B.
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    PackedMatrix<float> const& B,
+    float beta,
+    float*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    PackedMatrix<double> const& B,
+    double beta,
+    double*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    PackedMatrix< std::complex<float> > const& B,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    PackedMatrix< std::complex<double> > const& B,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc );
+
+//------------------------------------------------------------------------------
+// gemm with packed A and B.
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<float> const& A,
+    PackedMatrix<float> const& B,
+    float beta,
+    float*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<double> const& A,
+    PackedMatrix<double> const& B,
+    double beta,
+    double*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<float> > const& A,
+    PackedMatrix< std::complex<float> > const& B,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc );
+
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<double> > const& A,
+    PackedMatrix< std::complex<double> > const& B,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc );
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMM_PACK_HH
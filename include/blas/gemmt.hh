@@ -0,0 +1,342 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMMT_HH
+#define BLAS_GEMMT_HH
+
+#include "blas/util.hh"
+#include "blas/gemm.hh"
+#include "blas/parallel.hh"
+
+#include <limits>
+#include <type_traits>
+
+namespace blas {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block size for the generic gemmt. Diagonal blocks are computed by
+/// gemmt_loops; the rest of each block column is one gemm.
+/// @ingroup gemmt_internal
+constexpr int64_t gemmt_nb = 64;
+
+//------------------------------------------------------------------------------
+/// Unblocked gemmt, updating only the uplo triangle of
+/// C = alpha op(A) op(B) + beta C, for column-major matrices,
+/// using simple loop nests. Used by gemmt for the diagonal blocks.
+///
+/// Arguments are as for gemmt, with layout ColMajor. Arguments are
+/// assumed to be valid, n, k > 0, and alpha != 0; gemmt does the checks.
+/// @ingroup gemmt_internal
+template <typename TA, typename TB, typename TC>
+void gemmt_loops(
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // constants
+    const scalar_t zero = 0;
+
+    // op(B)( l, j )
+    auto opB = [&]( int64_t l, int64_t j ) -> scalar_t {
+        if (transB == Op::NoTrans)
+            return B(l, j);
+        else if (transB == Op::Trans)
+            return B(j, l);
+        else
+            return conj( B(j, l) );
+    };
+
+    bool lower = (uplo == Uplo::Lower);
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = (lower ? j : 0);
+        int64_t i1 = (lower ? n : j + 1);
+
+        // If C is narrower than scalar_t (e.g., float16), accumulate
+        // in scalar_t using the inner product form.
+        if (transA == Op::NoTrans && std::is_same< TC, scalar_t >::value) {
+            for (int64_t i = i0; i < i1; ++i)
+                C(i, j) = (beta == zero ? zero : scalar_t( beta*C(i, j) ));
+            for (int64_t l = 0; l < k; ++l) {
+                scalar_t alpha_Blj = alpha*opB( l, j );
+                for (int64_t i = i0; i < i1; ++i)
+                    C(i, j) += A(i, l)*alpha_Blj;
+            }
+        }
+        else {
+            for (int64_t i = i0; i < i1; ++i) {
+                scalar_t sum = zero;
+                if (transA == Op::NoTrans) {
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(i, l)*opB( l, j );
+                }
+                else if (transA == Op::Trans) {
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += A(l, i)*opB( l, j );
+                }
+                else { // transA == Op::ConjTrans
+                    for (int64_t l = 0; l < k; ++l)
+                        sum += conj( A(l, i) )*opB( l, j );
+                }
+                if (beta == zero)
+                    C(i, j) = alpha*sum;
+                else
+                    C(i, j) = alpha*sum + beta*C(i, j);
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+    #undef C
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// General matrix-matrix multiply, updating only one triangle of C:
+/// \[
+///     C = \alpha op(A) \times op(B) + \beta C,
+/// \]
+/// where $op(X)$ is one of
+///     $op(X) = X$,
+///     $op(X) = X^T$, or
+///     $op(X) = X^H$,
+/// alpha and beta are scalars, and A, B, and C are matrices, with
+/// $op(A)$ an n-by-k matrix, $op(B)$ a k-by-n matrix, and C an n-by-n matrix.
+/// This is useful when the product is known to be symmetric,
+/// e.g., $A X A^T$ computed as $(A X) A^T$, and takes half the flops of gemm.
+///
+/// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     What part of the matrix C is updated;
+///     the opposite triangle is not referenced:
+///     - Uplo::Lower: only the lower triangular part of C is updated.
+///     - Uplo::Upper: only the upper triangular part of C is updated.
+///
+/// @param[in] transA
+///     The operation $op(A)$ to be used:
+///     - Op::NoTrans:   $op(A) = A$.
+///     - Op::Trans:     $op(A) = A^T$.
+///     - Op::ConjTrans: $op(A) = A^H$.
+///
+/// @param[in] transB
+///     The operation $op(B)$ to be used:
+///     - Op::NoTrans:   $op(B) = B$.
+///     - Op::Trans:     $op(B) = B^T$.
+///     - Op::ConjTrans: $op(B) = B^H$.
+///
+/// @param[in] n
+///     Number of rows and columns of the matrix C,
+///     rows of $op(A)$, and columns of $op(B)$. n >= 0.
+///
+/// @param[in] k
+///     Number of columns of $op(A)$ and rows of $op(B)$. k >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A and B are not accessed.
+///
+/// @param[in] A
+///     - If transA = NoTrans:
+///       the n-by-k matrix A, stored in an lda-by-k array [RowMajor: n-by-lda].
+///     - Otherwise:
+///       the k-by-n matrix A, stored in an lda-by-n array [RowMajor: k-by-lda].
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///     - If transA = NoTrans: lda >= max(1, n) [RowMajor: lda >= max(1, k)].
+///     - Otherwise:           lda >= max(1, k) [RowMajor: lda >= max(1, n)].
+///
+/// @param[in] B
+///     - If transB = NoTrans:
+///       the k-by-n matrix B, stored in an ldb-by-n array [RowMajor: k-by-ldb].
+///     - Otherwise:
+///       the n-by-k matrix B, stored in an ldb-by-k array [RowMajor: n-by-ldb].
+///
+/// @param[in] ldb
+///     Leading dimension of B.
+///     - If transB = NoTrans: ldb >= max(1, k) [RowMajor: ldb >= max(1, n)].
+///     - Otherwise:           ldb >= max(1, n) [RowMajor: ldb >= max(1, k)].
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, C need not be set on input.
+///
+/// @param[in] C
+///     The n-by-n matrix C, stored in an ldc-by-n array [RowMajor: n-by-ldc].
+///
+/// @param[in] ldc
+///     Leading dimension of C. ldc >= max(1, n).
+///
+/// @ingroup gemmt
+
+template <typename TA, typename TB, typename TC>
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_type<TA, TB, TC> alpha,
+    TA const *A, int64_t lda,
+    TB const *B, int64_t ldb,
+    scalar_type<TA, TB, TC> beta,
+    TC       *C, int64_t ldc )
+{
+    // redirect if row major
+    // C^T = op(B)^T op(A)^T, with the opposite triangle
+    if (layout == Layout::RowMajor) {
+        blas_error_if( uplo != Uplo::Lower &&
+                       uplo != Uplo::Upper );
+        return gemmt<TB, TA, TC>(
+             Layout::ColMajor,
+             (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower),
+             transB,
+             transA,
+             n, k,
+             alpha,
+             B, ldb,
+             A, lda,
+             beta,
+             C, ldc);
+    }
+    else {
+        // check layout
+        blas_error_if_msg( layout != Layout::ColMajor,
+            "layout != Layout::ColMajor && layout != Layout::RowMajor" );
+    }
+
+    typedef blas::scalar_type<TA, TB, TC> scalar_t;
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // constants
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // check arguments
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    blas_error_if( lda < ((transA != Op::NoTrans) ? k : n) );
+    blas_error_if( ldb < ((transB != Op::NoTrans) ? n : k) );
+    blas_error_if( ldc < n );
+
+    // quick return
+    if (n == 0)
+        return;
+
+    bool lower = (uplo == Uplo::Lower);
+
+    // alpha == zero or k == 0
+    if (alpha == zero || k == 0) {
+        if (beta != one) {
+            for (int64_t j = 0; j < n; ++j) {
+                int64_t i0 = (lower ? j : 0);
+                int64_t i1 = (lower ? n : j + 1);
+                for (int64_t i = i0; i < i1; ++i)
+                    C(i, j) = (beta == zero ? zero : scalar_t( beta*C(i, j) ));
+            }
+        }
+        return;
+    }
+
+    // alpha != zero
+    int nthreads = internal::parallel_num_threads( n*n*k/2 );
+    if (nthreads > 1) {
+        // 2-D partition of C into nb-by-nb tiles; only tiles in the
+        // uplo triangle are computed: diagonal tiles by a serial gemmt,
+        // off-diagonal tiles by gemm. Tiles are serial, since nested calls
+        // are inside the OpenMP parallel region.
+        int64_t nb = internal::parallel_triangle_blocks( nthreads, n );
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( dynamic )
+        for (int64_t ij = 0; ij < nb*nb; ++ij) {
+            int64_t bi = ij % nb;
+            int64_t bj = ij / nb;
+            if (lower ? bi < bj : bi > bj)
+                continue;
+
+            int64_t i0 = internal::parallel_part( n, nb, bi     );
+            int64_t i1 = internal::parallel_part( n, nb, bi + 1 );
+            int64_t j0 = internal::parallel_part( n, nb, bj     );
+            int64_t j1 = internal::parallel_part( n, nb, bj + 1 );
+            TA const* Ai = (transA == Op::NoTrans ? &A(i0, 0) : &A(0, i0));
+            TB const* Bj = (transB == Op::NoTrans ? &B(0, j0) : &B(j0, 0));
+            if (bi == bj) {
+                gemmt<TA, TB, TC>( Layout::ColMajor, uplo, transA, transB,
+                                   i1 - i0, k,
+                                   alpha, Ai, lda, Bj, ldb,
+                                   beta, &C(i0, i0), ldc );
+            }
+            else {
+                gemm<TA, TB, TC>( Layout::ColMajor, transA, transB,
+                                  i1 - i0, j1 - j0, k,
+                                  alpha, Ai, lda, Bj, ldb,
+                                  beta, &C(i0, j0), ldc );
+            }
+        }
+    }
+    else {
+        // Block columns of width nb: the diagonal block by loops,
+        // the rest of the block column in the uplo triangle by one gemm,
+        // which uses the blocked engine when it is large enough.
+        const int64_t nb = internal::gemmt_nb;
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t jb = min( nb, n - j0 );
+            TB const* Bj = (transB == Op::NoTrans ? &B(0, j0) : &B(j0, 0));
+            TA const* Aj = (transA == Op::NoTrans ? &A(j0, 0) : &A(0, j0));
+            internal::gemmt_loops( uplo, transA, transB, jb, k,
+                                   alpha, Aj, lda, Bj, ldb,
+                                   beta, &C(j0, j0), ldc );
+
+            // rows of the off-diagonal part: below or above the diagonal block
+            int64_t i0 = (lower ? j0 + jb : 0);
+            int64_t ib = (lower ? n - i0  : j0);
+            if (ib > 0) {
+                TA const* Ai = (transA == Op::NoTrans ? &A(i0, 0) : &A(0, i0));
+                gemm<TA, TB, TC>( Layout::ColMajor, transA, transB,
+                                  ib, jb, k,
+                                  alpha, Ai, lda, Bj, ldb,
+                                  beta, &C(i0, j0), ldc );
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+    #undef C
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMMT_HH
@@ -7,10 +7,171 @@
 #define BLAS_GEMV_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// True if T is stored in fewer bytes per real component than scalar_t,
+/// e.g., float16 or bfloat16 with float arithmetic. real_type can't be
+/// used here, as real_type< float16 > is float.
+/// @ingroup gemv_internal
+template <typename T, typename scalar_t>
+constexpr bool is_narrower_v
+    = sizeof( T ) / (is_complex_v<T> ? 2 : 1) < sizeof( real_type<scalar_t> );
+
+//------------------------------------------------------------------------------
+/// Computes yw += op(A) xw for gemv_convert, converting A to scalar_t in
+/// unit-stride loops that vectorize. op(A) is A, or conj( A ) if doconj,
+/// for trans = NoTrans, else A^T or A^H, for the m-by-n column-major A.
+/// @ingroup gemv_internal
+template <typename TA, typename scalar_t>
+void gemv_convert_kernel(
+    blas::Op trans, bool doconj,
+    int64_t m, int64_t n,
+    TA const *A, int64_t lda,
+    scalar_t const* xw, scalar_t* yw )
+{
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+
+    const scalar_t zero = 0;
+
+    if (trans == Op::NoTrans) {
+        // yw += op(A) xw
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t xj = xw[ j ];
+            if (doconj) {
+                #pragma omp simd
+                for (int64_t i = 0; i < m; ++i)
+                    yw[ i ] += scalar_t( conj( A(i, j) ) ) * xj;
+            }
+            else {
+                #pragma omp simd
+                for (int64_t i = 0; i < m; ++i)
+                    yw[ i ] += scalar_t( A(i, j) ) * xj;
+            }
+        }
+    }
+    else {
+        // yw += op(A) xw, as dot products
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t sum = zero;
+            if constexpr (is_complex_v<scalar_t>) {
+                if (trans == Op::ConjTrans) {
+                    for (int64_t i = 0; i < m; ++i)
+                        sum += scalar_t( conj( A(i, j) ) ) * xw[ i ];
+                }
+                else {
+                    for (int64_t i = 0; i < m; ++i)
+                        sum += scalar_t( A(i, j) ) * xw[ i ];
+                }
+            }
+            else {
+                #pragma omp simd reduction(+: sum)
+                for (int64_t i = 0; i < m; ++i)
+                    sum += scalar_t( A(i, j) ) * xw[ i ];
+            }
+            yw[ j ] += sum;
+        }
+    }
+
+    #undef A
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by gemv_convert. For most types, this is the inline
+/// gemv_convert_kernel, compiled for the application's instruction set.
+/// @ingroup gemv_internal
+template <typename TA, typename scalar_t>
+inline void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj,
+    int64_t m, int64_t n,
+    TA const *A, int64_t lda,
+    scalar_t const* xw, scalar_t* yw )
+{
+    gemv_convert_kernel( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+/// For real A in float16, bfloat16, float, or double, the kernel is
+/// compiled in the library in variants for several instruction sets,
+/// selected at runtime. See set_simd_isa.
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float16 const* A, int64_t lda,
+    float const* xw, float* yw );
+
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    bfloat16 const* A, int64_t lda,
+    float const* xw, float* yw );
+
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* xw, float* yw );
+
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    double const* xw, double* yw );
+
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* xw, double* yw );
+
+//------------------------------------------------------------------------------
+/// gemv for operands stored in a type narrower than scalar_t,
+/// e.g., float16 A, x, or y with float arithmetic.
+/// Converts alpha x and beta y into scalar_t workspaces, so y is rounded
+/// once at the end rather than after each column, and converts A on the fly
+/// in unit-stride loops that vectorize.
+///
+/// Arguments are as for gemv, with layout ColMajor and
+/// trans = NoTrans, Trans, or ConjTrans. If doconj, uses conj( A ) with
+/// trans = NoTrans, which occurs for RowMajor A^H.
+/// Arguments are assumed valid, with m, n > 0.
+/// @ingroup gemv_internal
+template <typename TA, typename TX, typename TY>
+void gemv_convert(
+    blas::Op trans, bool doconj,
+    int64_t m, int64_t n,
+    blas::scalar_type<TA, TX, TY> alpha,
+    TA const *A, int64_t lda,
+    TX const *x, int64_t incx,
+    blas::scalar_type<TA, TX, TY> beta,
+    TY *y, int64_t incy )
+{
+    using scalar_t = blas::scalar_type<TA, TX, TY>;
+
+    const scalar_t zero = 0;
+
+    int64_t lenx = (trans == Op::NoTrans ? n : m);
+    int64_t leny = (trans == Op::NoTrans ? m : n);
+    int64_t kx = (incx > 0 ? 0 : (-lenx + 1)*incx);
+    int64_t ky = (incy > 0 ? 0 : (-leny + 1)*incy);
+
+    // xw = alpha x, yw = beta y
+    std::vector<scalar_t> xw( lenx ), yw( leny );
+    for (int64_t i = 0; i < lenx; ++i)
+        xw[ i ] = alpha * scalar_t( x[ kx + i*incx ] );
+    for (int64_t i = 0; i < leny; ++i) {
+        yw[ i ] = (beta == zero ? zero : beta * scalar_t( y[ ky + i*incy ] ));
+    }
+
+    gemv_convert_kernel_simd( trans, doconj, m, n, A, lda,
+                              xw.data(), yw.data() );
+
+    for (int64_t i = 0; i < leny; ++i)
+        y[ ky + i*incy ] = TY( yw[ i ] );
+}
+
+}  // namespace internal
 
 // =============================================================================
 /// General matrix-vector multiply:
@@ -25,6 +186,15 @@ namespace blas {
 /// and A is an m-by-n matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// If A, x, or y is stored in a narrower type than the scalar type,
+/// e.g., float16, y is accumulated in the scalar type.
+///
+/// Above the parallel threshold (see set_parallel_threshold), op(A) is split
+/// among OpenMP threads along its longer dimension: into blocks of rows if
+/// op(A) is taller than wide, each thread computing its part of y;
+/// otherwise into blocks of columns, each thread accumulating a partial y,
+/// which are added in thread order, so results are deterministic for a
+/// given number of threads.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -116,6 +286,77 @@ void gemv(
     if (m == 0 || n == 0 || (alpha == zero && beta == one))
         return;
 
+    // op(A) is leny-by-lenx; split the longer dimension among threads,
+    // with at most one thread per row or column.
+    int64_t lenx = (trans == Op::NoTrans ? n : m);
+    int64_t leny = (trans == Op::NoTrans ? m : n);
+    bool split_rows = (leny >= lenx);
+    int nthreads = int( min( int64_t( internal::parallel_num_threads( m*n ) ),
+                             split_rows ? leny : lenx ) );
+    if (nthreads > 1 && alpha != zero) {
+        // Blocks of op(A) are done by serial gemv calls in the caller's
+        // layout, since nested calls are inside the OpenMP parallel region.
+
+        // gemv on the ib-by-jb block of op(A) starting at op(A)(i0, j0)
+        auto gemv_block = [&]( int64_t i0, int64_t ib, int64_t j0, int64_t jb,
+                               TX const* xb, scalar_t beta_, auto* yb,
+                               int64_t incyb ) {
+            int64_t r = (trans == Op::NoTrans ? i0 : j0);
+            int64_t c = (trans == Op::NoTrans ? j0 : i0);
+            TA const* Ab = (layout == Layout::ColMajor ? &A[ r + c*lda ]
+                                                       : &A[ r*lda + c ]);
+            using TYb = std::remove_pointer_t< decltype( yb ) >;
+            if (trans == Op::NoTrans) {
+                gemv<TA, TX, TYb>( layout, trans, ib, jb, alpha, Ab, lda,
+                                   xb, incx, beta_, yb, incyb );
+            }
+            else {
+                gemv<TA, TX, TYb>( layout, trans, jb, ib, alpha, Ab, lda,
+                                   xb, incx, beta_, yb, incyb );
+            }
+        };
+
+        if (split_rows) {
+            // Row blocks: each thread computes its block of y.
+            #pragma omp parallel for num_threads( nthreads ) schedule( static )
+            for (int t = 0; t < nthreads; ++t) {
+                int64_t i0 = internal::parallel_part( leny, nthreads, t     );
+                int64_t i1 = internal::parallel_part( leny, nthreads, t + 1 );
+                TY* yb = internal::vector_block( y, leny, incy, i0, i1 - i0 );
+                gemv_block( i0, i1 - i0, 0, lenx, x, beta, yb, incy );
+            }
+        }
+        else {
+            // Column blocks: each thread computes a partial
+            // w_t = alpha op(A)(:, j0:j1) x(j0:j1), in scalar_t,
+            // then y = beta y + sum_t w_t, added in thread order.
+            std::vector<scalar_t> w( nthreads*leny );
+            #pragma omp parallel num_threads( nthreads )
+            {
+                #pragma omp for schedule( static )
+                for (int t = 0; t < nthreads; ++t) {
+                    int64_t j0 = internal::parallel_part( lenx, nthreads, t     );
+                    int64_t j1 = internal::parallel_part( lenx, nthreads, t + 1 );
+                    TX const* xb = internal::vector_block(
+                        x, lenx, incx, j0, j1 - j0 );
+                    gemv_block( 0, leny, j0, j1 - j0, xb, zero,
+                                &w[ t*leny ], int64_t( 1 ) );
+                }
+
+                int64_t ky = (incy > 0 ? 0 : (-leny + 1)*incy);
+                #pragma omp for schedule( static )
+                for (int64_t i = 0; i < leny; ++i) {
+                    scalar_t sum = w[ i ];
+                    for (int t = 1; t < nthreads; ++t)
+                        sum += w[ t*leny + i ];
+                    TY& yi = y[ ky + i*incy ];
+                    yi = TY( beta == zero ? sum : sum + beta*scalar_t( yi ) );
+                }
+            }
+        }
+        return;
+    }
+
     bool doconj = false;
     if (layout == Layout::RowMajor) {
         // A => A^T; A^T => A; A^H => A & conj
@@ -131,8 +372,19 @@ void gemv(
         }
     }
 
-    int64_t lenx = (trans == Op::NoTrans ? n : m);
-    int64_t leny = (trans == Op::NoTrans ? m : n);
+    // Operands stored in narrower types than scalar_t, e.g., float16, are
+    // converted. Other mixed types, e.g., real A with complex x and y,
+    // use the loops below, which don't need workspace.
+    if constexpr (internal::is_narrower_v< TA, scalar_t >
+                  || internal::is_narrower_v< TX, scalar_t >
+                  || internal::is_narrower_v< TY, scalar_t >) {
+        if (alpha != zero) {
+            internal::gemv_convert( trans, doconj, m, n,
+                                    alpha, A, lda, x, incx, beta, y, incy );
+            return;
+        }
+    }
+
     int64_t kx = (incx > 0 ? 0 : (-lenx + 1)*incx);
     int64_t ky = (incy > 0 ? 0 : (-leny + 1)*incy);
 
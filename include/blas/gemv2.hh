@@ -0,0 +1,317 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GEMV2_HH
+#define BLAS_GEMV2_HH
+
+#include "blas/util.hh"
+#include "blas/dot2.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+/// Rows per block in gemv2 with op(A) = A. Each row keeps its own
+/// compensated sum, so the inner loop over rows vectorizes.
+const int64_t gemv2_block = 256;
+
+//------------------------------------------------------------------------------
+/// Computes t = A x, or conj( A ) x if conj_A, for the ib-by-n column-major
+/// matrix A, with ib <= gemv2_block, as unevaluated sums hi[ i ] + lo[ i ],
+/// with the Dot2 algorithm for each row.
+/// Element j of x is x[ j*incx ], so incx < 0 must be handled by the caller.
+/// @ingroup gemv2_internal
+template <typename scalar_t>
+void gemv2_kernel(
+    bool conj_A, int64_t ib, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* x, int64_t incx,
+    scalar_t* hi, scalar_t* lo )
+{
+    using real_t = real_type<scalar_t>;
+    constexpr int64_t mb = gemv2_block;
+
+    // real and imaginary parts of each row
+    real_t sr[ mb ], cr[ mb ], si[ mb ], ci[ mb ];
+    for (int64_t i = 0; i < ib; ++i) {
+        sr[ i ] = cr[ i ] = si[ i ] = ci[ i ] = 0;
+    }
+
+    // Complex values are accessed as real and imaginary parts, avoiding
+    // std::complex operations, so the loop over rows vectorizes.
+    // (ar + i aim) (xr + i xi), with aim = -imag( a ) for conj( A ).
+    real_t const* A_ = reinterpret_cast<real_t const*>( A );
+    real_t sign = conj_A ? -1 : 1;
+    for (int64_t j = 0; j < n; ++j) {
+        if constexpr (is_complex_v<scalar_t>) {
+            real_t const* Aj = &A_[ 2*j*lda ];
+            real_t xr = real( x[ j*incx ] );
+            real_t xi = imag( x[ j*incx ] );
+            for (int64_t i = 0; i < ib; ++i) {
+                real_t ar  = Aj[ 2*i ];
+                real_t aim = Aj[ 2*i + 1 ] * sign;
+                compensated_add_prod( sr[ i ], cr[ i ],  ar,  xr );
+                compensated_add_prod( sr[ i ], cr[ i ], -aim, xi );
+                compensated_add_prod( si[ i ], ci[ i ],  ar,  xi );
+                compensated_add_prod( si[ i ], ci[ i ],  aim, xr );
+            }
+        }
+        else {
+            real_t const* Aj = &A_[ j*lda ];
+            real_t xj = x[ j*incx ];
+            for (int64_t i = 0; i < ib; ++i) {
+                compensated_add_prod( sr[ i ], cr[ i ], Aj[ i ], xj );
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < ib; ++i) {
+        hi[ i ] = make_scalar<scalar_t>( sr[ i ], si[ i ] );
+        lo[ i ] = make_scalar<scalar_t>( cr[ i ], ci[ i ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by gemv2. For most types, this is the inline
+/// gemv2_kernel, compiled for the application's instruction set.
+/// @ingroup gemv2_internal
+template <typename scalar_t>
+inline void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* x, int64_t incx,
+    scalar_t* hi, scalar_t* lo )
+{
+    gemv2_kernel( conj_A, ib, n, A, lda, x, incx, hi, lo );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    float const* A, int64_t lda,
+    float const* x, int64_t incx,
+    float* hi, float* lo );
+
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    double const* A, int64_t lda,
+    double const* x, int64_t incx,
+    double* hi, double* lo );
+
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float>* hi, std::complex<float>* lo );
+
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double>* hi, std::complex<double>* lo );
+
+//------------------------------------------------------------------------------
+/// @return alpha (hi + lo) + beta y, with the products alpha hi and beta y
+/// and their sum computed with compensation, rounded to working precision.
+/// If beta is zero, y is not accessed.
+/// @ingroup gemv2_internal
+template <typename scalar_t>
+inline scalar_t compensated_axpby(
+    scalar_t alpha, scalar_t hi, scalar_t lo,
+    scalar_t beta,  scalar_t y )
+{
+    using real_t = real_type<scalar_t>;
+    real_t sr = 0, cr = 0, si = 0, ci = 0;
+
+    auto add = [&]( scalar_t a, scalar_t b ) {
+        compensated_add_prod( sr, cr, real( a ), real( b ) );
+        if constexpr (is_complex_v<scalar_t>) {
+            compensated_add_prod( sr, cr, -imag( a ), imag( b ) );
+            compensated_add_prod( si, ci,  real( a ), imag( b ) );
+            compensated_add_prod( si, ci,  imag( a ), real( b ) );
+        }
+    };
+    add( alpha, hi );
+    if (beta != scalar_t( 0 ))
+        add( beta, y );
+
+    scalar_t alo = alpha * lo;
+    return make_scalar<scalar_t>( sr + (cr + real( alo )),
+                                  si + (ci + imag( alo )) );
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// General matrix-vector multiply:
+/// \[
+///     y = \alpha op(A) x + \beta y,
+/// \]
+/// where $op(A)$ is one of
+///     $op(A) = A$,
+///     $op(A) = A^T$, or
+///     $op(A) = A^H$,
+/// alpha and beta are scalars, x and y are vectors,
+/// and A is an m-by-n matrix,
+/// with each element of y as accurate as if computed in twice the working
+/// precision, then rounded to working precision.
+/// Each $(op(A) x)_i$ is summed with the compensated Dot2 algorithm of
+/// Ogita, Rump, and Oishi, then $\alpha (op(A) x)_i$ and $\beta y_i$
+/// are added with compensation. For instance, the residual
+/// $r = b - A x$ is `gemv2( layout, NoTrans, m, n, -1, A, lda, x, 1, 1, r, 1 )`,
+/// with r = b on input, for iterative refinement without promoting
+/// A, x, and b to a wider type.
+/// @see gemv for the usual version.
+///
+/// Generic implementation for IEEE floating point types.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] trans
+///     The operation to be performed:
+///     - Op::NoTrans:   $y = \alpha A   x + \beta y$,
+///     - Op::Trans:     $y = \alpha A^T x + \beta y$,
+///     - Op::ConjTrans: $y = \alpha A^H x + \beta y$.
+///
+/// @param[in] m
+///     Number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of the matrix A. n >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha. If alpha is zero, A and x are not accessed.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array [RowMajor: m-by-lda].
+///
+/// @param[in] lda
+///     Leading dimension of A. lda >= max(1, m) [RowMajor: lda >= max(1, n)].
+///
+/// @param[in] x
+///     - If trans = NoTrans:
+///       the n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///     - Otherwise:
+///       the m-element vector x, in an array of length (m-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, y need not be set on input.
+///
+/// @param[in, out] y
+///     - If trans = NoTrans:
+///       the m-element vector y, in an array of length (m-1)*abs(incy) + 1.
+///     - Otherwise:
+///       the n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @ingroup gemv2
+
+template <typename T>
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    T alpha,
+    T const *A, int64_t lda,
+    T const *x, int64_t incx,
+    T beta,
+    T *y, int64_t incy )
+{
+    const T zero = 0;
+    const T one  = 1;
+
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( lda < m );
+    else
+        blas_error_if( lda < n );
+
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    // quick return
+    if (m == 0 || n == 0 || (alpha == zero && beta == one))
+        return;
+
+    // In column-major terms, op(A) is A or A^T, maybe conjugated;
+    // row-major A is column-major A^T.
+    bool transpose = (trans != Op::NoTrans);
+    bool conj_A    = (trans == Op::ConjTrans);
+    if (layout == Layout::RowMajor) {
+        transpose = ! transpose;
+        std::swap( m, n );
+    }
+    // op(A) is my-by-nx
+    int64_t my = (transpose ? n : m);
+    int64_t nx = (transpose ? m : n);
+
+    // with negative inc, element i is at (len - 1 - i)*|inc|
+    if (incx < 0)
+        x += (1 - nx)*incx;
+    if (incy < 0)
+        y += (1 - my)*incy;
+
+    if (alpha == zero) {
+        // y = beta y; A and x are not accessed
+        for (int64_t i = 0; i < my; ++i)
+            y[ i*incy ] = (beta == zero ? zero : beta*y[ i*incy ]);
+        return;
+    }
+
+    int nthreads = internal::parallel_num_threads( m*n );
+    if (transpose) {
+        // y_j = alpha dot2( A(:, j), x ) + beta y_j
+        #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                    if( nthreads > 1 )
+        for (int64_t j = 0; j < my; ++j) {
+            T hi, lo;
+            internal::dot2_kernel_simd( conj_A, nx, &A[ j*lda ], 1,
+                                        x, incx, &hi, &lo );
+            y[ j*incy ] = internal::compensated_axpby(
+                              alpha, hi, lo, beta, y[ j*incy ] );
+        }
+    }
+    else {
+        // each block of rows accumulates column by column
+        const int64_t mb = internal::gemv2_block;
+        int64_t nblocks = (my + mb - 1) / mb;
+        #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                    if( nthreads > 1 )
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t i0 = b*mb;
+            int64_t ib = min( mb, my - i0 );
+            T hi[ mb ], lo[ mb ];
+            internal::gemv2_kernel_simd( conj_A, ib, nx, &A[ i0 ], lda,
+                                         x, incx, hi, lo );
+            for (int64_t i = 0; i < ib; ++i) {
+                y[ (i0 + i)*incy ] = internal::compensated_axpby(
+                    alpha, hi[ i ], lo[ i ], beta, y[ (i0 + i)*incy ] );
+            }
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GEMV2_HH
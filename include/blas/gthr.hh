@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_GTHR_HH
+#define BLAS_GTHR_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Gathers $x = y(indx)$ for nz elements, then if zero, sets $y(indx) = 0$.
+/// The loop can be vectorized, with gathers of y if the compiler deems
+/// them profitable.
+/// @ingroup gthr_internal
+template <typename TY, typename TX>
+void gthr_kernel(
+    bool zero, int64_t nz,
+    TY* y, TX* x, int64_t const* indx )
+{
+    if constexpr (is_complex_v<TX> && is_complex_v<TY>) {
+        // Complex values are accessed as real and imaginary parts,
+        // avoiding std::complex operations, so the loop vectorizes.
+        auto x_ = reinterpret_cast< real_type<TX>* >( x );
+        auto y_ = reinterpret_cast< real_type<TY>* >( y );
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            int64_t k = 2*indx[ i ];
+            x_[ 2*i     ] = y_[ k     ];
+            x_[ 2*i + 1 ] = y_[ k + 1 ];
+        }
+        if (zero) {
+            #pragma omp simd
+            for (int64_t i = 0; i < nz; ++i) {
+                int64_t k = 2*indx[ i ];
+                y_[ k     ] = 0;
+                y_[ k + 1 ] = 0;
+            }
+        }
+    }
+    else {
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            x[ i ] = y[ indx[ i ] ];
+        }
+        if (zero) {
+            #pragma omp simd
+            for (int64_t i = 0; i < nz; ++i) {
+                y[ indx[ i ] ] = 0;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by gthr and gthrz. For most types, this is the inline
+/// gthr_kernel, compiled for the application's instruction set.
+/// @ingroup gthr_internal
+template <typename TY, typename TX>
+inline void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    TY* y, TX* x, int64_t const* indx )
+{
+    gthr_kernel( zero, nz, y, x, indx );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    float* y, float* x, int64_t const* indx );
+
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    double* y, double* x, int64_t const* indx );
+
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    std::complex<float>* y, std::complex<float>* x, int64_t const* indx );
+
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    std::complex<double>* y, std::complex<double>* x, int64_t const* indx );
+
+}  // namespace internal
+
+// =============================================================================
+/// Gather dense vector into sparse vector, $x = y(indx)$, that is,
+/// $x_i = y_{indx_i}$ for i = 0, ..., nz-1,
+/// where x is a sparse vector in compressed form with nonzeros x and
+/// indices indx, and y is a dense vector.
+/// @see gthrz to also zero y(indx).
+/// @see sctr for the inverse operation.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///
+/// @param[out] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///
+/// @ingroup gthr
+
+template <typename TY, typename TX>
+void gthr(
+    int64_t nz,
+    TY const *y,
+    TX       *x, int64_t const *indx )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    // Each thread gathers a contiguous part of the index list.
+    // y is not written when zero = false.
+    int nthreads = internal::parallel_num_threads( nz );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( nz, nthreads, t     );
+        int64_t i1 = internal::parallel_part( nz, nthreads, t + 1 );
+        internal::gthr_kernel_simd( false, i1 - i0, const_cast<TY*>( y ),
+                                    &x[ i0 ], &indx[ i0 ] );
+    }
+}
+
+// =============================================================================
+/// Gather dense vector into sparse vector and zero gathered elements,
+/// $x = y(indx)$, then $y(indx) = 0$.
+/// This is useful to reset a dense work vector after accumulating
+/// a sparse result in it.
+/// @see gthr to not change y.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in, out] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///     On exit, y(indx) = 0.
+///
+/// @param[out] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///     Indices must be distinct.
+///
+/// @ingroup gthr
+
+template <typename TY, typename TX>
+void gthrz(
+    int64_t nz,
+    TY *y,
+    TX *x, int64_t const *indx )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    // As indices are distinct, each thread gathers and zeros
+    // a contiguous part of the index list independently.
+    int nthreads = internal::parallel_num_threads( nz );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( nz, nthreads, t     );
+        int64_t i1 = internal::parallel_part( nz, nthreads, t + 1 );
+        internal::gthr_kernel_simd( true, i1 - i0, y,
+                                    &x[ i0 ], &indx[ i0 ] );
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_GTHR_HH
@@ -8,6 +8,8 @@
 
 #include "blas/util.hh"
 #include "blas/syr2k.hh"
+#include "blas/gemm.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
@@ -26,6 +28,7 @@ namespace blas {
 /// and A and B are n-by-k or k-by-n matrices.
 ///
 /// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -205,7 +208,62 @@ void her2k(
     }
 
     // alpha != zero
-    if (trans == Op::NoTrans) {
+    int nthreads = internal::parallel_num_threads( n*n*k );
+    if (nthreads > 1) {
+        // 2-D partition of C into nb-by-nb tiles; only tiles in the
+        // stored triangle are computed: diagonal tiles by a serial her2k,
+        // off-diagonal tiles by gemm. Tiles are serial, since nested calls
+        // are inside the OpenMP parallel region.
+        int64_t nb = internal::parallel_triangle_blocks( nthreads, n );
+        bool lower = (uplo == Uplo::Lower);
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( dynamic )
+        for (int64_t ij = 0; ij < nb*nb; ++ij) {
+            int64_t bi = ij % nb;
+            int64_t bj = ij / nb;
+            if (lower ? bi < bj : bi > bj)
+                continue;
+
+            int64_t i0 = internal::parallel_part( n, nb, bi     );
+            int64_t i1 = internal::parallel_part( n, nb, bi + 1 );
+            int64_t j0 = internal::parallel_part( n, nb, bj     );
+            int64_t j1 = internal::parallel_part( n, nb, bj + 1 );
+            int64_t ib = i1 - i0;
+            int64_t jb = j1 - j0;
+            if (bi == bj) {
+                // C(I, I) is a serial her2k
+                TA const* Ai = (trans == Op::NoTrans ? &A(i0, 0) : &A(0, i0));
+                TB const* Bi = (trans == Op::NoTrans ? &B(i0, 0) : &B(0, i0));
+                her2k<TA, TB, TC>( Layout::ColMajor, uplo, trans, ib, k,
+                            alpha, Ai, lda, Bi, ldb, beta, &C(i0, i0), ldc );
+            }
+            else {
+                // C(I, J) = alpha op(A)(I, :) op(B)(J, :)^H
+                //         + conj(alpha) op(B)(I, :) op(A)(J, :)^H + beta C(I, J)
+                if (trans == Op::NoTrans) {
+                    gemm<TA, TB, TC>( Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                                      ib, jb, k,
+                                      alpha, &A(i0, 0), lda, &B(j0, 0), ldb,
+                                      beta, &C(i0, j0), ldc );
+                    gemm<TB, TA, TC>( Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                                      ib, jb, k,
+                                      conj( alpha ), &B(i0, 0), ldb, &A(j0, 0), lda,
+                                      one, &C(i0, j0), ldc );
+                }
+                else {
+                    gemm<TA, TB, TC>( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                      ib, jb, k,
+                                      alpha, &A(0, i0), lda, &B(0, j0), ldb,
+                                      beta, &C(i0, j0), ldc );
+                    gemm<TB, TA, TC>( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                      ib, jb, k,
+                                      conj( alpha ), &B(0, i0), ldb, &A(0, j0), lda,
+                                      one, &C(i0, j0), ldc );
+                }
+            }
+        }
+    }
+    else if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
             for (int64_t j = 0; j < n; ++j) {
@@ -7,11 +7,84 @@
 #define BLAS_IAMAX_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of iamax. Finds the largest |x_i| of each block in
+/// a loop that vectorizes, then searches for its index only in the first
+/// block with the overall largest, so ties resolve to the first index.
+/// As in iamax, NaN values are skipped.
+/// @return index, or -1 if n = 0 or all values are NaN.
+/// @ingroup iamax_internal
+template <typename T>
+int64_t iamax_kernel( int64_t n, T const* x )
+{
+    using scalar_t = scalar_type<T>;
+    using real_t = real_type<T>;
+    const int64_t nb = 256;
+
+    real_t result = -1;
+    int64_t k_max = -1;
+    for (int64_t k = 0; k < n; k += nb) {
+        int64_t k_end = std::min( k + nb, n );
+        real_t block_max = -1;
+        if constexpr (std::is_floating_point_v<real_t>) {
+            // NaN is replaced explicitly, as max reductions may not skip it.
+            #pragma omp simd reduction(max: block_max)
+            for (int64_t i = k; i < k_end; ++i) {
+                real_t tmp = abs1( scalar_t( x[i] ) );
+                block_max = std::max( block_max, tmp == tmp ? tmp : -1 );
+            }
+        }
+        else {
+            for (int64_t i = k; i < k_end; ++i) {
+                real_t tmp = abs1( scalar_t( x[i] ) );
+                block_max = (tmp > block_max ? tmp : block_max);
+            }
+        }
+        if (block_max > result) {
+            result = block_max;
+            k_max = k;
+        }
+    }
+    if (k_max < 0)
+        return -1;
+
+    int64_t index = k_max;
+    while (abs1( scalar_t( x[index] ) ) != result) {
+        ++index;
+    }
+    return index;
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by iamax. For most types, this is the inline
+/// iamax_kernel, compiled for the application's instruction set.
+/// @ingroup iamax_internal
+template <typename T>
+inline int64_t iamax_kernel_simd( int64_t n, T const* x )
+{
+    return iamax_kernel( n, x );
+}
+
+/// For float16 and bfloat16, the kernel is compiled in the library in
+/// variants for several instruction sets, selected at runtime.
+/// See set_simd_isa.
+int64_t iamax_kernel_simd( int64_t n, float16 const* x );
+
+int64_t iamax_kernel_simd( int64_t n, bfloat16 const* x );
+
+}  // namespace internal
+
 // =============================================================================
 /// @return Index of infinity-norm of vector, $|| x ||_{inf}$,
 ///     $\text{argmax}_{i=0}^{n-1} |Re(x_i)| + |Im(x_i)|$.
@@ -41,18 +114,38 @@ int64_t iamax(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread searches a contiguous part. Parts are compared in
+        // order with >, so ties resolve to the first index, as in serial.
+        std::vector<int64_t> partial( nthreads );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            int64_t k = iamax< T >( i1 - i0, &x[ i0*incx ], incx );
+            partial[ t ] = (k < 0 ? -1 : i0 + k);
+        }
+        real_t result = -1;
+        int64_t index = -1;
+        for (int t = 0; t < nthreads; ++t) {
+            if (partial[ t ] >= 0) {
+                real_t tmp = abs1( x[ partial[ t ]*incx ] );
+                if (tmp > result) {
+                    result = tmp;
+                    index = partial[ t ];
+                }
+            }
+        }
+        return index;
+    }
+
     // todo: check NAN
     real_t result = -1;
     int64_t index = -1;
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            real_t tmp = abs1( x[i] );
-            if (tmp > result) {
-                result = tmp;
-                index = i;
-            }
-        }
+        index = internal::iamax_kernel_simd( n, x );
     }
     else {
         // non-unit stride
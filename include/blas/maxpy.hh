@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_MAXPY_HH
+#define BLAS_MAXPY_HH
+
+#include "blas/util.hh"
+#include "blas/mdot.hh"
+#include "blas/parallel.hh"
+
+#include <vector>
+
+namespace blas {
+
+// =============================================================================
+/// Add multiple scaled vectors, $y = \sum_j \alpha_j x_j + y$ for the
+/// columns $x_j$ of X, that is, $y = X \alpha + y$.
+/// Unlike k calls to axpy, y is read and written only once. For instance,
+/// in GMRES the classical Gram-Schmidt update $w = w - V h$ is
+/// `maxpy( n, k, minus_h, V, ldv, w, 1 )`, with minus_h = -h.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] n
+///     Number of elements in each vector. n >= 0.
+///
+/// @param[in] k
+///     Number of vectors x_j, i.e., columns of X. k >= 0.
+///
+/// @param[in] alpha
+///     The k-element vector of scalars alpha_j.
+///
+/// @param[in] X
+///     The n-by-k column-major matrix X, in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     Leading dimension of X. ldx >= max( 1, n ).
+///
+/// @param[in, out] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///     y must not overlap X.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @ingroup maxpy
+
+template <typename TX, typename TY>
+void maxpy(
+    int64_t n, int64_t k,
+    scalar_type<TX, TY> const* alpha,
+    TX const *X, int64_t ldx,
+    TY       *y, int64_t incy )
+{
+    typedef scalar_type<TX, TY> scalar_t;
+
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( ldx < max( 1, n ) );
+    blas_error_if( incy == 0 );
+
+    int nthreads = internal::parallel_num_threads( n*k );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous block of rows of X and y.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            maxpy< TX, TY >( i1 - i0, k, alpha, &X[ i0 ], ldx,
+                             internal::vector_block( y, n, incy, i0, i1 - i0 ), incy );
+        }
+        return;
+    }
+
+    // y(i) is y0[ i*incy ]
+    TY* y0 = &y[ incy > 0 ? 0 : (-n + 1)*incy ];
+
+    // If y is strided, each block is copied to a contiguous workspace,
+    // updated, then copied back.
+    const int64_t nb = internal::multi_vector_block;
+    std::vector<TY> work( incy == 1 ? 0 : min( nb, n ) );
+
+    for (int64_t i0 = 0; i0 < n; i0 += nb) {
+        int64_t ib = min( nb, n - i0 );
+        TY* yb = &y0[ i0*incy ];
+        if (incy != 1) {
+            for (int64_t i = 0; i < ib; ++i)
+                work[ i ] = yb[ i*incy ];
+            yb = work.data();
+        }
+
+        // 4 columns at a time, so each y(i) is updated once for 4 columns.
+        // y must not overlap X, so the loops can be vectorized.
+        int64_t j = 0;
+        for (; j + 4 <= k; j += 4) {
+            TX const* x0 = &X[ i0 + (j    )*ldx ];
+            TX const* x1 = &X[ i0 + (j + 1)*ldx ];
+            TX const* x2 = &X[ i0 + (j + 2)*ldx ];
+            TX const* x3 = &X[ i0 + (j + 3)*ldx ];
+            scalar_t a0 = alpha[ j     ];
+            scalar_t a1 = alpha[ j + 1 ];
+            scalar_t a2 = alpha[ j + 2 ];
+            scalar_t a3 = alpha[ j + 3 ];
+            #pragma omp simd
+            for (int64_t i = 0; i < ib; ++i) {
+                yb[ i ] += a0*x0[ i ] + a1*x1[ i ] + a2*x2[ i ] + a3*x3[ i ];
+            }
+        }
+        for (; j < k; ++j) {
+            TX const* x0 = &X[ i0 + j*ldx ];
+            scalar_t a0 = alpha[ j ];
+            #pragma omp simd
+            for (int64_t i = 0; i < ib; ++i) {
+                yb[ i ] += a0*x0[ i ];
+            }
+        }
+
+        if (incy != 1) {
+            TY* yb_orig = &y0[ i0*incy ];
+            for (int64_t i = 0; i < ib; ++i)
+                yb_orig[ i*incy ] = work[ i ];
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_MAXPY_HH
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_MDOT_HH
+#define BLAS_MDOT_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block size for mdot and maxpy. Each block of y is reused from L1 cache
+/// for every column of X, so y streams through memory only once.
+const int64_t multi_vector_block = 512;
+
+//------------------------------------------------------------------------------
+/// Adds $x_j^H y$ to r_j for j = 0, ..., 3, for one block of n elements,
+/// with x_j and y contiguous. Each y(i) is loaded once for 4 products.
+/// @ingroup mdot_internal
+template <typename TX, typename TY>
+void mdot4(
+    int64_t n,
+    TX const* x0, TX const* x1, TX const* x2, TX const* x3,
+    TY const* y,
+    scalar_type<TX, TY>* r )
+{
+    typedef scalar_type<TX, TY> scalar_t;
+
+    scalar_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    if constexpr (std::is_floating_point< scalar_t >::value) {
+        // Reordering the sums lets them vectorize.
+        #pragma omp simd reduction(+: s0, s1, s2, s3)
+        for (int64_t i = 0; i < n; ++i) {
+            s0 += x0[ i ] * y[ i ];
+            s1 += x1[ i ] * y[ i ];
+            s2 += x2[ i ] * y[ i ];
+            s3 += x3[ i ] * y[ i ];
+        }
+    }
+    else {
+        for (int64_t i = 0; i < n; ++i) {
+            s0 += conj( x0[ i ] ) * y[ i ];
+            s1 += conj( x1[ i ] ) * y[ i ];
+            s2 += conj( x2[ i ] ) * y[ i ];
+            s3 += conj( x3[ i ] ) * y[ i ];
+        }
+    }
+    r[ 0 ] += s0;
+    r[ 1 ] += s1;
+    r[ 2 ] += s2;
+    r[ 3 ] += s3;
+}
+
+//------------------------------------------------------------------------------
+/// Adds $x^H y$ to r, for one block of n elements, with x and y contiguous.
+/// @ingroup mdot_internal
+template <typename TX, typename TY>
+void mdot1(
+    int64_t n,
+    TX const* x,
+    TY const* y,
+    scalar_type<TX, TY>* r )
+{
+    typedef scalar_type<TX, TY> scalar_t;
+
+    scalar_t s = 0;
+    if constexpr (std::is_floating_point< scalar_t >::value) {
+        #pragma omp simd reduction(+: s)
+        for (int64_t i = 0; i < n; ++i) {
+            s += x[ i ] * y[ i ];
+        }
+    }
+    else {
+        for (int64_t i = 0; i < n; ++i) {
+            s += conj( x[ i ] ) * y[ i ];
+        }
+    }
+    *r += s;
+}
+
+}  // namespace internal
+
+// =============================================================================
+/// Multiple dot products, $r_j = x_j^H y$ for each column $x_j$ of X,
+/// that is, $r = X^H y$.
+/// Unlike k calls to dot, y is read only once. For instance, in GMRES the
+/// classical Gram-Schmidt coefficients $h = V^H w$ are
+/// `mdot( n, k, V, ldv, w, 1, h )`.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] n
+///     Number of elements in each vector. n >= 0.
+///
+/// @param[in] k
+///     Number of vectors x_j, i.e., columns of X. k >= 0.
+///
+/// @param[in] X
+///     The n-by-k column-major matrix X, in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     Leading dimension of X. ldx >= max( 1, n ).
+///
+/// @param[in] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @param[out] result
+///     The k-element vector r, with $r_j = x_j^H y$.
+///
+/// @ingroup mdot
+
+template <typename TX, typename TY>
+void mdot(
+    int64_t n, int64_t k,
+    TX const *X, int64_t ldx,
+    TY const *y, int64_t incy,
+    scalar_type<TX, TY>* result )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( ldx < max( 1, n ) );
+    blas_error_if( incy == 0 );
+
+    int nthreads = internal::parallel_num_threads( n*k );
+    if (nthreads > 1) {
+        // Each thread takes a contiguous block of rows of X and y;
+        // the threads' k-vectors of partial sums are added in order.
+        std::vector< scalar_type<TX, TY> > partial( nthreads*k );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            mdot< TX, TY >( i1 - i0, k, &X[ i0 ], ldx,
+                            internal::vector_block( y, n, incy, i0, i1 - i0 ), incy,
+                            &partial[ t*k ] );
+        }
+        for (int64_t j = 0; j < k; ++j) {
+            result[ j ] = 0;
+            for (int t = 0; t < nthreads; ++t)
+                result[ j ] += partial[ t*k + j ];
+        }
+        return;
+    }
+
+    for (int64_t j = 0; j < k; ++j)
+        result[ j ] = 0;
+
+    // y(i) is y0[ i*incy ]
+    TY const* y0 = &y[ incy > 0 ? 0 : (-n + 1)*incy ];
+
+    // If y is strided, each block is copied to a contiguous workspace.
+    const int64_t nb = internal::multi_vector_block;
+    std::vector<TY> work( incy == 1 ? 0 : min( nb, n ) );
+
+    for (int64_t i0 = 0; i0 < n; i0 += nb) {
+        int64_t ib = min( nb, n - i0 );
+        TY const* yb = &y0[ i0*incy ];
+        if (incy != 1) {
+            for (int64_t i = 0; i < ib; ++i)
+                work[ i ] = yb[ i*incy ];
+            yb = work.data();
+        }
+
+        int64_t j = 0;
+        for (; j + 4 <= k; j += 4) {
+            internal::mdot4( ib, &X[ i0 + (j    )*ldx ], &X[ i0 + (j + 1)*ldx ],
+                                 &X[ i0 + (j + 2)*ldx ], &X[ i0 + (j + 3)*ldx ],
+                             yb, &result[ j ] );
+        }
+        for (; j < k; ++j) {
+            internal::mdot1( ib, &X[ i0 + j*ldx ], yb, &result[ j ] );
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_MDOT_HH
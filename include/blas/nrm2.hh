@@ -7,17 +7,199 @@
 #define BLAS_NRM2_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
+#include <cmath>
 #include <limits>
+#include <vector>
 
 namespace blas {
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Scaling constants for Blue's algorithm, as in LAPACK 3.10 dnrm2
+/// (Anderson, Algorithm 978). Values |x| < tsml are scaled up by ssml,
+/// and values |x| > tbig are scaled down by sbig, before squaring,
+/// so their squares neither underflow nor overflow.
+/// @ingroup nrm2_internal
+template <typename real_t>
+struct Nrm2Constants
+{
+    real_t tsml, tbig, ssml, sbig;
+
+    Nrm2Constants()
+    {
+        using std::pow;
+        using std::ceil;
+        using std::floor;
+        const real_t radix = std::numeric_limits<real_t>::radix;
+        const int minexp   = std::numeric_limits<real_t>::min_exponent;
+        const int maxexp   = std::numeric_limits<real_t>::max_exponent;
+        const int digits   = std::numeric_limits<real_t>::digits;
+
+        tsml = pow( radix,  int( ceil(  (minexp - 1) * 0.5 ) ) );
+        tbig = pow( radix,  int( floor( (maxexp - digits + 1) * 0.5 ) ) );
+        ssml = pow( radix, -int( floor( (minexp - digits) * 0.5 ) ) );
+        sbig = pow( radix, -int( ceil(  (maxexp + digits - 1) * 0.5 ) ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Adds a^2, for a = |Re(x_i)| or |Im(x_i)|, to one of the accumulators
+/// asml, amed, abig for tiny, mid-range, and huge values, scaled by
+/// Nrm2Constants. Branch-free, as in the LAPACK reference.
+/// NaN fails both comparisons, so it propagates through amed.
+/// @ingroup nrm2_internal
+template <typename real_t>
+inline void nrm2_add(
+    real_t a, Nrm2Constants<real_t> const& c,
+    real_t& asml, real_t& amed, real_t& abig )
+{
+    const real_t zero = 0;
+    bool big = a > c.tbig;
+    bool sml = a < c.tsml;
+    real_t ab = a * c.sbig;
+    real_t as = a * c.ssml;
+    abig += (big ? ab*ab : zero);
+    asml += (sml ? as*as : zero);
+    amed += (big || sml ? zero : a*a);
+}
+
+//------------------------------------------------------------------------------
+/// Block size for nrm2_sums. A block that fails the fast path is summed
+/// again, from L1 cache, with the scaled accumulators.
+const int64_t nrm2_block = 512;
+
+//------------------------------------------------------------------------------
+/// Fast path of nrm2_sums: sets sum = sum_i |x_i|^2 for the n-element
+/// vector x, without scaling.
+/// @return true if every nonzero |Re(x_i)|, |Im(x_i)| is in the mid range
+/// [tsml, tbig], so sum is accurate; otherwise the caller must rescan x.
+/// Only for built-in floating-point types, which OpenMP can reduce.
+/// @ingroup nrm2_internal
+template <typename T>
+bool nrm2_sum_mid(
+    int64_t n,
+    T const* x, int64_t incx,
+    real_type<T> tsml, real_type<T> tbig,
+    real_type<T>& sum )
+{
+    using std::abs;
+    using std::max;
+    using std::min;
+    using real_t = real_type<T>;
+
+    // Zeros are replaced by tsml for amin, as they add nothing to any sum.
+    // NaN is skipped by max, min, but propagates through s.
+    real_t s = 0, amax = 0, amin = tbig;
+    #pragma omp simd reduction(+: s) reduction(max: amax) reduction(min: amin)
+    for (int64_t i = 0; i < n; ++i) {
+        real_t re = abs( real( x[ i*incx ] ) );
+        s += re*re;
+        amax = max( amax, re );
+        amin = min( amin, re == 0 ? tsml : re );
+        if constexpr (is_complex_v<T>) {
+            real_t im = abs( imag( x[ i*incx ] ) );
+            s += im*im;
+            amax = max( amax, im );
+            amin = min( amin, im == 0 ? tsml : im );
+        }
+    }
+    sum = s;
+    return amin >= tsml && amax <= tbig;
+}
+
+//------------------------------------------------------------------------------
+/// Adds |x_i|^2 for the n-element vector x to the accumulators
+/// asml, amed, abig, as in nrm2_add.
+///
+/// For built-in floating-point types, each block of x is first summed
+/// without scaling, along with its largest and smallest magnitudes, which
+/// vectorizes nearly as well as a plain sum of squares. Only blocks with
+/// tiny or huge values are summed again with the scaled accumulators.
+/// @ingroup nrm2_internal
+template <typename T>
+void nrm2_sums(
+    int64_t n,
+    T const* x, int64_t incx,
+    Nrm2Constants< real_type<T> > const& c,
+    real_type<T>& asml, real_type<T>& amed, real_type<T>& abig )
+{
+    using std::abs;
+    using real_t = real_type<T>;
+
+    for (int64_t i0 = 0; i0 < n; i0 += nrm2_block) {
+        int64_t ib = min( nrm2_block, n - i0 );
+        T const* xb = &x[ i0*incx ];
+
+        if constexpr (std::is_floating_point< real_t >::value) {
+            real_t sum;
+            if (nrm2_sum_mid( ib, xb, incx, c.tsml, c.tbig, sum )) {
+                amed += sum;
+                continue;
+            }
+        }
+        // sum each block separately, to limit the growth of rounding errors
+        real_t sml = 0, med = 0, big = 0;
+        for (int64_t i = 0; i < ib; ++i) {
+            nrm2_add( real_t( abs( real( xb[ i*incx ] ) ) ), c, sml, med, big );
+            if constexpr (is_complex_v<T>)
+                nrm2_add( real_t( abs( imag( xb[ i*incx ] ) ) ), c, sml, med, big );
+        }
+        asml += sml;
+        amed += med;
+        abig += big;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return 2-norm from the accumulators of nrm2_sums.
+/// If abig is nonzero, asml is negligible; otherwise, if both asml and amed
+/// are nonzero, they are combined without overflow as in LAPACK.
+/// @ingroup nrm2_internal
+template <typename real_t>
+real_t nrm2_combine(
+    real_t asml, real_t amed, real_t abig,
+    Nrm2Constants<real_t> const& c )
+{
+    using std::sqrt;
+
+    const real_t one = 1;
+    bool amed_nan = (amed != amed);
+    if (abig > 0) {
+        if (amed > 0 || amed_nan)
+            abig += (amed * c.sbig) * c.sbig;
+        return (one / c.sbig) * sqrt( abig );
+    }
+    else if (asml > 0) {
+        if (amed > 0 || amed_nan) {
+            amed = sqrt( amed );
+            asml = sqrt( asml ) / c.ssml;
+            real_t ymin = (asml > amed ? amed : asml);
+            real_t ymax = (asml > amed ? asml : amed);
+            real_t r = ymin / ymax;
+            return sqrt( ymax*ymax * (one + r*r) );
+        }
+        return (one / c.ssml) * sqrt( asml );
+    }
+    else {
+        return sqrt( amed );
+    }
+}
+
+}  // namespace internal
+
 // =============================================================================
 /// @return 2-norm of vector,
 ///     $|| x ||_2 = (\sum_{i=0}^{n-1} |x_i|^2)^{1/2}$.
 ///
 /// Generic implementation for arbitrary data types.
-/// TODO: generic implementation does not currently scale to avoid over- or underflow.
+/// Uses Blue's algorithm in one pass, as in LAPACK 3.10, accumulating
+/// squares of tiny, mid-range, and huge values separately, each scaled so
+/// it can't under- or overflow. Blocks with only mid-range values take a
+/// vectorized fast path. Long vectors are split among OpenMP threads,
+/// see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] n
 ///     Number of elements in x. n >= 0.
@@ -36,30 +218,36 @@ nrm2(
     int64_t n,
     T const * x, int64_t incx )
 {
-    using std::sqrt;
     using real_t = real_type<T>;
 
     // check arguments
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
-    // todo: scale to avoid overflow & underflow
-    real_t result = 0;
-    if (incx == 1) {
-        // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            result += real(x[i]) * real(x[i]) + imag(x[i]) * imag(x[i]);
+    static const internal::Nrm2Constants<real_t> c;
+    real_t asml = 0, amed = 0, abig = 0;
+
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread sums a contiguous part; parts are added in order.
+        std::vector<real_t> sums( 3*nthreads, real_t( 0 ) );
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            internal::nrm2_sums( i1 - i0, &x[ i0*incx ], incx, c,
+                                 sums[ 3*t ], sums[ 3*t + 1 ], sums[ 3*t + 2 ] );
+        }
+        for (int t = 0; t < nthreads; ++t) {
+            asml += sums[ 3*t     ];
+            amed += sums[ 3*t + 1 ];
+            abig += sums[ 3*t + 2 ];
         }
     }
     else {
-        // non-unit stride
-        int64_t ix = 0;
-        for (int64_t i = 0; i < n; ++i) {
-            result += real(x[ix]) * real(x[ix]) + imag(x[ix]) * imag(x[ix]);
-            ix += incx;
-        }
+        internal::nrm2_sums( n, x, incx, c, asml, amed, abig );
     }
-    return sqrt( result );
+    return internal::nrm2_combine( asml, amed, abig, c );
 }
 
 }  // namespace blas
@@ -0,0 +1,274 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_PARALLEL_HH
+#define BLAS_PARALLEL_HH
+
+#include "blas/util.hh"
+
+#include <cmath>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace blas {
+
+//------------------------------------------------------------------------------
+/// Sets the number of OpenMP threads used by the generic template
+/// implementations in BLAS++, e.g., gemm with mixed precisions.
+/// This does not affect the vendor BLAS library, which has its own setting.
+///
+/// @param[in] num_threads
+///     Number of threads. If num_threads <= 0, resets to the default,
+///     which is omp_get_max_threads() at the time of each call.
+///
+void set_num_threads( int num_threads );
+
+//------------------------------------------------------------------------------
+/// @return number of OpenMP threads used by the generic template
+/// implementations in BLAS++; 1 if BLAS++ was compiled without OpenMP.
+/// @see set_num_threads
+///
+int get_num_threads();
+
+//------------------------------------------------------------------------------
+/// Sets the minimum problem size, in multiply-adds, for the generic template
+/// implementations to run in parallel. For instance, gemm is m*n*k and
+/// gemv is m*n multiply-adds. Smaller problems run on one thread, as the
+/// cost of starting threads would exceed the gain.
+///
+/// Level 1 templates (axpy, scal, copy, dot, asum, iamax, nrm2, and the
+/// fused routines) count n operations for n elements. Above the threshold,
+/// each thread takes one contiguous part of the vectors, with static
+/// scheduling, so with first-touch page placement a thread mostly reads
+/// memory local to its socket. Per-thread partial sums are added in thread
+/// order, so results are deterministic for a given number of threads.
+///
+/// @param[in] threshold
+///     Minimum number of multiply-adds. Default 262144, i.e., 64^3.
+///
+void set_parallel_threshold( int64_t threshold );
+
+//------------------------------------------------------------------------------
+/// @return minimum problem size, in multiply-adds, to run in parallel.
+/// @see set_parallel_threshold
+///
+int64_t get_parallel_threshold();
+
+//------------------------------------------------------------------------------
+/// Sets the size below which the CPU gemm, gemv, axpy, dot, and dotu
+/// use inline, vectorized kernels in BLAS++, instead of calling the vendor
+/// BLAS. For tiny problems, the Fortran interface, which passes every
+/// argument by pointer, costs more than the arithmetic.
+/// - gemm uses the inline kernel if all of m, n, k <= threshold.
+/// - gemv uses the inline kernel if both m, n <= threshold.
+/// - axpy, dot, dotu use the inline kernel if n <= threshold^2,
+///   the same number of elements as a small gemv.
+///
+/// Run the gemm-small, gemv-small, axpy-small, and dot-small testers to
+/// find the crossover on a given machine and BLAS library.
+///
+/// @param[in] threshold
+///     Largest dimension for inline kernels. Default 4.
+///     If threshold <= 0, always calls the vendor BLAS.
+///
+void set_small_threshold( int64_t threshold );
+
+//------------------------------------------------------------------------------
+/// @return largest dimension for which inline kernels are used.
+/// @see set_small_threshold
+///
+int64_t get_small_threshold();
+
+//------------------------------------------------------------------------------
+/// Sets the largest dimension or vector length passed to the vendor BLAS
+/// in one call. With a 32-bit blas_int (LP64), the default is INT_MAX, and
+/// larger problems are split into blocks that fit in blas_int:
+/// - Level 1 routines split vectors into chunks, combining partial
+///   results of dot, dotu, asum, nrm2, and iamax.
+/// - gemv and ger split A into blocks of rows and columns.
+/// - gemm splits C into blocks of rows and columns, and k into blocks
+///   that accumulate with beta = 1.
+/// - symm, hemm, trmm, trsm split the dimension of B not involving A;
+///   syrk, herk, syr2k, her2k split k.
+///
+/// Leading dimensions and increments cannot be split, so still must fit
+/// in blas_int. Lowering the split size below the default only adds
+/// overhead; it is useful for testing.
+///
+/// @param[in] size
+///     Largest dimension per call. If size <= 0 or greater than the
+///     largest blas_int, resets to the largest blas_int.
+///
+void set_split_size( int64_t size );
+
+//------------------------------------------------------------------------------
+/// @return largest dimension or vector length passed to the vendor BLAS
+/// in one call.
+/// @see set_split_size
+///
+int64_t get_split_size();
+
+//------------------------------------------------------------------------------
+/// Enables reproducible mode, in which the CPU dot, dotu, nrm2, asum, gemv,
+/// and gemm give bitwise identical results regardless of the number of
+/// threads, for all precisions. Vendor BLAS libraries may split reductions
+/// differently depending on their thread count, changing the rounding.
+///
+/// In reproducible mode, these routines bypass the vendor BLAS and sum in
+/// a fixed order that depends only on the problem dimensions:
+/// - dot, nrm2, asum sum fixed blocks of 4096 elements, each with
+///   8 interleaved partial sums, then sum the blocks in order.
+///   Blocks are summed in parallel. nrm2 scales by a power of 2 to avoid
+///   overflow, or accumulates in double for float.
+/// - gemv sums each y_i in the order of the columns of op(A),
+///   in parallel over blocks of rows of op(A).
+/// - gemm uses the generic gemm template with its blocked engine,
+///   which sums each C_ij in a fixed order, in parallel over tiles of C.
+///
+/// Results are reproducible for a given build of BLAS++ on a given
+/// instruction set. Compiler flags that change the vector width or
+/// enable fused multiply-add can change the rounding between builds.
+///
+/// Overhead relative to OpenBLAS 0.3, on one core with AVX-512:
+/// dot, nrm2, asum at about the same speed, as they are memory bound;
+/// gemv about 1.1x;
+/// gemm about 5x for double, as the generic engine isn't tuned
+/// to the level of vendor assembly kernels.
+///
+/// @param[in] reproducible
+///     True to enable reproducible mode. Default false.
+///
+void set_reproducible( bool reproducible );
+
+//------------------------------------------------------------------------------
+/// @return true if reproducible mode is enabled.
+/// @see set_reproducible
+///
+bool get_reproducible();
+
+//------------------------------------------------------------------------------
+/// Sets the instruction set used by BLAS++'s own CPU kernels: the inline
+/// kernels for tiny gemm, gemv, axpy, dot, and nrm2 (see set_small_threshold),
+/// the micro-kernel of the blocked engine of the generic gemm template
+/// for float and double, and the unit-stride loops of the generic axpy,
+/// scal, copy, dot, asum, iamax, and gemv templates for float16, bfloat16,
+/// and mixed float and double, which the templates call in the library,
+/// whatever -march the application uses.
+/// Each kernel is compiled in variants for several instruction sets, and by
+/// default the best one the CPU supports is selected at startup.
+/// This does not affect the vendor BLAS library, which has its own dispatch.
+///
+/// In reproducible mode, the gemm micro-kernel and the axpy, dot, asum,
+/// and gemv loops always use the generic variant, so results don't depend
+/// on the CPU; see set_reproducible.
+///
+/// @param[in] isa
+///     One of:
+///     - "avx512": AVX-512 F, VL, BW, DQ, with FMA (x86-64),
+///     - "avx2":   AVX2 with FMA (x86-64),
+///     - "generic": the instruction set the library was compiled for,
+///       e.g., SSE2 on x86-64 or NEON on aarch64.
+///     If isa is null, empty, or "auto", resets to the best supported.
+///     Throws Error if isa is unknown or the CPU doesn't support it.
+///
+void set_simd_isa( char const* isa );
+
+//------------------------------------------------------------------------------
+/// @return name of the instruction set used by BLAS++'s own CPU kernels:
+/// "avx512", "avx2", "neon", or "generic". Useful for logging.
+/// @see set_simd_isa
+///
+char const* get_simd_isa();
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return number of threads to use for a problem with ops multiply-adds.
+/// Returns 1 if the problem is below the parallel threshold, if called
+/// from inside an OpenMP parallel region (e.g., from a tile task of an
+/// enclosing parallel template), or if compiled without OpenMP.
+///
+inline int parallel_num_threads( int64_t ops )
+{
+    #ifdef _OPENMP
+        if (ops < get_parallel_threshold() || omp_in_parallel())
+            return 1;
+        return get_num_threads();
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Factors nthreads into an mt-by-nt grid of tiles for an m-by-n matrix,
+/// with mt * nt = nthreads and the tiles as close to square as possible.
+/// Neither dimension is split into more parts than it has rows or columns,
+/// so mt * nt may be less than nthreads.
+///
+inline void parallel_grid(
+    int nthreads, int64_t m, int64_t n,
+    int64_t* mt, int64_t* nt )
+{
+    int64_t best_mt = 1, best_nt = nthreads;
+    double best_ratio = -1;
+    for (int64_t p = 1; p <= nthreads; ++p) {
+        if (nthreads % p != 0)
+            continue;
+        int64_t q = nthreads / p;
+        // aspect ratio of tiles, <= 1; 1 is square
+        double tile_m = double( m ) / p;
+        double tile_n = double( n ) / q;
+        double ratio = min( tile_m, tile_n ) / max( tile_m, tile_n );
+        if (ratio > best_ratio) {
+            best_ratio = ratio;
+            best_mt = p;
+            best_nt = q;
+        }
+    }
+    *mt = max( int64_t( 1 ), min( best_mt, m ) );
+    *nt = max( int64_t( 1 ), min( best_nt, n ) );
+}
+
+//------------------------------------------------------------------------------
+/// @return first index of part i when splitting n items into nparts
+/// contiguous parts, with sizes differing by at most 1.
+/// Part i is [ parallel_part( n, nparts, i ), parallel_part( n, nparts, i+1 ) ).
+///
+inline int64_t parallel_part( int64_t n, int64_t nparts, int64_t i )
+{
+    return (n / nparts) * i + min( i, n % nparts );
+}
+
+//------------------------------------------------------------------------------
+/// @return pointer to elements [i, i + nb) of the n-element vector x,
+/// as an nb-element vector with the same increment incx.
+/// Follows the BLAS convention that, for incx < 0, element 0 is last
+/// in memory, so blocks of x and y line up for any signs of incx, incy.
+/// Used to split vectors into parallel_part blocks, or into blocks
+/// that fit in blas_int.
+///
+template <typename T>
+T* vector_block( T* x, int64_t n, int64_t incx, int64_t i, int64_t nb )
+{
+    return (incx > 0 ? x + i*incx : x + (n - i - nb)*(-incx));
+}
+
+//------------------------------------------------------------------------------
+/// @return number of block rows (and columns) to split an n-by-n
+/// triangular matrix into, so that the nb*(nb + 1)/2 tiles in the
+/// triangle give each of nthreads threads about two tiles.
+///
+inline int64_t parallel_triangle_blocks( int nthreads, int64_t n )
+{
+    int64_t nb = int64_t( std::ceil( (std::sqrt( 16.0*nthreads + 1 ) - 1) / 2 ) );
+    return max( int64_t( 1 ), min( nb, n ) );
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_PARALLEL_HH
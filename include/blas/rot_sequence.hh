@@ -0,0 +1,316 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_ROT_SEQUENCE_HH
+#define BLAS_ROT_SEQUENCE_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+/// Rows (Right) or columns (Left) of A per block in rot_sequence,
+/// which is the vector length of the inner kernel.
+const int64_t rot_sequence_nb = 256;
+
+/// Number of sequences applied together in rot_sequence. The wavefront
+/// touches about 2 columns per sequence, so a block of A with this many
+/// sequences stays in the L2 cache.
+const int64_t rot_sequence_kb = 16;
+
+//------------------------------------------------------------------------------
+/// Applies one rotation to contiguous vectors x and y of length len:
+/// $x = c x + s y$, $y = c y - \bar{s} x$, as in rot.
+/// @ingroup rot_sequence_internal
+template <typename T>
+inline void rot_sequence_apply(
+    int64_t len, real_type<T> c, T s, T* x, T* y )
+{
+    #pragma omp simd
+    for (int64_t i = 0; i < len; ++i) {
+        T xi = x[ i ];
+        T yi = y[ i ];
+        x[ i ] = c*xi + s*yi;
+        y[ i ] = c*yi - conj( s )*xi;
+    }
+}
+
+/// Complex version. Computes with real and imaginary parts, avoiding
+/// the runtime's NaN-checking complex multiply, so the loop vectorizes.
+/// @ingroup rot_sequence_internal
+template <typename T>
+inline void rot_sequence_apply(
+    int64_t len, T c, std::complex<T> s,
+    std::complex<T>* x, std::complex<T>* y )
+{
+    T sr = real( s );
+    T si = imag( s );
+    T* x_ = reinterpret_cast<T*>( x );
+    T* y_ = reinterpret_cast<T*>( y );
+    #pragma omp simd
+    for (int64_t i = 0; i < len; ++i) {
+        T xr = x_[ 2*i ];
+        T xi = x_[ 2*i + 1 ];
+        T yr = y_[ 2*i ];
+        T yi = y_[ 2*i + 1 ];
+        x_[ 2*i     ] = c*xr + sr*yr - si*yi;
+        x_[ 2*i + 1 ] = c*xi + sr*yi + si*yr;
+        y_[ 2*i     ] = c*yr - sr*xr - si*xi;
+        y_[ 2*i + 1 ] = c*yi - sr*xi + si*xr;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Applies k sequences of nrot rotations to the columns of the
+/// len-by-(nrot + 1) column-major matrix A, from the right.
+/// Rotation r of sequence j, (C[ r + j*ldc ], S[ r + j*lds ]),
+/// rotates columns (r, r + 1). Step i of a sequence applies
+/// rotation r = i for forward and r = nrot - 1 - i for backward sequences.
+///
+/// Rotations are applied in wavefront order: wave t applies step
+/// i = t - 2j of each sequence j. This respects the order of all rotations
+/// that share a column, and keeps the columns in use, about 2k of them,
+/// in cache while the wave sweeps across A, so A is read once instead of
+/// k times.
+/// @ingroup rot_sequence_internal
+template <typename TA>
+void rot_sequence_block(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    real_type<TA> const* C, int64_t ldc,
+    TA const* S, int64_t lds,
+    TA* A, int64_t lda )
+{
+    int64_t nwaves = nrot + 2*(k - 1);
+    for (int64_t t = 0; t < nwaves; ++t) {
+        // sequences j with 0 <= t - 2j < nrot
+        int64_t j0 = max( int64_t( 0 ), (t - nrot + 2) / 2 );
+        int64_t j1 = min( k - 1, t / 2 );
+        for (int64_t j = j0; j <= j1; ++j) {
+            int64_t i = t - 2*j;
+            int64_t r = forward ? i : nrot - 1 - i;
+            rot_sequence_apply( len, C[ r + j*ldc ], S[ r + j*lds ],
+                                &A[ r*lda ], &A[ (r + 1)*lda ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Block kernel called by rot_sequence. For most types, this is the
+/// inline rot_sequence_block, compiled for the application's instruction set.
+/// @ingroup rot_sequence_internal
+template <typename TA>
+inline void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    real_type<TA> const* C, int64_t ldc,
+    TA const* S, int64_t lds,
+    TA* A, int64_t lda )
+{
+    rot_sequence_block( forward, len, nrot, k, C, ldc, S, lds, A, lda );
+}
+
+/// For standard types, the block kernel is compiled in the library in
+/// variants for several instruction sets, selected at runtime.
+/// See set_simd_isa.
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    float const* C, int64_t ldc,
+    float const* S, int64_t lds,
+    float* A, int64_t lda );
+
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    double const* C, int64_t ldc,
+    double const* S, int64_t lds,
+    double* A, int64_t lda );
+
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    float const* C, int64_t ldc,
+    std::complex<float> const* S, int64_t lds,
+    std::complex<float>* A, int64_t lda );
+
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    double const* C, int64_t ldc,
+    std::complex<double> const* S, int64_t lds,
+    std::complex<double>* A, int64_t lda );
+
+}  // namespace internal
+
+// =============================================================================
+/// Apply k sequences of plane (Givens) rotations to the m-by-n matrix A,
+/// as in LAPACK's lasr with variable pivot. Each sequence has
+/// nrot = n - 1 rotations for side = Right, or nrot = m - 1 for side = Left.
+/// Rotation i of sequence j, with c = C(i, j) and s = S(i, j),
+/// rotates adjacent columns (Right) or rows (Left) x = A(:, i),
+/// y = A(:, i+1), or x = A(i, :), y = A(i+1, :), as in rot:
+/// $x = c x + s y$, $y = c y - \bar{s} x$.
+/// Sequences are applied in order, j = 0, ..., k-1.
+/// In each sequence, rotations are applied in order i = 0, ..., nrot-1
+/// if direction = Forward, or i = nrot-1, ..., 0 if direction = Backward.
+///
+/// Unlike k*nrot calls to rot, each block of A is read once and all
+/// sequences are applied to it in a cache-friendly wavefront order,
+/// which, for instance, speeds up accumulating the rotations of
+/// the QR iteration into the eigenvectors or singular vectors.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] side
+///     Whether the rotations are applied from the left or right:
+///     - Side::Left:  rotate adjacent rows of A;
+///     - Side::Right: rotate adjacent columns of A.
+///
+/// @param[in] direction
+///     Order of the rotations in each sequence:
+///     Direction::Forward or Direction::Backward.
+///
+/// @param[in] m
+///     Number of rows of A. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of A. n >= 0.
+///
+/// @param[in] k
+///     Number of sequences. k >= 0.
+///
+/// @param[in] C
+///     The nrot-by-k column-major matrix of cosines, in an ldc-by-k array.
+///
+/// @param[in] ldc
+///     Leading dimension of C. ldc >= max( 1, nrot ).
+///
+/// @param[in] S
+///     The nrot-by-k column-major matrix of sines, in an lds-by-k array.
+///
+/// @param[in] lds
+///     Leading dimension of S. lds >= max( 1, nrot ).
+///
+/// @param[in, out] A
+///     The m-by-n matrix A, stored in an lda-by-n array [RowMajor: m-by-lda].
+///     A must not overlap C or S.
+///
+/// @param[in] lda
+///     Leading dimension of A.
+///     - ColMajor: lda >= max( 1, m ).
+///     - RowMajor: lda >= max( 1, n ).
+///
+/// @ingroup rot_sequence
+
+template <typename TA>
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    real_type<TA> const* C, int64_t ldc,
+    TA const* S, int64_t lds,
+    TA* A, int64_t lda )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( side != Side::Left &&
+                   side != Side::Right );
+    blas_error_if( direction != Direction::Forward &&
+                   direction != Direction::Backward );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    int64_t nrot = (side == Side::Left ? m : n) - 1;
+    blas_error_if( ldc < max( 1, nrot ) );
+    blas_error_if( lds < max( 1, nrot ) );
+    if (layout == Layout::ColMajor)
+        blas_error_if( lda < max( 1, m ) );
+    else
+        blas_error_if( lda < max( 1, n ) );
+
+    // quick return
+    if (m == 0 || n == 0 || k == 0 || nrot == 0)
+        return;
+
+    // for row major, swap side and m <=> n
+    if (layout == Layout::RowMajor) {
+        side = (side == Side::Left ? Side::Right : Side::Left);
+        std::swap( m, n );
+    }
+
+    bool forward = (direction == Direction::Forward);
+    const int64_t nb = internal::rot_sequence_nb;
+    const int64_t kb = internal::rot_sequence_kb;
+
+    // Blocks of rows (Right) or columns (Left) are independent.
+    int64_t len = (side == Side::Right ? m : n);
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    if (nthreads > 1) {
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( len, nthreads, t     );
+            int64_t i1 = internal::parallel_part( len, nthreads, t + 1 );
+            if (side == Side::Right) {
+                rot_sequence< TA >( Layout::ColMajor, side, direction,
+                                    i1 - i0, n, k, C, ldc, S, lds,
+                                    &A[ i0 ], lda );
+            }
+            else {
+                rot_sequence< TA >( Layout::ColMajor, side, direction,
+                                    m, i1 - i0, k, C, ldc, S, lds,
+                                    &A[ i0*lda ], lda );
+            }
+        }
+        return;
+    }
+
+    if (side == Side::Right) {
+        // Rotations are applied to contiguous columns of each block of rows.
+        for (int64_t i0 = 0; i0 < m; i0 += nb) {
+            int64_t ib = min( nb, m - i0 );
+            for (int64_t j0 = 0; j0 < k; j0 += kb) {
+                int64_t jb = min( kb, k - j0 );
+                internal::rot_sequence_block_simd(
+                    forward, ib, nrot, jb,
+                    &C[ j0*ldc ], ldc, &S[ j0*lds ], lds,
+                    &A[ i0 ], lda );
+            }
+        }
+    }
+    else {
+        // Rows of A are strided, so each block of columns is transposed
+        // into a workspace W, where rows of A are contiguous columns of W,
+        // rotated from the right, then transposed back.
+        std::vector<TA> W( min( nb, n ) * m );
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t jb = min( nb, n - j0 );
+            for (int64_t i = 0; i < m; ++i)
+                for (int64_t j = 0; j < jb; ++j)
+                    W[ j + i*jb ] = A[ i + (j0 + j)*lda ];
+
+            for (int64_t l0 = 0; l0 < k; l0 += kb) {
+                int64_t lb = min( kb, k - l0 );
+                internal::rot_sequence_block_simd(
+                    forward, jb, nrot, lb,
+                    &C[ l0*ldc ], ldc, &S[ l0*lds ], lds,
+                    W.data(), jb );
+            }
+
+            for (int64_t j = 0; j < jb; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    A[ i + (j0 + j)*lda ] = W[ j + i*jb ];
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_ROT_SEQUENCE_HH
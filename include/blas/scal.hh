@@ -7,11 +7,45 @@
 #define BLAS_SCAL_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Unit-stride loop of scal, x = alpha x.
+/// @ingroup scal_internal
+template <typename T>
+void scal_kernel( int64_t n, T alpha, T* x )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        x[i] *= alpha;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by scal. For most types, this is the inline
+/// scal_kernel, compiled for the application's instruction set.
+/// @ingroup scal_internal
+template <typename T>
+inline void scal_kernel_simd( int64_t n, T alpha, T* x )
+{
+    scal_kernel( n, alpha, x );
+}
+
+/// For float16 and bfloat16, the kernel is compiled in the library in
+/// variants for several instruction sets, selected at runtime.
+/// See set_simd_isa.
+void scal_kernel_simd( int64_t n, float16 alpha, float16* x );
+
+void scal_kernel_simd( int64_t n, bfloat16 alpha, bfloat16* x );
+
+}  // namespace internal
+
 // =============================================================================
 /// Scale vector by constant, $x = \alpha x$.
 ///
@@ -41,11 +75,21 @@ void scal(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous part of x.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            scal< T >( i1 - i0, alpha, &x[ i0*incx ], incx );
+        }
+        return;
+    }
+
     if (incx == 1) {
         // unit stride
-        for (int64_t i = 0; i < n; ++i) {
-            x[i] *= alpha;
-        }
+        internal::scal_kernel_simd( n, alpha, x );
     }
     else {
         // non-unit stride
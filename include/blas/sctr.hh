@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SCTR_HH
+#define BLAS_SCTR_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Scatters $y(indx) = x$ for nz elements.
+/// Indices must be distinct, so the loop can be vectorized, with
+/// scatters if the compiler deems them profitable.
+/// @ingroup sctr_internal
+template <typename TX, typename TY>
+void sctr_kernel(
+    int64_t nz,
+    TX const* x, int64_t const* indx,
+    TY* y )
+{
+    if constexpr (is_complex_v<TX> && is_complex_v<TY>) {
+        // Complex values are accessed as real and imaginary parts,
+        // avoiding std::complex operations, so the loop vectorizes.
+        auto x_ = reinterpret_cast< real_type<TX> const* >( x );
+        auto y_ = reinterpret_cast< real_type<TY>* >( y );
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            int64_t k = 2*indx[ i ];
+            y_[ k     ] = x_[ 2*i     ];
+            y_[ k + 1 ] = x_[ 2*i + 1 ];
+        }
+    }
+    else {
+        #pragma omp simd
+        for (int64_t i = 0; i < nz; ++i) {
+            y[ indx[ i ] ] = x[ i ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Kernel called by sctr. For most types, this is the inline
+/// sctr_kernel, compiled for the application's instruction set.
+/// @ingroup sctr_internal
+template <typename TX, typename TY>
+inline void sctr_kernel_simd(
+    int64_t nz,
+    TX const* x, int64_t const* indx,
+    TY* y )
+{
+    sctr_kernel( nz, x, indx, y );
+}
+
+/// For standard types, the kernel is compiled in the library in variants
+/// for several instruction sets, selected at runtime. See set_simd_isa.
+void sctr_kernel_simd(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float* y );
+
+void sctr_kernel_simd(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double* y );
+
+void sctr_kernel_simd(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y );
+
+void sctr_kernel_simd(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y );
+
+}  // namespace internal
+
+// =============================================================================
+/// Scatter sparse vector into dense vector, $y(indx) = x$, that is,
+/// $y_{indx_i} = x_i$ for i = 0, ..., nz-1,
+/// where x is a sparse vector in compressed form with nonzeros x and
+/// indices indx, and y is a dense vector.
+/// Other elements of y are not changed.
+/// @see gthr for the inverse operation.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] nz
+///     Number of nonzeros in x. nz >= 0.
+///
+/// @param[in] x
+///     The nz nonzeros of x, in an array of length nz.
+///
+/// @param[in] indx
+///     The 0-based indices of the nonzeros of x, in an array of length nz.
+///     Indices must be distinct.
+///
+/// @param[in, out] y
+///     The dense vector y, in an array of length at least max( indx ) + 1.
+///
+/// @ingroup sctr
+
+template <typename TX, typename TY>
+void sctr(
+    int64_t nz,
+    TX const *x, int64_t const *indx,
+    TY       *y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    // As indices are distinct, each thread scatters a contiguous part
+    // of the index list independently.
+    int nthreads = internal::parallel_num_threads( nz );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int t = 0; t < nthreads; ++t) {
+        int64_t i0 = internal::parallel_part( nz, nthreads, t     );
+        int64_t i1 = internal::parallel_part( nz, nthreads, t + 1 );
+        internal::sctr_kernel_simd( i1 - i0, &x[ i0 ], &indx[ i0 ], y );
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_SCTR_HH
@@ -7,6 +7,8 @@
 #define BLAS_SYMM_HH
 
 #include "blas/util.hh"
+#include "blas/gemm.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
@@ -25,6 +27,7 @@ namespace blas {
 /// and B and C are m-by-n matrices.
 ///
 /// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -147,7 +150,76 @@ void symm(
     }
 
     // alpha != zero
-    if (side == Side::Left) {
+    int nthreads = internal::parallel_num_threads(
+                       (side == Side::Left ? m : n)*m*n );
+    if (nthreads > 1) {
+        // 2-D partition of C into one tile per thread. Each tile
+        // C(I, J) uses all of A's rows I (Left) or columns J (Right):
+        // the diagonal block via a serial symm, and the blocks left
+        // and right of it, from the stored triangle, via gemm.
+        int64_t mt, nt;
+        internal::parallel_grid( nthreads, m, n, &mt, &nt );
+        bool lower = (uplo == Uplo::Lower);
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int64_t ij = 0; ij < mt*nt; ++ij) {
+            int64_t i0 = internal::parallel_part( m, mt, ij % mt     );
+            int64_t i1 = internal::parallel_part( m, mt, ij % mt + 1 );
+            int64_t j0 = internal::parallel_part( n, nt, ij / mt     );
+            int64_t j1 = internal::parallel_part( n, nt, ij / mt + 1 );
+            int64_t ib = i1 - i0;
+            int64_t jb = j1 - j0;
+            if (side == Side::Left) {
+                // C(I, J) = alpha A(I, I) B(I, J) + beta C(I, J)
+                symm<TA, TB, TC>( Layout::ColMajor, side, uplo, ib, jb,
+                                  alpha, &A(i0, i0), lda, &B(i0, j0), ldb,
+                                  beta, &C(i0, j0), ldc );
+                // C(I, J) += alpha A(I, 0:i0) B(0:i0, J)
+                if (i0 > 0) {
+                    gemm<TA, TB, TC>(
+                        Layout::ColMajor, (lower ? Op::NoTrans : Op::Trans),
+                        Op::NoTrans, ib, jb, i0,
+                        alpha, (lower ? &A(i0, 0) : &A(0, i0)), lda,
+                               &B(0, j0), ldb,
+                        one,   &C(i0, j0), ldc );
+                }
+                // C(I, J) += alpha A(I, i1:m) B(i1:m, J)
+                if (i1 < m) {
+                    gemm<TA, TB, TC>(
+                        Layout::ColMajor, (lower ? Op::Trans : Op::NoTrans),
+                        Op::NoTrans, ib, jb, m - i1,
+                        alpha, (lower ? &A(i1, i0) : &A(i0, i1)), lda,
+                               &B(i1, j0), ldb,
+                        one,   &C(i0, j0), ldc );
+                }
+            }
+            else {
+                // C(I, J) = alpha B(I, J) A(J, J) + beta C(I, J)
+                symm<TA, TB, TC>( Layout::ColMajor, side, uplo, ib, jb,
+                                  alpha, &A(j0, j0), lda, &B(i0, j0), ldb,
+                                  beta, &C(i0, j0), ldc );
+                // C(I, J) += alpha B(I, 0:j0) A(0:j0, J)
+                if (j0 > 0) {
+                    gemm<TB, TA, TC>(
+                        Layout::ColMajor, Op::NoTrans,
+                        (lower ? Op::Trans : Op::NoTrans), ib, jb, j0,
+                        alpha, &B(i0, 0), ldb,
+                               (lower ? &A(j0, 0) : &A(0, j0)), lda,
+                        one,   &C(i0, j0), ldc );
+                }
+                // C(I, J) += alpha B(I, j1:n) A(j1:n, J)
+                if (j1 < n) {
+                    gemm<TB, TA, TC>(
+                        Layout::ColMajor, Op::NoTrans,
+                        (lower ? Op::NoTrans : Op::Trans), ib, jb, n - j1,
+                        alpha, &B(i0, j1), ldb,
+                               (lower ? &A(j1, j0) : &A(j0, j1)), lda,
+                        one,   &C(i0, j0), ldc );
+                }
+            }
+        }
+    }
+    else if (side == Side::Left) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
             for (int64_t j = 0; j < n; ++j) {
@@ -7,6 +7,8 @@
 #define BLAS_SYRK_HH
 
 #include "blas/util.hh"
+#include "blas/gemm.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
@@ -25,6 +27,7 @@ namespace blas {
 /// and A is an n-by-k or k-by-n matrix.
 ///
 /// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -182,7 +185,52 @@ void syrk(
     }
 
     // alpha != zero
-    if (trans == Op::NoTrans) {
+    int nthreads = internal::parallel_num_threads( n*n*k/2 );
+    if (nthreads > 1) {
+        // 2-D partition of C into nb-by-nb tiles; only tiles in the
+        // stored triangle are computed: diagonal tiles by a serial syrk,
+        // off-diagonal tiles by gemm. Tiles are serial, since nested calls
+        // are inside the OpenMP parallel region.
+        int64_t nb = internal::parallel_triangle_blocks( nthreads, n );
+        bool lower = (uplo == Uplo::Lower);
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( dynamic )
+        for (int64_t ij = 0; ij < nb*nb; ++ij) {
+            int64_t bi = ij % nb;
+            int64_t bj = ij / nb;
+            if (lower ? bi < bj : bi > bj)
+                continue;
+
+            int64_t i0 = internal::parallel_part( n, nb, bi     );
+            int64_t i1 = internal::parallel_part( n, nb, bi + 1 );
+            int64_t j0 = internal::parallel_part( n, nb, bj     );
+            int64_t j1 = internal::parallel_part( n, nb, bj + 1 );
+            int64_t ib = i1 - i0;
+            int64_t jb = j1 - j0;
+            if (bi == bj) {
+                // C(I, I) is a serial syrk
+                TA const* Ai = (trans == Op::NoTrans ? &A(i0, 0) : &A(0, i0));
+                syrk<TA, TC>( Layout::ColMajor, uplo, trans, ib, k,
+                           alpha, Ai, lda, beta, &C(i0, i0), ldc );
+            }
+            else {
+                // C(I, J) = alpha op(A)(I, :) op(A)(J, :)^T + beta C(I, J)
+                if (trans == Op::NoTrans) {
+                    gemm<TA, TA, TC>( Layout::ColMajor, Op::NoTrans, Op::Trans,
+                                      ib, jb, k,
+                                      alpha, &A(i0, 0), lda, &A(j0, 0), lda,
+                                      beta, &C(i0, j0), ldc );
+                }
+                else {
+                    gemm<TA, TA, TC>( Layout::ColMajor, Op::Trans, Op::NoTrans,
+                                      ib, jb, k,
+                                      alpha, &A(0, i0), lda, &A(0, j0), lda,
+                                      beta, &C(i0, j0), ldc );
+                }
+            }
+        }
+    }
+    else if (trans == Op::NoTrans) {
         if (uplo != Uplo::Lower) {
             // uplo == Uplo::Upper or uplo == Uplo::General
             for (int64_t j = 0; j < n; ++j) {
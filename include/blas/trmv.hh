@@ -7,11 +7,23 @@
 #define BLAS_TRMV_HH
 
 #include "blas/util.hh"
+#include "blas/gemv.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block size for the generic trmv. Diagonal blocks are multiplied by loops;
+/// the rest of op(A) x is added by gemv, so each block of x stays in cache.
+/// @ingroup trmv_internal
+constexpr int64_t trmv_nb = 64;
+
+}  // namespace internal
+
 // =============================================================================
 /// Triangular matrix-vector multiply:
 /// \[
@@ -95,6 +107,70 @@ void trmv(
     if (n == 0)
         return;
 
+    const int64_t nb = internal::trmv_nb;
+    if (n > nb) {
+        typedef blas::scalar_type<TA, TX> scalar_t;
+        const scalar_t one = 1;
+
+        // pointer to A(i, j) in the given layout, and to x(i : i+len-1)
+        auto Aij = [&]( int64_t i, int64_t j ) {
+            return (layout == Layout::ColMajor ? &A[ i + j*lda ]
+                                               : &A[ i*lda + j ]);
+        };
+        auto xi = [&]( int64_t i, int64_t len ) {
+            return internal::vector_block( x, n, incx, i, len );
+        };
+
+        // x(i : i+mi-1) += op(A)(i : i+mi-1, j : j+nj-1) x(j : j+nj-1)
+        auto update = [&]( int64_t i, int64_t mi, int64_t j, int64_t nj ) {
+            if (mi == 0 || nj == 0)
+                return;
+            if (trans == Op::NoTrans) {
+                gemv<TA, TX, TX>( layout, trans, mi, nj,
+                                  one, Aij( i, j ), lda, xi( j, nj ), incx,
+                                  one, xi( i, mi ), incx );
+            }
+            else {
+                gemv<TA, TX, TX>( layout, trans, nj, mi,
+                                  one, Aij( j, i ), lda, xi( j, nj ), incx,
+                                  one, xi( i, mi ), incx );
+            }
+        };
+
+        // op(A) is lower triangular if it is A lower or A^T upper.
+        // Blocks are visited so the part of x read by the gemv is not yet
+        // overwritten: bottom up for lower, top down for upper.
+        // As in trsv, panels are tall in the unit-stride direction of A:
+        // for ColMajor A or RowMajor A^T, the block of x is the gemv input
+        // to update the rest of x (right-looking); otherwise, it is the
+        // gemv output, updated from the rest of x (left-looking).
+        bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+        bool left  = ((layout == Layout::ColMajor) != (trans == Op::NoTrans));
+        if (lower) {
+            for (int64_t k = (n - 1) / nb * nb; k >= 0; k -= nb) {
+                int64_t kb = min( nb, n - k );
+                if (! left)
+                    update( k + kb, n - k - kb, k, kb );
+                trmv<TA, TX>( layout, uplo, trans, diag, kb,
+                              Aij( k, k ), lda, xi( k, kb ), incx );
+                if (left)
+                    update( k, kb, 0, k );
+            }
+        }
+        else {
+            for (int64_t k = 0; k < n; k += nb) {
+                int64_t kb = min( nb, n - k );
+                if (! left)
+                    update( 0, k, k, kb );
+                trmv<TA, TX>( layout, uplo, trans, diag, kb,
+                              Aij( k, k ), lda, xi( k, kb ), incx );
+                if (left)
+                    update( k, kb, k + kb, n - k - kb );
+            }
+        }
+        return;
+    }
+
     // for row major, swap lower <=> upper and
     // A => A^T; A^T => A; A^H => A & conj
     bool doconj = false;
@@ -7,6 +7,7 @@
 #define BLAS_TRSM_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
@@ -33,6 +34,7 @@ namespace blas {
 /// @see latrs for a more numerically robust implementation.
 ///
 /// Generic implementation for arbitrary data types.
+/// Uses OpenMP threads, see set_num_threads and set_parallel_threshold.
 ///
 /// @param[in] layout
 ///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
@@ -156,7 +158,32 @@ void trsm(
     }
 
     // alpha != zero
-    if (side == Side::Left) {
+    int nthreads = internal::parallel_num_threads(
+        (side == Side::Left ? m*m*n : m*n*n) / 2 );
+    if (nthreads > 1) {
+        // 1-D partition of B along the dimension that op(A) does not couple:
+        // columns of B if side = Left, rows of B if side = Right.
+        // Each part is an independent, serial trsm.
+        int64_t nparts = min( int64_t( nthreads ),
+                              (side == Side::Left ? n : m) );
+
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int64_t p = 0; p < nparts; ++p) {
+            if (side == Side::Left) {
+                int64_t j0 = internal::parallel_part( n, nparts, p     );
+                int64_t j1 = internal::parallel_part( n, nparts, p + 1 );
+                trsm<TA, TB>( Layout::ColMajor, side, uplo, trans, diag,
+                            m, j1 - j0, alpha, A, lda, &B(0, j0), ldb );
+            }
+            else {
+                int64_t i0 = internal::parallel_part( m, nparts, p     );
+                int64_t i1 = internal::parallel_part( m, nparts, p + 1 );
+                trsm<TA, TB>( Layout::ColMajor, side, uplo, trans, diag,
+                            i1 - i0, n, alpha, A, lda, &B(i0, 0), ldb );
+            }
+        }
+    }
+    else if (side == Side::Left) {
         if (trans == Op::NoTrans) {
             if (uplo == Uplo::Upper) {
                 for (int64_t j = 0; j < n; ++j) {
@@ -7,11 +7,23 @@
 #define BLAS_TRSV_HH
 
 #include "blas/util.hh"
+#include "blas/gemv.hh"
+#include "blas/parallel.hh"
 
 #include <limits>
 
 namespace blas {
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block size for the generic trsv. Diagonal blocks are solved by loops;
+/// the rest of x is updated by gemv, so each block of x stays in cache.
+/// @ingroup trsv_internal
+constexpr int64_t trsv_nb = 64;
+
+}  // namespace internal
+
 // =============================================================================
 /// Solve the triangular matrix-vector equation
 /// \[
@@ -99,6 +111,70 @@ void trsv(
     if (n == 0)
         return;
 
+    const int64_t nb = internal::trsv_nb;
+    if (n > nb) {
+        typedef blas::scalar_type<TA, TX> scalar_t;
+        const scalar_t one = 1;
+
+        // pointer to A(i, j) in the given layout, and to x(i : i+len-1)
+        auto Aij = [&]( int64_t i, int64_t j ) {
+            return (layout == Layout::ColMajor ? &A[ i + j*lda ]
+                                               : &A[ i*lda + j ]);
+        };
+        auto xi = [&]( int64_t i, int64_t len ) {
+            return internal::vector_block( x, n, incx, i, len );
+        };
+
+        // x(i : i+mi-1) -= op(A)(i : i+mi-1, j : j+nj-1) x(j : j+nj-1)
+        auto update = [&]( int64_t i, int64_t mi, int64_t j, int64_t nj ) {
+            if (mi == 0 || nj == 0)
+                return;
+            if (trans == Op::NoTrans) {
+                gemv<TA, TX, TX>( layout, trans, mi, nj,
+                                  -one, Aij( i, j ), lda, xi( j, nj ), incx,
+                                  one, xi( i, mi ), incx );
+            }
+            else {
+                gemv<TA, TX, TX>( layout, trans, nj, mi,
+                                  -one, Aij( j, i ), lda, xi( j, nj ), incx,
+                                  one, xi( i, mi ), incx );
+            }
+        };
+
+        // op(A) is lower triangular if it is A lower or A^T upper.
+        // Panels are taken tall in the unit-stride direction of A, so gemv
+        // streams A contiguously: for ColMajor A or RowMajor A^T, after
+        // solving a block, update the unsolved part of x (right-looking),
+        // with the solved block as gemv input; otherwise, update the block
+        // to solve from the solved part of x (left-looking), with the block
+        // as gemv output. Either way, the block of x stays in cache.
+        bool lower = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+        bool left  = ((layout == Layout::ColMajor) != (trans == Op::NoTrans));
+        if (lower) {
+            for (int64_t k = 0; k < n; k += nb) {
+                int64_t kb = min( nb, n - k );
+                if (left)
+                    update( k, kb, 0, k );
+                trsv<TA, TX>( layout, uplo, trans, diag, kb,
+                              Aij( k, k ), lda, xi( k, kb ), incx );
+                if (! left)
+                    update( k + kb, n - k - kb, k, kb );
+            }
+        }
+        else {
+            for (int64_t k = (n - 1) / nb * nb; k >= 0; k -= nb) {
+                int64_t kb = min( nb, n - k );
+                if (left)
+                    update( k, kb, k + kb, n - k - kb );
+                trsv<TA, TX>( layout, uplo, trans, diag, kb,
+                              Aij( k, k ), lda, xi( k, kb ), incx );
+                if (! left)
+                    update( 0, k, k, kb );
+            }
+        }
+        return;
+    }
+
     // for row major, swap lower <=> upper and
     // A => A^T; A^T => A; A^H => A & conj
     bool doconj = false;
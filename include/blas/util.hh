@@ -15,6 +15,8 @@
 
 #include <assert.h>
 
+#include "blas/float16.hh"
+
 namespace blas {
 
 /// Use to silence compiler warning of unused variable.
@@ -60,12 +62,14 @@ enum class Op     : char { NoTrans  = 'N', Trans    = 'T', ConjTrans = 'C' };
 enum class Uplo   : char { Upper    = 'U', Lower    = 'L', General   = 'G' };
 enum class Diag   : char { NonUnit  = 'N', Unit     = 'U' };
 enum class Side   : char { Left     = 'L', Right    = 'R' };
+enum class Direction : char { Forward = 'F', Backward = 'B' };
 
 extern const char* Layout_help;
 extern const char* Op_help;
 extern const char* Uplo_help;
 extern const char* Diag_help;
 extern const char* Side_help;
+extern const char* Direction_help;
 
 // -----------------------------------------------------------------------------
 // Convert enum to LAPACK-style char.
@@ -75,6 +79,7 @@ inline char to_char( Op     value ) { return char( value ); }
 inline char to_char( Uplo   value ) { return char( value ); }
 inline char to_char( Diag   value ) { return char( value ); }
 inline char to_char( Side   value ) { return char( value ); }
+inline char to_char( Direction value ) { return char( value ); }
 
 [[deprecated("use to_char. To be removed 2025-05.")]]
 inline char layout2char( Layout value ) { return char( value ); }
@@ -141,6 +146,15 @@ inline const char* to_c_string( Side value )
     return "?";
 }
 
+inline const char* to_c_string( Direction value )
+{
+    switch (value) {
+        case Direction::Forward:  return "forward";
+        case Direction::Backward: return "backward";
+    }
+    return "?";
+}
+
 //------------------------------------------------------------------------------
 // Convert enum to LAPACK-style C++ string.
 
@@ -169,6 +183,11 @@ inline std::string to_string( Side value )
     return to_c_string( value );
 }
 
+inline std::string to_string( Direction value )
+{
+    return to_c_string( value );
+}
+
 //------------------------------------------------------------------------------
 // Convert enum to LAPACK-style C string.
 
@@ -269,6 +288,18 @@ inline void from_string( std::string const& str, Side* val )
         throw Error( "unknown Side: " + str );
 }
 
+inline void from_string( std::string const& str, Direction* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+    if (str_ == "f" || str_ == "forward")
+        *val = Direction::Forward;
+    else if (str_ == "b" || str_ == "backward")
+        *val = Direction::Backward;
+    else
+        throw Error( "unknown Direction: " + str );
+}
+
 ///-----------------------------------------------------------------------------
 // Convert LAPACK-style char to enum.
 
@@ -409,12 +440,27 @@ struct scalar_type_traits< T >
     using type = decay_t<T>;
 };
 
+// 16-bit storage types do arithmetic in float
+template <>
+struct scalar_type_traits< float16 >
+{
+    using type = float;
+};
+
+template <>
+struct scalar_type_traits< bfloat16 >
+{
+    using type = float;
+};
+
 // for two types
-// relies on type of ?: operator being the common type of its two arguments
+// relies on type of ?: operator being the common type of its two arguments,
+// after mapping each type to its one-type scalar_type (e.g., float16 => float)
 template <typename T1, typename T2>
 struct scalar_type_traits< T1, T2 >
 {
-    using type = decay_t< decltype( true ? std::declval<T1>() : std::declval<T2>() ) >;
+    using type = decay_t< decltype( true ? std::declval< scalar_type< decay_t<T1> > >()
+                                         : std::declval< scalar_type< decay_t<T2> > >() ) >;
 };
 
 // for either or both complex,
@@ -422,19 +468,19 @@ struct scalar_type_traits< T1, T2 >
 template <typename T1, typename T2>
 struct scalar_type_traits< std::complex<T1>, T2 >
 {
-    using type = std::complex< common_type_t< T1, T2 > >;
+    using type = std::complex< scalar_type< T1, T2 > >;
 };
 
 template <typename T1, typename T2>
 struct scalar_type_traits< T1, std::complex<T2> >
 {
-    using type = std::complex< common_type_t< T1, T2 > >;
+    using type = std::complex< scalar_type< T1, T2 > >;
 };
 
 template <typename T1, typename T2>
 struct scalar_type_traits< std::complex<T1>, std::complex<T2> >
 {
-    using type = std::complex< common_type_t< T1, T2 > >;
+    using type = std::complex< scalar_type< T1, T2 > >;
 };
 
 // for three or more types
@@ -450,10 +496,12 @@ struct scalar_type_traits< T1, T2, Types... >
 //
 // real_type< float >                               is float
 // real_type< float, double, complex<float> >       is double
+// real_type< float16 >                             is float
 //
 // scalar_type< float >                             is float
 // scalar_type< float, complex<float> >             is complex<float>
 // scalar_type< float, double, complex<float> >     is complex<double>
+// scalar_type< float16, bfloat16 >                 is float
 //
 // complex_type< float >                            is complex<float>
 // complex_type< float, double >                    is complex<double>
@@ -485,6 +533,19 @@ struct real_type_traits< std::complex<T> >
     using real_t = T;
 };
 
+// 16-bit storage types do arithmetic in float
+template <>
+struct real_type_traits< float16 >
+{
+    using real_t = float;
+};
+
+template <>
+struct real_type_traits< bfloat16 >
+{
+    using real_t = float;
+};
+
 // for two or more types
 template <typename T1, typename... Types>
 struct real_type_traits< T1, Types... >
@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_WAXPBY_HH
+#define BLAS_WAXPBY_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+namespace blas {
+
+// =============================================================================
+/// Add scaled vectors into a third vector, $w = \alpha x + \beta y$.
+/// Fuses copy, scal, and axpy into one pass.
+///
+/// Generic implementation for arbitrary data types.
+///
+/// @param[in] n
+///     Number of elements in x, y, and w. n >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha.
+///
+/// @param[in] x
+///     The n-element vector x, in an array of length (n-1)*abs(incx) + 1.
+///
+/// @param[in] incx
+///     Stride between elements of x. incx must not be zero.
+///     If incx < 0, uses elements of x in reverse order: x(n-1), ..., x(0).
+///
+/// @param[in] beta
+///     Scalar beta. If beta is zero, y is not referenced.
+///
+/// @param[in] y
+///     The n-element vector y, in an array of length (n-1)*abs(incy) + 1.
+///
+/// @param[in] incy
+///     Stride between elements of y. incy must not be zero.
+///     If incy < 0, uses elements of y in reverse order: y(n-1), ..., y(0).
+///
+/// @param[out] w
+///     The n-element vector w, in an array of length (n-1)*abs(incw) + 1.
+///     w may be the same as x or y, with the same stride.
+///
+/// @param[in] incw
+///     Stride between elements of w. incw must not be zero.
+///     If incw < 0, uses elements of w in reverse order: w(n-1), ..., w(0).
+///
+/// @ingroup waxpby
+
+template <typename TX, typename TY, typename TW>
+void waxpby(
+    int64_t n,
+    blas::scalar_type<TX, TY, TW> alpha,
+    TX const *x, int64_t incx,
+    blas::scalar_type<TX, TY, TW> beta,
+    TY const *y, int64_t incy,
+    TW       *w, int64_t incw )
+{
+    typedef blas::scalar_type<TX, TY, TW> scalar_t;
+
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+    blas_error_if( incw == 0 );
+
+    int nthreads = internal::parallel_num_threads( n );
+    if (nthreads > 1) {
+        // Each thread updates a contiguous part of the vectors.
+        #pragma omp parallel for num_threads( nthreads ) schedule( static )
+        for (int t = 0; t < nthreads; ++t) {
+            int64_t i0 = internal::parallel_part( n, nthreads, t     );
+            int64_t i1 = internal::parallel_part( n, nthreads, t + 1 );
+            waxpby< TX, TY, TW >( i1 - i0,
+                                  alpha, internal::vector_block( x, n, incx, i0, i1 - i0 ), incx,
+                                  beta,  internal::vector_block( y, n, incy, i0, i1 - i0 ), incy,
+                                  internal::vector_block( w, n, incw, i0, i1 - i0 ), incw );
+        }
+        return;
+    }
+
+    if (incx == 1 && incy == 1 && incw == 1) {
+        // unit stride
+        if (beta == scalar_t(0)) {
+            for (int64_t i = 0; i < n; ++i) {
+                w[i] = alpha*x[i];
+            }
+        }
+        else {
+            for (int64_t i = 0; i < n; ++i) {
+                w[i] = alpha*x[i] + beta*y[i];
+            }
+        }
+    }
+    else {
+        // non-unit stride
+        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+        int64_t iw = (incw > 0 ? 0 : (-n + 1)*incw);
+        for (int64_t i = 0; i < n; ++i) {
+            if (beta == scalar_t(0))
+                w[iw] = alpha*x[ix];
+            else
+                w[iw] = alpha*x[ix] + beta*y[iy];
+            ix += incx;
+            iy += incy;
+            iw += incw;
+        }
+    }
+}
+
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_WAXPBY_HH
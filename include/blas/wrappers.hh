@@ -32,6 +32,53 @@ double asum(
     int64_t n,
     std::complex<double> const* x, int64_t incx );
 
+//------------------------------------------------------------------------------
+// Compensated, twice working precision.
+float asum2(
+    int64_t n,
+    float const* x, int64_t incx );
+
+double asum2(
+    int64_t n,
+    double const* x, int64_t incx );
+
+float asum2(
+    int64_t n,
+    std::complex<float> const* x, int64_t incx );
+
+double asum2(
+    int64_t n,
+    std::complex<double> const* x, int64_t incx );
+
+//------------------------------------------------------------------------------
+void axpby(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float beta,
+    float*       y, int64_t incy );
+
+void axpby(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double beta,
+    double*       y, int64_t incy );
+
+void axpby(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, int64_t incy );
+
+void axpby(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, int64_t incy );
+
 //------------------------------------------------------------------------------
 void axpy(
     int64_t n,
@@ -57,6 +104,32 @@ void axpy(
     std::complex<double> const* x, int64_t incx,
     std::complex<double>*       y, int64_t incy );
 
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+void axpyi(
+    int64_t nz,
+    float alpha,
+    float const* x, int64_t const* indx,
+    float*       y );
+
+void axpyi(
+    int64_t nz,
+    double alpha,
+    double const* x, int64_t const* indx,
+    double*       y );
+
+void axpyi(
+    int64_t nz,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>*       y );
+
+void axpyi(
+    int64_t nz,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>*       y );
+
 //------------------------------------------------------------------------------
 void copy(
     int64_t n,
@@ -99,6 +172,57 @@ std::complex<double> dot(
     std::complex<double> const* x, int64_t incx,
     std::complex<double> const* y, int64_t incy );
 
+//------------------------------------------------------------------------------
+// Compensated, twice working precision.
+float dot2(
+    int64_t n,
+    float const* x, int64_t incx,
+    float const* y, int64_t incy );
+
+double dot2(
+    int64_t n,
+    double const* x, int64_t incx,
+    double const* y, int64_t incy );
+
+std::complex<float> dot2(
+    int64_t n,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> const* y, int64_t incy );
+
+std::complex<double> dot2(
+    int64_t n,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> const* y, int64_t incy );
+
+//------------------------------------------------------------------------------
+float dot_axpy(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float*       y, int64_t incy,
+    float const* z, int64_t incz );
+
+double dot_axpy(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double*       y, int64_t incy,
+    double const* z, int64_t incz );
+
+std::complex<float> dot_axpy(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float>*       y, int64_t incy,
+    std::complex<float> const* z, int64_t incz );
+
+std::complex<double> dot_axpy(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double>*       y, int64_t incy,
+    std::complex<double> const* z, int64_t incz );
+
 //------------------------------------------------------------------------------
 float dotu(
     int64_t n,
@@ -120,6 +244,94 @@ std::complex<double> dotu(
     std::complex<double> const* x, int64_t incx,
     std::complex<double> const* y, int64_t incy );
 
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+float doti(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y );
+
+double doti(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y );
+
+std::complex<float> doti(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y );
+
+std::complex<double> doti(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y );
+
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+float dotui(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y );
+
+double dotui(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y );
+
+std::complex<float> dotui(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y );
+
+std::complex<double> dotui(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y );
+
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+void gthr(
+    int64_t nz,
+    float const* y,
+    float*       x, int64_t const* indx );
+
+void gthr(
+    int64_t nz,
+    double const* y,
+    double*       x, int64_t const* indx );
+
+void gthr(
+    int64_t nz,
+    std::complex<float> const* y,
+    std::complex<float>*       x, int64_t const* indx );
+
+void gthr(
+    int64_t nz,
+    std::complex<double> const* y,
+    std::complex<double>*       x, int64_t const* indx );
+
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+void gthrz(
+    int64_t nz,
+    float* y,
+    float* x, int64_t const* indx );
+
+void gthrz(
+    int64_t nz,
+    double* y,
+    double* x, int64_t const* indx );
+
+void gthrz(
+    int64_t nz,
+    std::complex<float>* y,
+    std::complex<float>* x, int64_t const* indx );
+
+void gthrz(
+    int64_t nz,
+    std::complex<double>* y,
+    std::complex<double>* x, int64_t const* indx );
+
 //------------------------------------------------------------------------------
 int64_t iamax(
     int64_t n,
@@ -137,6 +349,56 @@ int64_t iamax(
     int64_t n,
     std::complex<double> const* x, int64_t incx );
 
+//------------------------------------------------------------------------------
+void maxpy(
+    int64_t n, int64_t k,
+    float const* alpha,
+    float const* X, int64_t ldx,
+    float*       y, int64_t incy );
+
+void maxpy(
+    int64_t n, int64_t k,
+    double const* alpha,
+    double const* X, int64_t ldx,
+    double*       y, int64_t incy );
+
+void maxpy(
+    int64_t n, int64_t k,
+    std::complex<float> const* alpha,
+    std::complex<float> const* X, int64_t ldx,
+    std::complex<float>*       y, int64_t incy );
+
+void maxpy(
+    int64_t n, int64_t k,
+    std::complex<double> const* alpha,
+    std::complex<double> const* X, int64_t ldx,
+    std::complex<double>*       y, int64_t incy );
+
+//------------------------------------------------------------------------------
+void mdot(
+    int64_t n, int64_t k,
+    float const* X, int64_t ldx,
+    float const* y, int64_t incy,
+    float*       result );
+
+void mdot(
+    int64_t n, int64_t k,
+    double const* X, int64_t ldx,
+    double const* y, int64_t incy,
+    double*       result );
+
+void mdot(
+    int64_t n, int64_t k,
+    std::complex<float> const* X, int64_t ldx,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>*       result );
+
+void mdot(
+    int64_t n, int64_t k,
+    std::complex<double> const* X, int64_t ldx,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>*       result );
+
 //------------------------------------------------------------------------------
 float nrm2(
     int64_t n,
@@ -209,6 +471,44 @@ void rot(
     double c,
     std::complex<double> s );
 
+//------------------------------------------------------------------------------
+// Sequences of Givens rotations applied to a matrix.
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    float const* C, int64_t ldc,
+    float const* S, int64_t lds,
+    float*       A, int64_t lda );
+
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    double const* C, int64_t ldc,
+    double const* S, int64_t lds,
+    double*       A, int64_t lda );
+
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    float const* C, int64_t ldc,
+    std::complex<float> const* S, int64_t lds,
+    std::complex<float>*       A, int64_t lda );
+
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    double const* C, int64_t ldc,
+    std::complex<double> const* S, int64_t lds,
+    std::complex<double>*       A, int64_t lda );
+
 //------------------------------------------------------------------------------
 void rotg(
     float* a,
@@ -285,6 +585,28 @@ void scal(
     std::complex<double> alpha,
     std::complex<double>* x, int64_t incx );
 
+//------------------------------------------------------------------------------
+// Sparse vector x in compressed form, with nonzeros x and indices indx.
+void sctr(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float*       y );
+
+void sctr(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double*       y );
+
+void sctr(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>*       y );
+
+void sctr(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>*       y );
+
 //------------------------------------------------------------------------------
 void swap(
     int64_t n,
@@ -306,6 +628,39 @@ void swap(
     std::complex<double>* x, int64_t incx,
     std::complex<double>* y, int64_t incy );
 
+//------------------------------------------------------------------------------
+void waxpby(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float beta,
+    float const* y, int64_t incy,
+    float*       w, int64_t incw );
+
+void waxpby(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double beta,
+    double const* y, int64_t incy,
+    double*       w, int64_t incw );
+
+void waxpby(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>*       w, int64_t incw );
+
+void waxpby(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>*       w, int64_t incw );
+
 //==============================================================================
 // Level 2 BLAS
 
@@ -350,6 +705,48 @@ void gemv(
     std::complex<double> beta,
     std::complex<double>*       y, int64_t incy );
 
+//------------------------------------------------------------------------------
+// Compensated, twice working precision.
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* x, int64_t incx,
+    float beta,
+    float*       y, int64_t incy );
+
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* x, int64_t incx,
+    double beta,
+    double*       y, int64_t incy );
+
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, int64_t incy );
+
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, int64_t incy );
+
 //------------------------------------------------------------------------------
 void ger(
     blas::Layout layout,
@@ -700,6 +1097,77 @@ void trsv(
 //==============================================================================
 // Level 3 BLAS
 
+//------------------------------------------------------------------------------
+/// Enables Strassen-Winograd recursion in the CPU double and
+/// complex<double> gemm, for large products where it pays off.
+/// While all of m, n, and k are >= cutoff, gemm splits each into halves
+/// and does 7 half-size products instead of 8, recursively; the leaves call
+/// the vendor gemm. For instance, with cutoff = 2048, an 8000^3 gemm
+/// recurses 2 levels, doing (7/8)^2 = 77% of the flops.
+///
+/// The temporary workspace is allocated once per call and bounded by
+/// (m k + k n + m n) / 3 elements.
+///
+/// Error: Strassen-Winograd satisfies only a normwise bound,
+/// $\|C - \hat{C}\| \le c_L\, u \|A\| \|B\| + O(u^2)$, not the componentwise
+/// bound $|C - \hat{C}| \le k u |A| |B|$ of conventional gemm, so relative
+/// errors in small entries of C can be large. The constant $c_L$ grows by
+/// about a factor of 18 / 4 per level [Higham, Accuracy and Stability of
+/// Numerical Algorithms, 2nd ed., sec. 23.2.2]. Normwise errors for
+/// random matrices stay within a few u for a few levels. Hence the default
+/// is off, and only a few levels are recommended.
+///
+/// Each level trades one product for 15 half-size additions, so the
+/// half-size vendor gemm must be well into its asymptotic rate for this to
+/// pay off; typically cutoff should be 2048 or more.
+///
+/// @param[in] cutoff
+///     Recursion cutoff. If cutoff <= 0 (default), disables Strassen,
+///     so gemm always calls the vendor gemm.
+///
+void set_strassen_cutoff( int64_t cutoff );
+
+//------------------------------------------------------------------------------
+/// @return Strassen-Winograd recursion cutoff; 0 if disabled.
+/// @see set_strassen_cutoff
+///
+int64_t get_strassen_cutoff();
+
+//------------------------------------------------------------------------------
+/// Enables the 3M algorithm in the CPU complex<float> and
+/// complex<double> gemm, for large products where it pays off.
+/// When all of m, n, and k are >= cutoff, gemm splits op(A) and op(B)
+/// into real and imaginary parts and does 3 real gemms instead of the
+/// equivalent of 4, saving 25% of the flops. If the BLAS library provides
+/// cgemm3m and zgemm3m (MKL, OpenBLAS), those are called; otherwise
+/// BLAS++ does the 3 real products with the vendor sgemm or dgemm.
+/// 3M takes precedence over Strassen-Winograd (set_strassen_cutoff).
+///
+/// The BLAS++ implementation keeps a per-thread workspace, reused across
+/// calls, of at most 7 * 1024^2 reals.
+///
+/// Error: the real part of C satisfies the same bound as conventional
+/// gemm, but the imaginary part satisfies only a normwise bound,
+/// $|\Im(C - \hat{C})| \le c\, k u (|A_r| + |A_i|) (|B_r| + |B_i|) + O(u^2)$,
+/// so relative errors in imaginary parts much smaller than the real parts
+/// can be large [Higham, Accuracy and Stability of Numerical Algorithms,
+/// 2nd ed., sec. 23.2.4]. Hence the default is off.
+///
+/// The splitting and combining are O(m k + k n + m n) real operations,
+/// so typically cutoff should be 512 or more.
+///
+/// @param[in] cutoff
+///     If cutoff <= 0 (default), disables 3M,
+///     so gemm always calls the vendor gemm.
+///
+void set_gemm3m_cutoff( int64_t cutoff );
+
+//------------------------------------------------------------------------------
+/// @return 3M cutoff; 0 if disabled.
+/// @see set_gemm3m_cutoff
+///
+int64_t get_gemm3m_cutoff();
+
 //------------------------------------------------------------------------------
 void gemm(
     blas::Layout layout,
@@ -745,45 +1213,74 @@ void gemm(
     std::complex<double> beta,
     std::complex<double>*       C, int64_t ldc );
 
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    int8_t const* A, int64_t lda,
+    int8_t const* B, int64_t ldb,
+    int32_t beta,
+    int32_t*      C, int64_t ldc );
+
 //------------------------------------------------------------------------------
-void hemm(
+void gemm_quantized(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    int8_t const* A, int64_t lda,
+    float const* scale_A, int32_t const* zero_A,
+    int8_t const* B, int64_t ldb,
+    float const* scale_B, int32_t const* zero_B,
+    float beta,
+    float*        C, int64_t ldc );
+
+//------------------------------------------------------------------------------
+void gemmt(
     blas::Layout layout,
-    blas::Side side,
     blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
     float alpha,
     float const* A, int64_t lda,
     float const* B, int64_t ldb,
     float beta,
     float*       C, int64_t ldc );
 
-void hemm(
+void gemmt(
     blas::Layout layout,
-    blas::Side side,
     blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
     double alpha,
     double const* A, int64_t lda,
     double const* B, int64_t ldb,
     double beta,
     double*       C, int64_t ldc );
 
-void hemm(
+void gemmt(
     blas::Layout layout,
-    blas::Side side,
     blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
     std::complex<float> alpha,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float> beta,
     std::complex<float>*       C, int64_t ldc );
 
-void hemm(
+void gemmt(
     blas::Layout layout,
-    blas::Side side,
     blas::Uplo uplo,
-    int64_t m, int64_t n,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
     std::complex<double> alpha,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* B, int64_t ldb,
@@ -791,21 +1288,66 @@ void hemm(
     std::complex<double>*       C, int64_t ldc );
 
 //------------------------------------------------------------------------------
-void her2k(
+void hemm(
     blas::Layout layout,
+    blas::Side side,
     blas::Uplo uplo,
-    blas::Op trans,
-    int64_t n, int64_t k,
+    int64_t m, int64_t n,
     float alpha,
     float const* A, int64_t lda,
     float const* B, int64_t ldb,
     float beta,
     float*       C, int64_t ldc );
 
-void her2k(
+void hemm(
     blas::Layout layout,
+    blas::Side side,
     blas::Uplo uplo,
-    blas::Op trans,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc );
+
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc );
+
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc );
+
+//------------------------------------------------------------------------------
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc );
+
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
     int64_t n, int64_t k,
     double alpha,
     double const* A, int64_t lda,
@@ -1115,11 +1657,147 @@ namespace batch {
 //==============================================================================
 // Level 1 Batch BLAS
 
+//------------------------------------------------------------------------------
+// batch axpy
+void axpy(
+    std::vector<int64_t>    const& n,
+    std::vector<float >     const& alpha,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    std::vector<float*>     const& y, std::vector<int64_t> const& incy,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void axpy(
+    std::vector<int64_t>    const& n,
+    std::vector<double >    const& alpha,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    std::vector<double*>    const& y, std::vector<int64_t> const& incy,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void axpy(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>  > const& alpha,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    std::vector< std::complex<float>* > const& y, std::vector<int64_t> const& incy,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void axpy(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>  > const& alpha,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    std::vector< std::complex<double>* > const& y, std::vector<int64_t> const& incy,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+// batch dot
+void dot(
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    std::vector<float*>     const& y, std::vector<int64_t> const& incy,
+    std::vector<float>&            result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void dot(
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    std::vector<double*>    const& y, std::vector<int64_t> const& incy,
+    std::vector<double>&           result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void dot(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    std::vector< std::complex<float>* > const& y, std::vector<int64_t> const& incy,
+    std::vector< std::complex<float>  >&       result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void dot(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    std::vector< std::complex<double>* > const& y, std::vector<int64_t> const& incy,
+    std::vector< std::complex<double>  >&       result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+// batch nrm2
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    std::vector<float>&            result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    std::vector<double>&           result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    std::vector<float>&            result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    std::vector<double>&           result,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+//------------------------------------------------------------------------------
+// batch scal
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector<float >     const& alpha,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector<double >    const& alpha,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>  > const& alpha,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>  > const& alpha,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info );
+
 //==============================================================================
 // Level 2 Batch BLAS
 
 //==============================================================================
 // Level 3 Batch BLAS
+//
+// The strided versions compute batch_size items of the same size.
+// Item i uses matrices A + i*strideA, B + i*strideB, etc., so no pointer
+// arrays are built. Input strides may be 0 to share one matrix among all
+// items; output matrices must not overlap. Item 0 is computed first, in the
+// calling thread, so argument errors, which are the same for all items,
+// throw as for the non-batched routine. The remaining items are split
+// evenly among OpenMP threads with a static schedule.
 
 //------------------------------------------------------------------------------
 // batch gemm
@@ -1183,6 +1861,56 @@ void gemm(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch gemm, strided
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch hemm
 void hemm(
@@ -1241,6 +1969,56 @@ void hemm(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch hemm, strided
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void hemm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch her2k
 void her2k(
@@ -1299,6 +2077,56 @@ void her2k(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch her2k, strided
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void her2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch herk
 void herk(
@@ -1353,6 +2181,52 @@ void herk(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch herk, strided
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    float beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    double beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch symm
 void symm(
@@ -1411,6 +2285,56 @@ void symm(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch symm, strided
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch syr2k
 void syr2k(
@@ -1469,6 +2393,56 @@ void syr2k(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch syr2k, strided
+void syr2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syr2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syr2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syr2k(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch syrk
 void syrk(
@@ -1523,6 +2497,52 @@ void syrk(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch syrk, strided
+void syrk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syrk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syrk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
+void syrk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch trmm
 void trmm(
@@ -1581,6 +2601,56 @@ void trmm(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch trmm, strided
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
 //------------------------------------------------------------------------------
 // batch trsm
 void trsm(
@@ -1639,5 +2709,55 @@ void trsm(
     size_t batch_size,
     std::vector<int64_t>& info );
 
+//------------------------------------------------------------------------------
+// batch trsm, strided
+void trsm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trsm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trsm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
+void trsm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size );
+
 }  // namespace batch
 }  // namespace blas
@@ -7,6 +7,9 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "reproducible.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -23,7 +26,11 @@ inline float asum(
     blas_int n,
     float const* x, blas_int incx )
 {
-    return BLAS_sasum( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_sasum( n, x, incx );
+    #else
+        return BLAS_sasum( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -33,7 +40,11 @@ inline double asum(
     blas_int n,
     double const* x, blas_int incx )
 {
-    return BLAS_dasum( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_dasum( n, x, incx );
+    #else
+        return BLAS_dasum( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -43,7 +54,11 @@ inline float asum(
     blas_int n,
     std::complex<float> const* x, blas_int incx )
 {
-    return BLAS_scasum( &n, (blas_complex_float*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_scasum( n, x, incx );
+    #else
+        return BLAS_scasum( &n, (blas_complex_float*) x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -53,7 +68,43 @@ inline double asum(
     blas_int n,
     std::complex<double> const* x, blas_int incx )
 {
-    return BLAS_dzasum( &n, (blas_complex_double*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_dzasum( n, x, incx );
+    #else
+        return BLAS_dzasum( &n, (blas_complex_double*) x, &incx );
+    #endif
+}
+
+BLAS_SIMD_KERNEL( asum_kernel, asum_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// Calls the asum kernel variant for simd_isa(). In reproducible mode,
+/// calls the generic variant, as the vector width of other variants
+/// changes the order of the sum from one CPU to another.
+/// @ingroup asum_internal
+template <typename T>
+real_type<T> asum_kernel_select( int64_t n, T const* x )
+{
+    if (get_reproducible())
+        return asum_kernel( n, x );
+    else
+        return asum_kernel_dispatch( n, x );
+}
+
+//------------------------------------------------------------------------------
+/// float16 version.
+/// @ingroup asum_internal
+float asum_kernel_simd( int64_t n, float16 const* x )
+{
+    return asum_kernel_select( n, x );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 version.
+/// @ingroup asum_internal
+float asum_kernel_simd( int64_t n, bfloat16 const* x )
+{
+    return asum_kernel_select( n, x );
 }
 
 }  // namespace internal
@@ -75,6 +126,17 @@ real_type<scalar_t> asum(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        real_type<scalar_t> result = 0;
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            result += asum( ib, x + i*incx, incx );
+        }
+        return result;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::asum_type element;
@@ -86,6 +148,9 @@ real_type<scalar_t> asum(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    if (get_reproducible())
+        return internal::reproducible_asum( n, x, incx );
+
     // convert arguments
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
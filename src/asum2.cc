@@ -0,0 +1,137 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( asum2_kernel, asum2_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup asum2_internal
+void asum2_kernel_simd(
+    int64_t n, float const* x, int64_t incx,
+    float* hi, float* lo )
+{
+    asum2_kernel_dispatch( n, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup asum2_internal
+void asum2_kernel_simd(
+    int64_t n, double const* x, int64_t incx,
+    double* hi, double* lo )
+{
+    asum2_kernel_dispatch( n, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup asum2_internal
+void asum2_kernel_simd(
+    int64_t n, std::complex<float> const* x, int64_t incx,
+    float* hi, float* lo )
+{
+    asum2_kernel_dispatch( n, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup asum2_internal
+void asum2_kernel_simd(
+    int64_t n, std::complex<double> const* x, int64_t incx,
+    double* hi, double* lo )
+{
+    asum2_kernel_dispatch( n, x, incx, hi, lo );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no compensated asum.
+/// @ingroup asum2_internal
+///
+template <typename scalar_t>
+real_type<scalar_t> asum2(
+    int64_t n,
+    scalar_t const* x, int64_t incx )
+{
+    // check arguments
+    blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
+    blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::asum2_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n };
+        counter::insert( element, counter::Id::asum2 );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::asum( n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    return blas::asum2< scalar_t >( n, x, incx );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup asum2
+float asum2(
+    int64_t n,
+    float const* x, int64_t incx )
+{
+    return impl::asum2( n, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup asum2
+double asum2(
+    int64_t n,
+    double const* x, int64_t incx )
+{
+    return impl::asum2( n, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup asum2
+float asum2(
+    int64_t n,
+    std::complex<float> const* x, int64_t incx )
+{
+    return impl::asum2( n, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup asum2
+double asum2(
+    int64_t n,
+    std::complex<double> const* x, int64_t incx )
+{
+    return impl::asum2( n, x, incx );
+}
+
+}  // namespace blas
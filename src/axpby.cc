@@ -0,0 +1,106 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template. Some BLAS libraries provide axpby as an extension,
+/// but it isn't standard, and OpenBLAS' is slower than the template.
+/// @ingroup axpby_internal
+///
+template <typename scalar_t>
+void axpby(
+    int64_t n,
+    scalar_t alpha,
+    scalar_t const* x, int64_t incx,
+    scalar_t beta,
+    scalar_t*       y, int64_t incy )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::axpby_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n };
+        counter::insert( element, counter::Id::axpby );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::axpby( n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::axpby< scalar_t, scalar_t >( n, alpha, x, incx, beta, y, incy );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup axpby
+void axpby(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float beta,
+    float*       y, int64_t incy )
+{
+    impl::axpby( n, alpha, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup axpby
+void axpby(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double beta,
+    double*       y, int64_t incy )
+{
+    impl::axpby( n, alpha, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup axpby
+void axpby(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, int64_t incy )
+{
+    impl::axpby( n, alpha, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup axpby
+void axpby(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, int64_t incy )
+{
+    impl::axpby( n, alpha, x, incx, beta, y, incy );
+}
+
+}  // namespace blas
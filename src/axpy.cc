@@ -7,6 +7,9 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "small.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -25,7 +28,11 @@ inline void axpy(
     float const* x, blas_int incx,
     float*       y, blas_int incy )
 {
-    BLAS_saxpy( &n, &alpha, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_saxpy( n, alpha, x, incx, y, incy );
+    #else
+        BLAS_saxpy( &n, &alpha, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -37,7 +44,11 @@ inline void axpy(
     double const* x, blas_int incx,
     double*       y, blas_int incy )
 {
-    BLAS_daxpy( &n, &alpha, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_daxpy( n, alpha, x, incx, y, incy );
+    #else
+        BLAS_daxpy( &n, &alpha, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -49,10 +60,14 @@ inline void axpy(
     std::complex<float> const* x, blas_int incx,
     std::complex<float>*       y, blas_int incy )
 {
-    BLAS_caxpy( &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) x, &incx,
-                (blas_complex_float*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_caxpy( n, &alpha, x, incx, y, incy );
+    #else
+        BLAS_caxpy( &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) x, &incx,
+                    (blas_complex_float*) y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -64,10 +79,82 @@ inline void axpy(
     std::complex<double> const* x, blas_int incx,
     std::complex<double>*       y, blas_int incy )
 {
-    BLAS_zaxpy( &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) x, &incx,
-                (blas_complex_double*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zaxpy( n, &alpha, x, incx, y, incy );
+    #else
+        BLAS_zaxpy( &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) x, &incx,
+                    (blas_complex_double*) y, &incy );
+    #endif
+}
+
+BLAS_SIMD_KERNEL( axpy_kernel, axpy_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// Calls the axpy kernel variant for simd_isa(). In reproducible mode,
+/// calls the generic variant, as FMA in other variants could change
+/// the rounding from one CPU to another.
+/// @ingroup axpy_internal
+template <typename TX, typename TY>
+void axpy_kernel_select(
+    int64_t n, scalar_type<TX, TY> alpha,
+    TX const* x, TY* y )
+{
+    if (get_reproducible())
+        axpy_kernel( n, alpha, x, y );
+    else
+        axpy_kernel_dispatch( n, alpha, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float16 x, float16 y version.
+/// @ingroup axpy_internal
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    float16 const* x, float16* y )
+{
+    axpy_kernel_select( n, alpha, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 x, bfloat16 y version.
+/// @ingroup axpy_internal
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    bfloat16 const* x, bfloat16* y )
+{
+    axpy_kernel_select( n, alpha, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float16 x, float y version.
+/// @ingroup axpy_internal
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    float16 const* x, float* y )
+{
+    axpy_kernel_select( n, alpha, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 x, float y version.
+/// @ingroup axpy_internal
+void axpy_kernel_simd(
+    int64_t n, float alpha,
+    bfloat16 const* x, float* y )
+{
+    axpy_kernel_select( n, alpha, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float x, double y version.
+/// @ingroup axpy_internal
+void axpy_kernel_simd(
+    int64_t n, double alpha,
+    float const* x, double* y )
+{
+    axpy_kernel_select( n, alpha, x, y );
 }
 
 }  // namespace internal
@@ -92,6 +179,18 @@ void axpy(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            axpy( ib, alpha,
+                  internal::vector_block( x, n, incx, i, ib ), incx,
+                  internal::vector_block( y, n, incy, i, ib ), incy );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::axpy_type element;
@@ -103,6 +202,12 @@ void axpy(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    // tiny problems: inline kernel avoids the Fortran call overhead
+    if (internal::use_small_level1( n )) {
+        internal::small_axpy_simd( n, alpha, x, incx, y, incy );
+        return;
+    }
+
     // convert arguments
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
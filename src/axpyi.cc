@@ -0,0 +1,150 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( axpyi_kernel, axpyi_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup axpyi_internal
+void axpyi_kernel_simd(
+    int64_t nz, float alpha,
+    float const* x, int64_t const* indx,
+    float* y )
+{
+    axpyi_kernel_dispatch( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup axpyi_internal
+void axpyi_kernel_simd(
+    int64_t nz, double alpha,
+    double const* x, int64_t const* indx,
+    double* y )
+{
+    axpyi_kernel_dispatch( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup axpyi_internal
+void axpyi_kernel_simd(
+    int64_t nz, std::complex<float> alpha,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y )
+{
+    axpyi_kernel_dispatch( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup axpyi_internal
+void axpyi_kernel_simd(
+    int64_t nz, std::complex<double> alpha,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y )
+{
+    axpyi_kernel_dispatch( nz, alpha, x, indx, y );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup axpyi_internal
+///
+template <typename scalar_t>
+void axpyi(
+    int64_t nz,
+    scalar_t alpha,
+    scalar_t const* x, int64_t const* indx,
+    scalar_t* y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::axpyi_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::axpyi );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::axpy( nz );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::axpyi< scalar_t, scalar_t >( nz, alpha, x, indx, y );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup axpyi
+void axpyi(
+    int64_t nz,
+    float alpha,
+    float const* x, int64_t const* indx,
+    float* y )
+{
+    impl::axpyi( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup axpyi
+void axpyi(
+    int64_t nz,
+    double alpha,
+    double const* x, int64_t const* indx,
+    double* y )
+{
+    impl::axpyi( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup axpyi
+void axpyi(
+    int64_t nz,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y )
+{
+    impl::axpyi( nz, alpha, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup axpyi
+void axpyi(
+    int64_t nz,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y )
+{
+    impl::axpyi( nz, alpha, x, indx, y );
+}
+
+}  // namespace blas
@@ -64,6 +64,36 @@ void herk(
     }
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched version; see wrappers.hh.
+/// @ingroup herk_internal
+///
+template <typename scalar_t>
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    real_type<scalar_t> alpha,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    real_type<scalar_t> beta,
+    scalar_t*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    if (batch_size == 0)
+        return;
+
+    blas::herk( layout, uplo, trans, n, k, alpha, A, lda, beta, C, ldc );
+
+    #pragma omp parallel for schedule( static )
+    for (int64_t i = 1; i < int64_t( batch_size ); ++i) {
+        scalar_t const* A_ = A + i*strideA;
+        scalar_t*       C_ = C + i*strideC;
+        blas::herk( layout, uplo, trans, n, k, alpha, A_, lda, beta, C_,
+                    ldc );
+    }
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -154,5 +184,77 @@ void herk(
                 batch_size, info );
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, float version.
+/// @ingroup herk
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::herk( layout, uplo, trans, n, k, alpha, A, lda, strideA, beta, C,
+                ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, double version.
+/// @ingroup herk
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::herk( layout, uplo, trans, n, k, alpha, A, lda, strideA, beta, C,
+                ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<float> version.
+/// @ingroup herk
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    float alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    float beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::herk( layout, uplo, trans, n, k, alpha, A, lda, strideA, beta, C,
+                ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<double> version.
+/// @ingroup herk
+void herk(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    int64_t n, int64_t k,
+    double alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    double beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::herk( layout, uplo, trans, n, k, alpha, A, lda, strideA, beta, C,
+                ldc, strideC, batch_size );
+}
+
 }  // namespace batch
 }  // namespace blas
@@ -0,0 +1,115 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/batch_common.hh"
+#include "blas.hh"
+#include "small.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks and converts arguments,
+/// then makes individual routine calls in parallel.
+/// Short vectors use the inline nrm2 kernel, see set_small_threshold,
+/// avoiding the vendor call overhead that dominates for them.
+/// @ingroup nrm2_internal
+///
+template <typename scalar_t>
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector<scalar_t*>  const& x, std::vector<int64_t> const& incx,
+    std::vector< real_type<scalar_t> >& result,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    blas_error_if( info.size() != 0
+                   && info.size() != 1
+                   && info.size() != batch_size );
+    if (info.size() > 0) {
+        // perform error checking
+        blas::batch::nrm2_check( n, x, incx, result, batch_size, info );
+    }
+    blas_error_if( result.size() < batch_size );
+
+    // In reproducible mode, use the CPU routine for every vector.
+    int64_t small_n = get_reproducible() ? -1 : internal::small_level1_max();
+
+    // guided schedule balances variable sizes with few scheduling steps
+    #pragma omp parallel for schedule( guided )
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t    n_    = blas::batch::extract( n,    i );
+        int64_t    incx_ = blas::batch::extract( incx, i );
+        scalar_t*  x_    = blas::batch::extract( x,    i );
+        if (n_ <= small_n && incx_ > 0)
+            result[ i ] = internal::small_nrm2_simd( n_, x_, incx_ );
+        else
+            result[ i ] = blas::nrm2( n_, x_, incx_ );
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup nrm2
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    std::vector<float>&            result,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::nrm2( n, x, incx, result, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup nrm2
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    std::vector<double>&           result,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::nrm2( n, x, incx, result, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup nrm2
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    std::vector<float>&            result,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::nrm2( n, x, incx, result, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<double> version.
+/// @ingroup nrm2
+void nrm2(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    std::vector<double>&           result,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::nrm2( n, x, incx, result, batch_size, info );
+}
+
+}  // namespace batch
+}  // namespace blas
@@ -0,0 +1,114 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/batch_common.hh"
+#include "blas.hh"
+#include "small.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched version.
+/// Mid-level templated wrapper checks and converts arguments,
+/// then makes individual routine calls in parallel.
+/// Short vectors use the inline generic scal, see set_small_threshold,
+/// avoiding the vendor call overhead that dominates for them.
+/// @ingroup scal_internal
+///
+template <typename scalar_t>
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector<scalar_t >  const& alpha,
+    std::vector<scalar_t*>  const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    blas_error_if( info.size() != 0
+                   && info.size() != 1
+                   && info.size() != batch_size );
+    if (info.size() > 0) {
+        // perform error checking
+        blas::batch::scal_check( n, alpha, x, incx, batch_size, info );
+    }
+
+    int64_t small_n = internal::small_level1_max();
+
+    // guided schedule balances variable sizes with few scheduling steps
+    #pragma omp parallel for schedule( guided )
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t    n_     = blas::batch::extract( n,     i );
+        int64_t    incx_  = blas::batch::extract( incx,  i );
+        scalar_t   alpha_ = blas::batch::extract( alpha, i );
+        scalar_t*  x_     = blas::batch::extract( x,     i );
+        if (n_ <= small_n)
+            blas::scal< scalar_t >( n_, alpha_, x_, incx_ );
+        else
+            blas::scal( n_, alpha_, x_, incx_ );
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+namespace batch {
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, float version.
+/// @ingroup scal
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector<float >     const& alpha,
+    std::vector<float*>     const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::scal( n, alpha, x, incx, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, double version.
+/// @ingroup scal
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector<double >    const& alpha,
+    std::vector<double*>    const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::scal( n, alpha, x, incx, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<float> version.
+/// @ingroup scal
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<float>  > const& alpha,
+    std::vector< std::complex<float>* > const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::scal( n, alpha, x, incx, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, variable-size batched, complex<double> version.
+/// @ingroup scal
+void scal(
+    std::vector<int64_t>    const& n,
+    std::vector< std::complex<double>  > const& alpha,
+    std::vector< std::complex<double>* > const& x, std::vector<int64_t> const& incx,
+    size_t batch_size,
+    std::vector<int64_t>& info )
+{
+    impl::scal( n, alpha, x, incx, batch_size, info );
+}
+
+}  // namespace batch
+}  // namespace blas
@@ -65,6 +65,39 @@ void symm(
     }
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched version; see wrappers.hh.
+/// @ingroup symm_internal
+///
+template <typename scalar_t>
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t const* B, int64_t ldb, int64_t strideB,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    if (batch_size == 0)
+        return;
+
+    blas::symm( layout, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C,
+                ldc );
+
+    #pragma omp parallel for schedule( static )
+    for (int64_t i = 1; i < int64_t( batch_size ); ++i) {
+        scalar_t const* A_ = A + i*strideA;
+        scalar_t const* B_ = B + i*strideB;
+        scalar_t*       C_ = C + i*strideC;
+        blas::symm( layout, side, uplo, m, n, alpha, A_, lda, B_, ldb, beta,
+                    C_, ldc );
+    }
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -159,5 +192,81 @@ void symm(
                 batch_size, info );
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, float version.
+/// @ingroup symm
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* B, int64_t ldb, int64_t strideB,
+    float beta,
+    float*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::symm( layout, side, uplo, m, n, alpha, A, lda, strideA, B, ldb,
+                strideB, beta, C, ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, double version.
+/// @ingroup symm
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* B, int64_t ldb, int64_t strideB,
+    double beta,
+    double*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::symm( layout, side, uplo, m, n, alpha, A, lda, strideA, B, ldb,
+                strideB, beta, C, ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<float> version.
+/// @ingroup symm
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* B, int64_t ldb, int64_t strideB,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::symm( layout, side, uplo, m, n, alpha, A, lda, strideA, B, ldb,
+                strideB, beta, C, ldc, strideC, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<double> version.
+/// @ingroup symm
+void symm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* B, int64_t ldb, int64_t strideB,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc, int64_t strideC,
+    size_t batch_size )
+{
+    impl::symm( layout, side, uplo, m, n, alpha, A, lda, strideA, B, ldb,
+                strideB, beta, C, ldc, strideC, batch_size );
+}
+
 }  // namespace batch
 }  // namespace blas
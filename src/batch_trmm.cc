@@ -63,6 +63,38 @@ void trmm(
     }
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched version; see wrappers.hh.
+/// @ingroup trmm_internal
+///
+template <typename scalar_t>
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size )
+{
+    if (batch_size == 0)
+        return;
+
+    blas::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda, B,
+                ldb );
+
+    #pragma omp parallel for schedule( static )
+    for (int64_t i = 1; i < int64_t( batch_size ); ++i) {
+        scalar_t const* A_ = A + i*strideA;
+        scalar_t*       B_ = B + i*strideB;
+        blas::trmm( layout, side, uplo, trans, diag, m, n, alpha, A_, lda,
+                    B_, ldb );
+    }
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -157,5 +189,81 @@ void trmm(
                 batch_size, info );
 }
 
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, float version.
+/// @ingroup trmm
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda, int64_t strideA,
+    float*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size )
+{
+    impl::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda,
+                strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, double version.
+/// @ingroup trmm
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda, int64_t strideA,
+    double*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size )
+{
+    impl::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda,
+                strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<float> version.
+/// @ingroup trmm
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size )
+{
+    impl::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda,
+                strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, fixed-size strided batched, complex<double> version.
+/// @ingroup trmm
+void trmm(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>*       B, int64_t ldb, int64_t strideB,
+    size_t batch_size )
+{
+    impl::trmm( layout, side, uplo, trans, diag, m, n, alpha, A, lda,
+                strideA, B, ldb, strideB, batch_size );
+}
+
 }  // namespace batch
 }  // namespace blas
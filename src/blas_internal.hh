@@ -7,6 +7,7 @@
 #define BLAS_INTERNAL_HH
 
 #include "blas/util.hh"
+#include "blas/parallel.hh"
 
 namespace blas {
 
@@ -31,6 +32,19 @@ inline blas_int to_blas_int_( int64_t x, const char* x_str )
 ///
 #define to_blas_int( x ) to_blas_int_( x, #x )
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return pointer to element (i, j) of A, in the given layout.
+///
+template <typename T>
+T* matrix_block( blas::Layout layout, T* A, int64_t lda, int64_t i, int64_t j )
+{
+    return (layout == Layout::ColMajor ? A + i + j*lda : A + i*lda + j);
+}
+
+}  // namespace internal
+
 }  // namespace blas
 
 #endif // BLAS_INTERNAL_HH
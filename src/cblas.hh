@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_CBLAS_HH
+#define BLAS_CBLAS_HH
+
+#include "blas/defines.h"
+
+// With BLAS_USE_CBLAS (CMake and make option use_cblas), the low-level
+// wrappers call cblas_* instead of the Fortran BLAS_* interface.
+// CBLAS passes scalars by value and returns complex dot products via an
+// argument, avoiding the Fortran calling convention overheads and
+// the complex return type ambiguity. Routines that CBLAS lacks,
+// e.g., complex symv, syr, and rot, still use the Fortran interface.
+#ifdef BLAS_USE_CBLAS
+
+#if defined(BLAS_HAVE_MKL)
+    #if defined(BLAS_ILP64) && ! defined(MKL_ILP64)
+        #define MKL_ILP64
+    #endif
+    #include <mkl_cblas.h>
+
+#elif defined(BLAS_HAVE_ESSL)
+    #if defined(BLAS_ILP64) && ! defined(_ESV6464)
+        #define _ESV6464
+    #endif
+    #include <essl.h>
+
+#elif defined(BLAS_HAVE_ACCELERATE)
+    // See test/cblas_wrappers.hh regarding Accelerate.h.
+    #ifdef BLAS_HAVE_ACCELERATE_CBLAS_H
+        #include <cblas.h>
+    #else
+        #include <Accelerate/Accelerate.h>
+    #endif
+    typedef CBLAS_ORDER CBLAS_LAYOUT;
+
+#else
+    // Some ancient cblas.h don't include extern C. It's okay to nest.
+    extern "C" {
+    #include <cblas.h>
+    }
+
+    // Original cblas.h used CBLAS_ORDER; new uses CBLAS_LAYOUT and makes
+    // CBLAS_ORDER a typedef. Make sure CBLAS_LAYOUT is defined.
+    typedef CBLAS_ORDER CBLAS_LAYOUT;
+#endif
+
+#include "blas/util.hh"
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Converts BLAS++ enums and Fortran characters to CBLAS constants.
+/// Arguments are assumed to be already checked.
+/// @ingroup cblas_internal
+inline CBLAS_LAYOUT cblas_layout( blas::Layout layout )
+{
+    return layout == Layout::RowMajor ? CblasRowMajor : CblasColMajor;
+}
+
+inline CBLAS_TRANSPOSE cblas_trans( char trans )
+{
+    switch (trans) {
+        case 't': case 'T': return CblasTrans;
+        case 'c': case 'C': return CblasConjTrans;
+        default:            return CblasNoTrans;
+    }
+}
+
+inline CBLAS_TRANSPOSE cblas_trans( blas::Op trans )
+{
+    return cblas_trans( to_char( trans ) );
+}
+
+inline CBLAS_UPLO cblas_uplo( char uplo )
+{
+    return (uplo == 'u' || uplo == 'U') ? CblasUpper : CblasLower;
+}
+
+inline CBLAS_UPLO cblas_uplo( blas::Uplo uplo )
+{
+    return cblas_uplo( to_char( uplo ) );
+}
+
+inline CBLAS_DIAG cblas_diag( char diag )
+{
+    return (diag == 'u' || diag == 'U') ? CblasUnit : CblasNonUnit;
+}
+
+inline CBLAS_DIAG cblas_diag( blas::Diag diag )
+{
+    return cblas_diag( to_char( diag ) );
+}
+
+inline CBLAS_SIDE cblas_side( char side )
+{
+    return (side == 'r' || side == 'R') ? CblasRight : CblasLeft;
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
+#endif        //  #ifndef BLAS_CBLAS_HH
@@ -7,6 +7,8 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -24,7 +26,11 @@ inline void copy(
     float const* x, blas_int incx,
     float*       y, blas_int incy )
 {
-    BLAS_scopy( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_scopy( n, x, incx, y, incy );
+    #else
+        BLAS_scopy( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -35,7 +41,11 @@ inline void copy(
     double const* x, blas_int incx,
     double*       y, blas_int incy )
 {
-    BLAS_dcopy( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dcopy( n, x, incx, y, incy );
+    #else
+        BLAS_dcopy( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,9 +56,13 @@ inline void copy(
     std::complex<float> const* x, blas_int incx,
     std::complex<float>*       y, blas_int incy )
 {
-    BLAS_ccopy( &n,
-                (blas_complex_float*) x, &incx,
-                (blas_complex_float*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ccopy( n, x, incx, y, incy );
+    #else
+        BLAS_ccopy( &n,
+                    (blas_complex_float*) x, &incx,
+                    (blas_complex_float*) y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -59,9 +73,69 @@ inline void copy(
     std::complex<double> const* x, blas_int incx,
     std::complex<double>*       y, blas_int incy )
 {
-    BLAS_zcopy( &n,
-                (blas_complex_double*) x, &incx,
-                (blas_complex_double*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zcopy( n, x, incx, y, incy );
+    #else
+        BLAS_zcopy( &n,
+                    (blas_complex_double*) x, &incx,
+                    (blas_complex_double*) y, &incy );
+    #endif
+}
+
+BLAS_SIMD_KERNEL( copy_kernel, copy_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float16 x, float y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, float16 const* x, float* y )
+{
+    copy_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float x, float16 y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, float const* x, float16* y )
+{
+    copy_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 x, float y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, bfloat16 const* x, float* y )
+{
+    copy_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float x, bfloat16 y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, float const* x, bfloat16* y )
+{
+    copy_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float x, double y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, float const* x, double* y )
+{
+    copy_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// double x, float y version.
+/// @ingroup copy_internal
+void copy_kernel_simd(
+    int64_t n, double const* x, float* y )
+{
+    copy_kernel_dispatch( n, x, y );
 }
 
 }  // namespace internal
@@ -85,6 +159,18 @@ void copy(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            copy( ib,
+                  internal::vector_block( x, n, incx, i, ib ), incx,
+                  internal::vector_block( y, n, incy, i, ib ), incy );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::copy_type element;
@@ -0,0 +1,286 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/device_blas.hh"
+#include "blas/counter.hh"
+
+#include "device_internal.hh"
+
+#include <limits>
+#include <string.h>
+
+namespace blas {
+
+#if defined( BLAS_HAVE_DEVICE ) && ! defined( BLAS_HAVE_SYCL )
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Block size for the diagonal blocks of gemmt_recursive.
+/// @ingroup gemmt_internal
+constexpr int64_t device_gemmt_nb = 32;
+
+//------------------------------------------------------------------------------
+/// Triangle-only gemm for cuBLAS and rocBLAS, which lack gemmt.
+/// Splits the n-by-n triangle of C into two triangles of size n/2 and
+/// an (n/2)-by-(n/2) off-diagonal block, which is one device gemm,
+/// recursively. For n <= nb, computes the triangle one column at a time,
+/// each column being an (n - j)-by-1 or (j + 1)-by-1 device gemm.
+/// Without a kernel to update a triangle from a workspace, the diagonal
+/// blocks cost about n small launches in all, so gemmt pays off over gemm
+/// once k and n are large enough to hide them.
+///
+/// Arguments are as for gemmt, with layout ColMajor.
+/// @ingroup gemmt_internal
+template <typename scalar_t>
+void gemmt_recursive(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+    device_blas_int k_   = to_device_blas_int( k );
+    device_blas_int lda_ = to_device_blas_int( lda );
+    device_blas_int ldb_ = to_device_blas_int( ldb );
+    device_blas_int ldc_ = to_device_blas_int( ldc );
+
+    // op(A)( i, : ) and op(B)( :, j )
+    auto Ai = [&]( int64_t i ) {
+        return (transA == Op::NoTrans ? &A[ i ] : &A[ i*lda ]);
+    };
+    auto Bj = [&]( int64_t j ) {
+        return (transB == Op::NoTrans ? &B[ j*ldb ] : &B[ j ]);
+    };
+
+    if (n <= device_gemmt_nb) {
+        bool lower = (uplo == Uplo::Lower);
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t i0 = (lower ? j : 0);
+            int64_t ib = (lower ? n - j : j + 1);
+            internal::gemm( transA, transB,
+                            to_device_blas_int( ib ), 1, k_,
+                            alpha, Ai( i0 ), lda_, Bj( j ), ldb_,
+                            beta, &C[ i0 + j*ldc ], ldc_, queue );
+        }
+        return;
+    }
+
+    // [ C11     ]  or  [ C11 C12 ]
+    // [ C21 C22 ]      [     C22 ]
+    int64_t n1 = n / 2;
+    int64_t n2 = n - n1;
+    device_blas_int n1_ = to_device_blas_int( n1 );
+    device_blas_int n2_ = to_device_blas_int( n2 );
+
+    gemmt_recursive( uplo, transA, transB, n1, k,
+                     alpha, A, lda, B, ldb, beta, C, ldc, queue );
+    if (uplo == Uplo::Lower) {
+        // C21 = alpha op(A)( n1:n, : ) op(B)( :, 0:n1 ) + beta C21
+        internal::gemm( transA, transB, n2_, n1_, k_,
+                        alpha, Ai( n1 ), lda_, B, ldb_,
+                        beta, &C[ n1 ], ldc_, queue );
+    }
+    else {
+        // C12 = alpha op(A)( 0:n1, : ) op(B)( :, n1:n ) + beta C12
+        internal::gemm( transA, transB, n1_, n2_, k_,
+                        alpha, A, lda_, Bj( n1 ), ldb_,
+                        beta, &C[ n1*ldc ], ldc_, queue );
+    }
+    gemmt_recursive( uplo, transA, transB, n2, k,
+                     alpha, Ai( n1 ), lda, Bj( n1 ), ldb,
+                     beta, &C[ n1 + n1*ldc ], ldc, queue );
+}
+
+}  // namespace internal
+
+#endif  // BLAS_HAVE_DEVICE && ! BLAS_HAVE_SYCL
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then calls low-level wrapper.
+/// @ingroup gemmt_internal
+///
+template <typename scalar_t>
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+#ifndef BLAS_HAVE_DEVICE
+    throw blas::Error( "device BLAS not available", __func__ );
+#else
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::dev_gemmt_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { uplo, transA, transB, n, k };
+        counter::insert( element, counter::Id::dev_gemmt );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::gemmt( n, k );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    // quick return
+    if (n == 0)
+        return;
+
+    if (layout == Layout::RowMajor) {
+        // C^T = op(B)^T op(A)^T: swap lower <=> upper,
+        // transA <=> transB, B <=> A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        std::swap( transA, transB );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+    }
+
+    blas::internal_set_device( queue.device() );
+
+    #if defined( BLAS_HAVE_SYCL )
+        // convert arguments
+        device_blas_int n_   = to_device_blas_int( n );
+        device_blas_int k_   = to_device_blas_int( k );
+        device_blas_int lda_ = to_device_blas_int( lda );
+        device_blas_int ldb_ = to_device_blas_int( ldb );
+        device_blas_int ldc_ = to_device_blas_int( ldc );
+
+        // call low-level wrapper
+        internal::gemmt( uplo, transA, transB, n_, k_,
+                         alpha, A, lda_, B, ldb_, beta, C, ldc_, queue );
+    #else
+        internal::gemmt_recursive( uplo, transA, transB, n, k,
+                                   alpha, A, lda, B, ldb, beta, C, ldc,
+                                   queue );
+    #endif
+#endif
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// GPU device, float version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc, queue );
+}
+
+//------------------------------------------------------------------------------
+/// GPU device, double version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc, queue );
+}
+
+//------------------------------------------------------------------------------
+/// GPU device, complex<float> version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc, queue );
+}
+
+//------------------------------------------------------------------------------
+/// GPU device, complex<double> version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc,
+    blas::Queue& queue )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc, queue );
+}
+
+}  // namespace blas
@@ -520,6 +520,52 @@ void gemm(
     std::complex<double>       *dC, device_blas_int lddc,
     blas::Queue& queue );
 
+//------------------------------------------------------------------------------
+// oneMKL only; cuBLAS and rocBLAS lack gemmt, see src/device_gemmt.cc.
+#if defined( BLAS_HAVE_SYCL )
+
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda,
+    float const *dB, device_blas_int lddb,
+    float beta,
+    float       *dC, device_blas_int lddc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda,
+    double const *dB, device_blas_int lddb,
+    double beta,
+    double       *dC, device_blas_int lddc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda,
+    std::complex<float> const *dB, device_blas_int lddb,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc,
+    blas::Queue& queue );
+
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda,
+    std::complex<double> const *dB, device_blas_int lddb,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc,
+    blas::Queue& queue );
+
+#endif  // BLAS_HAVE_SYCL
+
 //------------------------------------------------------------------------------
 void trsm(
     blas::Side side, blas::Uplo uplo, blas::Op trans, blas::Diag diag,
@@ -7,6 +7,10 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "reproducible.hh"
+#include "small.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -24,7 +28,11 @@ inline float dot(
     float const* x, blas_int incx,
     float const* y, blas_int incy )
 {
-    return BLAS_sdot( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_sdot( n, x, incx, y, incy );
+    #else
+        return BLAS_sdot( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -35,7 +43,11 @@ inline double dot(
     double const* x, blas_int incx,
     double const* y, blas_int incy )
 {
-    return BLAS_ddot( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_ddot( n, x, incx, y, incy );
+    #else
+        return BLAS_ddot( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,7 +58,11 @@ inline std::complex<float> dot(
     std::complex<float> const* x, blas_int incx,
     std::complex<float> const* y, blas_int incy )
 {
-    #ifdef BLAS_COMPLEX_RETURN_ARGUMENT
+    #if defined(BLAS_USE_CBLAS)
+        std::complex<float> value;
+        cblas_cdotc_sub( n, x, incx, y, incy, &value );
+        return value;
+    #elif defined(BLAS_COMPLEX_RETURN_ARGUMENT)
         // Intel icc convention
         std::complex<float> value;
         BLAS_cdotc( (blas_complex_float*) &value, &n,
@@ -71,7 +87,11 @@ inline std::complex<double> dot(
     std::complex<double> const* x, blas_int incx,
     std::complex<double> const* y, blas_int incy )
 {
-    #ifdef BLAS_COMPLEX_RETURN_ARGUMENT
+    #if defined(BLAS_USE_CBLAS)
+        std::complex<double> value;
+        cblas_zdotc_sub( n, x, incx, y, incy, &value );
+        return value;
+    #elif defined(BLAS_COMPLEX_RETURN_ARGUMENT)
         // Intel icc convention
         std::complex<double> value;
         BLAS_zdotc( (blas_complex_double*) &value, &n,
@@ -100,7 +120,11 @@ inline std::complex<float> dotu(
     std::complex<float> const* x, blas_int incx,
     std::complex<float> const* y, blas_int incy )
 {
-    #ifdef BLAS_COMPLEX_RETURN_ARGUMENT
+    #if defined(BLAS_USE_CBLAS)
+        std::complex<float> value;
+        cblas_cdotu_sub( n, x, incx, y, incy, &value );
+        return value;
+    #elif defined(BLAS_COMPLEX_RETURN_ARGUMENT)
         // Intel icc convention
         std::complex<float> value;
         BLAS_cdotu( (blas_complex_float*) &value, &n,
@@ -126,7 +150,11 @@ inline std::complex<double> dotu(
     std::complex<double> const* x, blas_int incx,
     std::complex<double> const* y, blas_int incy )
 {
-    #ifdef BLAS_COMPLEX_RETURN_ARGUMENT
+    #if defined(BLAS_USE_CBLAS)
+        std::complex<double> value;
+        cblas_zdotu_sub( n, x, incx, y, incy, &value );
+        return value;
+    #elif defined(BLAS_COMPLEX_RETURN_ARGUMENT)
         // Intel icc convention
         std::complex<double> value;
         BLAS_zdotu( (blas_complex_double*) &value, &n,
@@ -143,6 +171,68 @@ inline std::complex<double> dotu(
     #endif
 }
 
+BLAS_SIMD_KERNEL( dot_kernel, dot_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// Calls the dot kernel variant for simd_isa(). In reproducible mode,
+/// calls the generic variant, as the vector width of other variants
+/// changes the order of the sum from one CPU to another.
+/// @ingroup dot_internal
+template <typename TX, typename TY>
+scalar_type<TX, TY> dot_kernel_select(
+    int64_t n, TX const* x, TY const* y )
+{
+    if (get_reproducible())
+        return dot_kernel( n, x, y );
+    else
+        return dot_kernel_dispatch( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float16 x, float16 y version.
+/// @ingroup dot_internal
+float dot_kernel_simd(
+    int64_t n, float16 const* x, float16 const* y )
+{
+    return dot_kernel_select( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 x, bfloat16 y version.
+/// @ingroup dot_internal
+float dot_kernel_simd(
+    int64_t n, bfloat16 const* x, bfloat16 const* y )
+{
+    return dot_kernel_select( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float16 x, float y version.
+/// @ingroup dot_internal
+float dot_kernel_simd(
+    int64_t n, float16 const* x, float const* y )
+{
+    return dot_kernel_select( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 x, float y version.
+/// @ingroup dot_internal
+float dot_kernel_simd(
+    int64_t n, bfloat16 const* x, float const* y )
+{
+    return dot_kernel_select( n, x, y );
+}
+
+//------------------------------------------------------------------------------
+/// float x, double y version.
+/// @ingroup dot_internal
+double dot_kernel_simd(
+    int64_t n, float const* x, double const* y )
+{
+    return dot_kernel_select( n, x, y );
+}
+
 }  // namespace internal
 
 //==============================================================================
@@ -165,6 +255,19 @@ scalar_t dot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        scalar_t result = 0;
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            result += dot( ib,
+                           internal::vector_block( x, n, incx, i, ib ), incx,
+                           internal::vector_block( y, n, incy, i, ib ), incy );
+        }
+        return result;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::dot_type element;
@@ -176,6 +279,13 @@ scalar_t dot(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    if (get_reproducible())
+        return internal::reproducible_dot( true, n, x, incx, y, incy );
+
+    // tiny problems: inline kernel avoids the Fortran call overhead
+    if (internal::use_small_level1( n ))
+        return internal::small_dot_simd( true, n, x, incx, y, incy );
+
     // convert arguments
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
@@ -202,6 +312,19 @@ scalar_t dotu(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        scalar_t result = 0;
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            result += dotu( ib,
+                            internal::vector_block( x, n, incx, i, ib ), incx,
+                            internal::vector_block( y, n, incy, i, ib ), incy );
+        }
+        return result;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::dotu_type element;
@@ -210,6 +333,13 @@ scalar_t dotu(
         counter::insert( element, counter::Id::dotu );
     #endif
 
+    if (get_reproducible())
+        return internal::reproducible_dot( false, n, x, incx, y, incy );
+
+    // tiny problems: inline kernel avoids the Fortran call overhead
+    if (internal::use_small_level1( n ))
+        return internal::small_dot_simd( false, n, x, incx, y, incy );
+
     // convert arguments
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
@@ -0,0 +1,151 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( dot2_kernel, dot2_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup dot2_internal
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    float const* x, int64_t incx,
+    float const* y, int64_t incy,
+    float* hi, float* lo )
+{
+    dot2_kernel_dispatch( conj_x, n, x, incx, y, incy, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup dot2_internal
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    double const* x, int64_t incx,
+    double const* y, int64_t incy,
+    double* hi, double* lo )
+{
+    dot2_kernel_dispatch( conj_x, n, x, incx, y, incy, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup dot2_internal
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>* hi, std::complex<float>* lo )
+{
+    dot2_kernel_dispatch( conj_x, n, x, incx, y, incy, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup dot2_internal
+void dot2_kernel_simd(
+    bool conj_x, int64_t n,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>* hi, std::complex<double>* lo )
+{
+    dot2_kernel_dispatch( conj_x, n, x, incx, y, incy, hi, lo );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no compensated dot.
+/// @ingroup dot2_internal
+///
+template <typename scalar_t>
+scalar_t dot2(
+    int64_t n,
+    scalar_t const* x, int64_t incx,
+    scalar_t const* y, int64_t incy )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::dot2_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n };
+        counter::insert( element, counter::Id::dot2 );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::dot( n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    return blas::dot2< scalar_t >( n, x, incx, y, incy );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup dot2
+float dot2(
+    int64_t n,
+    float const* x, int64_t incx,
+    float const* y, int64_t incy )
+{
+    return impl::dot2( n, x, incx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup dot2
+double dot2(
+    int64_t n,
+    double const* x, int64_t incx,
+    double const* y, int64_t incy )
+{
+    return impl::dot2( n, x, incx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup dot2
+std::complex<float> dot2(
+    int64_t n,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> const* y, int64_t incy )
+{
+    return impl::dot2( n, x, incx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup dot2
+std::complex<double> dot2(
+    int64_t n,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> const* y, int64_t incy )
+{
+    return impl::dot2( n, x, incx, y, incy );
+}
+
+}  // namespace blas
@@ -0,0 +1,107 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no fused dot and axpy.
+/// @ingroup dot_axpy_internal
+///
+template <typename scalar_t>
+scalar_t dot_axpy(
+    int64_t n,
+    scalar_t alpha,
+    scalar_t const* x, int64_t incx,
+    scalar_t*       y, int64_t incy,
+    scalar_t const* z, int64_t incz )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+    blas_error_if( incz == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::dot_axpy_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n };
+        counter::insert( element, counter::Id::dot_axpy );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::dot_axpy( n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    return blas::dot_axpy< scalar_t, scalar_t, scalar_t >(
+        n, alpha, x, incx, y, incy, z, incz );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup dot_axpy
+float dot_axpy(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float*       y, int64_t incy,
+    float const* z, int64_t incz )
+{
+    return impl::dot_axpy( n, alpha, x, incx, y, incy, z, incz );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup dot_axpy
+double dot_axpy(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double*       y, int64_t incy,
+    double const* z, int64_t incz )
+{
+    return impl::dot_axpy( n, alpha, x, incx, y, incy, z, incz );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup dot_axpy
+std::complex<float> dot_axpy(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float>*       y, int64_t incy,
+    std::complex<float> const* z, int64_t incz )
+{
+    return impl::dot_axpy( n, alpha, x, incx, y, incy, z, incz );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup dot_axpy
+std::complex<double> dot_axpy(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double>*       y, int64_t incy,
+    std::complex<double> const* z, int64_t incz )
+{
+    return impl::dot_axpy( n, alpha, x, incx, y, incy, z, incz );
+}
+
+}  // namespace blas
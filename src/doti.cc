@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( doti_kernel, doti_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup doti_internal
+float doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y )
+{
+    return doti_kernel_dispatch( conj_x, nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup doti_internal
+double doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y )
+{
+    return doti_kernel_dispatch( conj_x, nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup doti_internal
+std::complex<float> doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y )
+{
+    return doti_kernel_dispatch( conj_x, nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup doti_internal
+std::complex<double> doti_kernel_simd(
+    bool conj_x, int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y )
+{
+    return doti_kernel_dispatch( conj_x, nz, x, indx, y );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup doti_internal
+///
+template <typename scalar_t>
+scalar_t doti(
+    int64_t nz,
+    scalar_t const* x, int64_t const* indx,
+    scalar_t const* y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::doti_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::doti );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::dot( nz );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    return blas::doti< scalar_t, scalar_t >( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup dotui_internal
+///
+template <typename scalar_t>
+scalar_t dotui(
+    int64_t nz,
+    scalar_t const* x, int64_t const* indx,
+    scalar_t const* y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::dotui_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::dotui );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::dot( nz );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    return blas::dotui< scalar_t, scalar_t >( nz, x, indx, y );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup doti
+float doti(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y )
+{
+    return impl::doti( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup doti
+double doti(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y )
+{
+    return impl::doti( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup doti
+std::complex<float> doti(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y )
+{
+    return impl::doti( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup doti
+std::complex<double> doti(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y )
+{
+    return impl::doti( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup dotui
+float dotui(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float const* y )
+{
+    return impl::dotui( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup dotui
+double dotui(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double const* y )
+{
+    return impl::dotui( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup dotui
+std::complex<float> dotui(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float> const* y )
+{
+    return impl::dotui( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup dotui
+std::complex<double> dotui(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double> const* y )
+{
+    return impl::dotui( nz, x, indx, y );
+}
+
+}  // namespace blas
@@ -7,12 +7,52 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "reproducible.hh"
+#include "small.hh"
+#include "cblas.hh"
 
+#include <atomic>
 #include <limits>
 #include <string.h>
+#include <type_traits>
+#include <vector>
 
 namespace blas {
 
+namespace {
+
+// 0 disables Strassen-Winograd.
+std::atomic<int64_t> g_strassen_cutoff( 0 );
+
+// 0 disables 3M.
+std::atomic<int64_t> g_gemm3m_cutoff( 0 );
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void set_strassen_cutoff( int64_t cutoff )
+{
+    g_strassen_cutoff = max( cutoff, int64_t( 0 ) );
+}
+
+//------------------------------------------------------------------------------
+int64_t get_strassen_cutoff()
+{
+    return g_strassen_cutoff;
+}
+
+//------------------------------------------------------------------------------
+void set_gemm3m_cutoff( int64_t cutoff )
+{
+    g_gemm3m_cutoff = max( cutoff, int64_t( 0 ) );
+}
+
+//------------------------------------------------------------------------------
+int64_t get_gemm3m_cutoff()
+{
+    return g_gemm3m_cutoff;
+}
+
 //==============================================================================
 namespace internal {
 
@@ -28,8 +68,14 @@ inline void gemm(
     float beta,
     float*       C, blas_int ldc )
 {
-    BLAS_sgemm( &transA, &transB, &m, &n, &k,
-                &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_sgemm( CblasColMajor, cblas_trans( transA ),
+                     cblas_trans( transB ), m, n, k, alpha, A, lda, B, ldb,
+                     beta, C, ldc );
+    #else
+        BLAS_sgemm( &transA, &transB, &m, &n, &k,
+                    &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -44,8 +90,14 @@ inline void gemm(
     double beta,
     double*       C, blas_int ldc )
 {
-    BLAS_dgemm( &transA, &transB, &m, &n, &k,
-                &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dgemm( CblasColMajor, cblas_trans( transA ),
+                     cblas_trans( transB ), m, n, k, alpha, A, lda, B, ldb,
+                     beta, C, ldc );
+    #else
+        BLAS_dgemm( &transA, &transB, &m, &n, &k,
+                    &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -60,12 +112,18 @@ inline void gemm(
     std::complex<float> beta,
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_cgemm( &transA, &transB, &m, &n, &k,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) A, &lda,
-                (blas_complex_float*) B, &ldb,
-                (blas_complex_float*) &beta,
-                (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cgemm( CblasColMajor, cblas_trans( transA ),
+                     cblas_trans( transB ), m, n, k, &alpha, A, lda, B, ldb,
+                     &beta, C, ldc );
+    #else
+        BLAS_cgemm( &transA, &transB, &m, &n, &k,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) A, &lda,
+                    (blas_complex_float*) B, &ldb,
+                    (blas_complex_float*) &beta,
+                    (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -80,12 +138,476 @@ inline void gemm(
     std::complex<double> beta,
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zgemm( &transA, &transB, &m, &n, &k,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) A, &lda,
-                (blas_complex_double*) B, &ldb,
-                (blas_complex_double*) &beta,
-                (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zgemm( CblasColMajor, cblas_trans( transA ),
+                     cblas_trans( transB ), m, n, k, &alpha, A, lda, B, ldb,
+                     &beta, C, ldc );
+    #else
+        BLAS_zgemm( &transA, &transB, &m, &n, &k,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) A, &lda,
+                    (blas_complex_double*) B, &ldb,
+                    (blas_complex_double*) &beta,
+                    (blas_complex_double*) C, &ldc );
+    #endif
+}
+
+#ifdef BLAS_HAVE_GEMM3M
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran gemm3m, complex<float> version.
+/// @ingroup gemm_internal
+inline void gemm3m(
+    char transA, char transB,
+    blas_int m, blas_int n, blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, blas_int lda,
+    std::complex<float> const* B, blas_int ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, blas_int ldc )
+{
+    BLAS_cgemm3m( &transA, &transB, &m, &n, &k,
+                  (blas_complex_float*) &alpha,
+                  (blas_complex_float*) A, &lda,
+                  (blas_complex_float*) B, &ldb,
+                  (blas_complex_float*) &beta,
+                  (blas_complex_float*) C, &ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran gemm3m, complex<double> version.
+/// @ingroup gemm_internal
+inline void gemm3m(
+    char transA, char transB,
+    blas_int m, blas_int n, blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, blas_int lda,
+    std::complex<double> const* B, blas_int ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, blas_int ldc )
+{
+    BLAS_zgemm3m( &transA, &transB, &m, &n, &k,
+                  (blas_complex_double*) &alpha,
+                  (blas_complex_double*) A, &lda,
+                  (blas_complex_double*) B, &ldb,
+                  (blas_complex_double*) &beta,
+                  (blas_complex_double*) C, &ldc );
+}
+
+#else
+
+//------------------------------------------------------------------------------
+/// Block size of the BLAS++ 3M gemm. C is computed in nb-by-nb tiles,
+/// summing over k in blocks of nb, so the real products are nb^3 and
+/// the workspace is 7 nb^2 reals, regardless of m, n, k.
+/// @ingroup gemm_internal
+const int64_t gemm3m_nb = 1024;
+
+//------------------------------------------------------------------------------
+/// Splits the m-by-n matrix op(X) into its real part Xr and imaginary
+/// part Xi, each m-by-n with leading dimension m. For ConjTrans,
+/// Xi is negated.
+/// @ingroup gemm_internal
+template <typename real_t>
+void gemm3m_split(
+    blas::Op trans,
+    int64_t m, int64_t n,
+    std::complex<real_t> const* X, int64_t ldx,
+    real_t* Xr, real_t* Xi )
+{
+    if (trans == Op::NoTrans) {
+        for (int64_t j = 0; j < n; ++j) {
+            std::complex<real_t> const* Xj = &X[ j*ldx ];
+            #pragma omp simd
+            for (int64_t i = 0; i < m; ++i) {
+                Xr[ i + j*m ] = real( Xj[ i ] );
+                Xi[ i + j*m ] = imag( Xj[ i ] );
+            }
+        }
+    }
+    else {
+        // transpose in nb-by-nb tiles, as in strassen_add
+        const int64_t nb = 32;
+        real_t sign = (trans == Op::ConjTrans ? -1 : 1);
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t j1 = min( j0 + nb, n );
+            for (int64_t i0 = 0; i0 < m; i0 += nb) {
+                int64_t i1 = min( i0 + nb, m );
+                for (int64_t j = j0; j < j1; ++j) {
+                    for (int64_t i = i0; i < i1; ++i) {
+                        Xr[ i + j*m ] = real( X[ j + i*ldx ] );
+                        Xi[ i + j*m ] = sign * imag( X[ j + i*ldx ] );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// 3M gemm: C = alpha op(A) op(B) + beta C, for column-major complex
+/// matrices, using 3 real gemms instead of the 4 in conventional gemm.
+/// With op(A) = Ar + i Ai and op(B) = Br + i Bi split into real planes,
+///     T1 = Ar Br,   T2 = Ai Bi,   T3 = (Ar + Ai) (Br + Bi),
+///     op(A) op(B) = (T1 - T2) + i (T3 - T1 - T2).
+/// The real gemms call the vendor sgemm or dgemm.
+///
+/// The workspace is kept per thread and reused across calls, growing as
+/// needed up to 7 gemm3m_nb^2 reals.
+/// @ingroup gemm_internal
+template <typename real_t>
+void gemm_3m(
+    blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<real_t> alpha,
+    std::complex<real_t> const* A, int64_t lda,
+    std::complex<real_t> const* B, int64_t ldb,
+    std::complex<real_t> beta,
+    std::complex<real_t>*       C, int64_t ldc )
+{
+    using scalar_t = std::complex<real_t>;
+
+    const real_t zero = 0;
+    const real_t one  = 1;
+    const Op NoTrans = Op::NoTrans;
+    const int64_t nb = gemm3m_nb;
+
+    int64_t mb_max = min( m, nb );
+    int64_t nb_max = min( n, nb );
+    int64_t kb_max = min( k, nb );
+    size_t lwork = 2*mb_max*kb_max + 2*kb_max*nb_max + 3*mb_max*nb_max;
+    static thread_local std::vector<real_t> work;
+    if (work.size() < lwork)
+        work.resize( lwork );
+
+    real_t* Ar = work.data();       // mb-by-kb
+    real_t* Ai = Ar + mb_max*kb_max;
+    real_t* Br = Ai + mb_max*kb_max;  // kb-by-nb
+    real_t* Bi = Br + kb_max*nb_max;
+    real_t* T1 = Bi + kb_max*nb_max;  // mb-by-nb
+    real_t* T2 = T1 + mb_max*nb_max;
+    real_t* T3 = T2 + mb_max*nb_max;
+
+    for (int64_t j0 = 0; j0 < n; j0 += nb) {
+        int64_t jb = min( nb, n - j0 );
+        for (int64_t i0 = 0; i0 < m; i0 += nb) {
+            int64_t ib = min( nb, m - i0 );
+            for (int64_t l0 = 0; l0 < k; l0 += nb) {
+                int64_t lb = min( nb, k - l0 );
+                scalar_t const* Al = (transA == NoTrans ? &A[ i0 + l0*lda ]
+                                                        : &A[ l0 + i0*lda ]);
+                scalar_t const* Bl = (transB == NoTrans ? &B[ l0 + j0*ldb ]
+                                                        : &B[ j0 + l0*ldb ]);
+                gemm3m_split( transA, ib, lb, Al, lda, Ar, Ai );
+                gemm3m_split( transB, lb, jb, Bl, ldb, Br, Bi );
+
+                blas_int ib_ = to_blas_int( ib );
+                blas_int jb_ = to_blas_int( jb );
+                blas_int lb_ = to_blas_int( lb );
+                real_t beta_ = (l0 == 0 ? zero : one);
+
+                // T1 += Ar Br;  T2 += Ai Bi
+                internal::gemm( 'n', 'n', ib_, jb_, lb_,
+                                one, Ar, ib_, Br, lb_, beta_, T1, ib_ );
+                internal::gemm( 'n', 'n', ib_, jb_, lb_,
+                                one, Ai, ib_, Bi, lb_, beta_, T2, ib_ );
+
+                // T3 += (Ar + Ai) (Br + Bi), summing in place
+                #pragma omp simd
+                for (int64_t i = 0; i < ib*lb; ++i)
+                    Ar[ i ] += Ai[ i ];
+                #pragma omp simd
+                for (int64_t i = 0; i < lb*jb; ++i)
+                    Br[ i ] += Bi[ i ];
+                internal::gemm( 'n', 'n', ib_, jb_, lb_,
+                                one, Ar, ib_, Br, lb_, beta_, T3, ib_ );
+            }
+
+            // C = alpha ((T1 - T2) + i (T3 - T1 - T2)) + beta C
+            for (int64_t j = 0; j < jb; ++j) {
+                scalar_t* Cj = &C[ i0 + (j0 + j)*ldc ];
+                for (int64_t i = 0; i < ib; ++i) {
+                    real_t t1 = T1[ i + j*ib ];
+                    real_t t2 = T2[ i + j*ib ];
+                    real_t t3 = T3[ i + j*ib ];
+                    scalar_t ab = alpha * scalar_t( t1 - t2, t3 - t1 - t2 );
+                    Cj[ i ] = (beta == scalar_t( zero ) ? ab
+                                                        : ab + beta*Cj[ i ]);
+                }
+            }
+        }
+    }
+}
+
+#endif  // BLAS_HAVE_GEMM3M
+
+//------------------------------------------------------------------------------
+/// @return number of levels of Strassen-Winograd recursion for an
+/// m-by-n-by-k gemm: recurse while all of m, n, k are >= cutoff.
+/// Returns 0 if cutoff <= 0, i.e., Strassen is disabled.
+/// @ingroup gemm_internal
+inline int strassen_levels( int64_t m, int64_t n, int64_t k, int64_t cutoff )
+{
+    int levels = 0;
+    if (cutoff > 0) {
+        while (min( m, min( n, k ) ) >= max( cutoff, int64_t( 2 ) )) {
+            m /= 2;
+            n /= 2;
+            k /= 2;
+            ++levels;
+        }
+    }
+    return levels;
+}
+
+//------------------------------------------------------------------------------
+/// @return workspace length for the given levels of Strassen-Winograd:
+/// each level needs half-size copies of op(A), op(B), and C.
+/// @ingroup gemm_internal
+inline int64_t strassen_workspace( int64_t m, int64_t n, int64_t k, int levels )
+{
+    int64_t lwork = 0;
+    for (int level = 0; level < levels; ++level) {
+        m /= 2;
+        n /= 2;
+        k /= 2;
+        lwork += m*k + k*n + m*n;
+    }
+    return lwork;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the m-by-n matrix Y = a op(X) + b Y, where X is stored
+/// with leading dimension ldx, and Y with leading dimension ldy.
+/// If b is zero, Y need not be set on input.
+/// Used for the additions in Strassen-Winograd.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void strassen_add(
+    blas::Op trans,
+    int64_t m, int64_t n,
+    scalar_t a, scalar_t const* X, int64_t ldx,
+    scalar_t b, scalar_t*       Y, int64_t ldy )
+{
+    const scalar_t zero = 0;
+
+    if (trans == Op::NoTrans) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t const* Xj = &X[ j*ldx ];
+            scalar_t*       Yj = &Y[ j*ldy ];
+            if (b == zero) {
+                #pragma omp simd
+                for (int64_t i = 0; i < m; ++i)
+                    Yj[ i ] = a*Xj[ i ];
+            }
+            else {
+                #pragma omp simd
+                for (int64_t i = 0; i < m; ++i)
+                    Yj[ i ] = a*Xj[ i ] + b*Yj[ i ];
+            }
+        }
+    }
+    else {
+        // transpose in nb-by-nb tiles, so both X and Y stay in cache
+        const int64_t nb = 32;
+        bool doconj = (trans == Op::ConjTrans);
+        for (int64_t j0 = 0; j0 < n; j0 += nb) {
+            int64_t j1 = min( j0 + nb, n );
+            for (int64_t i0 = 0; i0 < m; i0 += nb) {
+                int64_t i1 = min( i0 + nb, m );
+                for (int64_t j = j0; j < j1; ++j) {
+                    for (int64_t i = i0; i < i1; ++i) {
+                        scalar_t x = X[ j + i*ldx ];
+                        if (doconj)
+                            x = conj( x );
+                        Y[ i + j*ldy ] = (b == zero ? a*x
+                                                    : a*x + b*Y[ i + j*ldy ]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Calls the vendor gemm at the leaves of Strassen-Winograd.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void strassen_leaf(
+    blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc )
+{
+    if (m == 0 || n == 0)
+        return;
+    internal::gemm( to_char( transA ), to_char( transB ),
+                    to_blas_int( m ), to_blas_int( n ), to_blas_int( k ),
+                    alpha, A, to_blas_int( lda ), B, to_blas_int( ldb ),
+                    beta, C, to_blas_int( ldc ) );
+}
+
+//------------------------------------------------------------------------------
+/// Strassen-Winograd gemm: C = alpha op(A) op(B) + beta C,
+/// for column-major matrices, with the given levels of recursion.
+///
+/// Each level splits op(A), op(B), and C into 2-by-2 blocks and computes
+/// the 7 products of Winograd's variant [Boyer, Dumas, Pernet, Zhou, 2009],
+///     S1 = A21 + A22,  T1 = B12 - B11,  M1 = A11 B11,  M5 = S1 T1,
+///     S2 = S1 - A11,   T2 = B22 - T1,   M2 = A12 B21,  M6 = S2 T2,
+///     S3 = A11 - A21,  T3 = B22 - B12,  M3 = S4 B22,   M7 = S3 T3,
+///     S4 = A12 - S2,   T4 = T2 - B21,   M4 = A22 T4,
+/// accumulating them into C as
+///     C11 += M1 + M2,
+///     C12 += M1 + M5 + M6 + M3,
+///     C21 += M1 + M6 + M7 - M4,
+///     C22 += M1 + M5 + M6 + M7.
+/// S and T are formed in temporaries X and Y, and products that aren't
+/// accumulated directly into C are formed in Z. For odd dimensions, the
+/// last row, column, or rank-1 update is done by the vendor gemm.
+///
+/// @param[in] levels
+///     Levels of recursion; 0 calls the vendor gemm.
+///
+/// @param[in] work
+///     Workspace of length strassen_workspace( m, n, k, levels ).
+///
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void gemm_strassen(
+    blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc,
+    int levels, scalar_t* work )
+{
+    if (levels == 0) {
+        strassen_leaf( transA, transB, m, n, k,
+                       alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    const Op NoTrans = Op::NoTrans;
+
+    // C = beta C; then products accumulate into C
+    if (beta != one) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                C[ i + j*ldc ] = (beta == zero ? zero : beta * C[ i + j*ldc ]);
+    }
+
+    int64_t m2 = m / 2;
+    int64_t n2 = n / 2;
+    int64_t k2 = k / 2;
+    scalar_t* X = work;          // m2-by-k2
+    scalar_t* Y = X + m2*k2;     // k2-by-n2
+    scalar_t* Z = Y + k2*n2;     // m2-by-n2
+    scalar_t* work_next = Z + m2*n2;
+
+    // blocks of op(A), op(B), and C
+    auto A_ = [&]( int i, int j ) {
+        return (transA == NoTrans ? &A[ i*m2 + j*k2*lda ]
+                                  : &A[ j*k2 + i*m2*lda ]);
+    };
+    auto B_ = [&]( int i, int j ) {
+        return (transB == NoTrans ? &B[ i*k2 + j*n2*ldb ]
+                                  : &B[ j*n2 + i*k2*ldb ]);
+    };
+    auto C_ = [&]( int i, int j ) {
+        return &C[ i*m2 + j*n2*ldc ];
+    };
+
+    // Cij += Z
+    auto add_Z = [&]( int i, int j ) {
+        strassen_add( NoTrans, m2, n2, one, Z, m2, one, C_( i, j ), ldc );
+    };
+
+    // M1 = A11 B11
+    gemm_strassen( transA, transB, m2, n2, k2,
+                   alpha, A_( 0, 0 ), lda, B_( 0, 0 ), ldb,
+                   zero, Z, m2, levels - 1, work_next );
+    add_Z( 0, 0 );
+    add_Z( 0, 1 );
+    add_Z( 1, 0 );
+    add_Z( 1, 1 );
+
+    // M2 = A12 B21, into C11
+    gemm_strassen( transA, transB, m2, n2, k2,
+                   alpha, A_( 0, 1 ), lda, B_( 1, 0 ), ldb,
+                   one, C_( 0, 0 ), ldc, levels - 1, work_next );
+
+    // M5 = S1 T1
+    strassen_add( transA, m2, k2,  one, A_( 1, 0 ), lda, zero, X, m2 );
+    strassen_add( transA, m2, k2,  one, A_( 1, 1 ), lda,  one, X, m2 );
+    strassen_add( transB, k2, n2,  one, B_( 0, 1 ), ldb, zero, Y, k2 );
+    strassen_add( transB, k2, n2, -one, B_( 0, 0 ), ldb,  one, Y, k2 );
+    gemm_strassen( NoTrans, NoTrans, m2, n2, k2,
+                   alpha, X, m2, Y, k2,
+                   zero, Z, m2, levels - 1, work_next );
+    add_Z( 0, 1 );
+    add_Z( 1, 1 );
+
+    // M6 = S2 T2
+    strassen_add( transA, m2, k2, -one, A_( 0, 0 ), lda,  one, X, m2 );
+    strassen_add( transB, k2, n2,  one, B_( 1, 1 ), ldb, -one, Y, k2 );
+    gemm_strassen( NoTrans, NoTrans, m2, n2, k2,
+                   alpha, X, m2, Y, k2,
+                   zero, Z, m2, levels - 1, work_next );
+    add_Z( 0, 1 );
+    add_Z( 1, 0 );
+    add_Z( 1, 1 );
+
+    // M3 = S4 B22, into C12
+    strassen_add( transA, m2, k2,  one, A_( 0, 1 ), lda, -one, X, m2 );
+    gemm_strassen( NoTrans, transB, m2, n2, k2,
+                   alpha, X, m2, B_( 1, 1 ), ldb,
+                   one, C_( 0, 1 ), ldc, levels - 1, work_next );
+
+    // M4 = A22 T4, subtracted from C21
+    strassen_add( transB, k2, n2, -one, B_( 1, 0 ), ldb,  one, Y, k2 );
+    gemm_strassen( transA, NoTrans, m2, n2, k2,
+                   -alpha, A_( 1, 1 ), lda, Y, k2,
+                   one, C_( 1, 0 ), ldc, levels - 1, work_next );
+
+    // M7 = S3 T3
+    strassen_add( transA, m2, k2,  one, A_( 0, 0 ), lda, zero, X, m2 );
+    strassen_add( transA, m2, k2, -one, A_( 1, 0 ), lda,  one, X, m2 );
+    strassen_add( transB, k2, n2,  one, B_( 1, 1 ), ldb, zero, Y, k2 );
+    strassen_add( transB, k2, n2, -one, B_( 0, 1 ), ldb,  one, Y, k2 );
+    gemm_strassen( NoTrans, NoTrans, m2, n2, k2,
+                   alpha, X, m2, Y, k2,
+                   zero, Z, m2, levels - 1, work_next );
+    add_Z( 1, 0 );
+    add_Z( 1, 1 );
+
+    // odd k: rank-1 update of the even part of C with the last
+    // column of op(A) and last row of op(B)
+    if (k > 2*k2) {
+        scalar_t const* Ak = (transA == NoTrans ? &A[ (k-1)*lda ] : &A[ k-1 ]);
+        scalar_t const* Bk = (transB == NoTrans ? &B[ k-1 ] : &B[ (k-1)*ldb ]);
+        strassen_leaf( transA, transB, 2*m2, 2*n2, 1,
+                       alpha, Ak, lda, Bk, ldb, one, C, ldc );
+    }
+    // odd m: last row of C
+    if (m > 2*m2) {
+        scalar_t const* Am = (transA == NoTrans ? &A[ m-1 ] : &A[ (m-1)*lda ]);
+        strassen_leaf( transA, transB, 1, n, k,
+                       alpha, Am, lda, B, ldb, one, &C[ m-1 ], ldc );
+    }
+    // odd n: last column of C, except its last row if m is odd
+    if (n > 2*n2) {
+        scalar_t const* Bn = (transB == NoTrans ? &B[ (n-1)*ldb ] : &B[ n-1 ]);
+        strassen_leaf( transA, transB, 2*m2, 1, k,
+                       alpha, A, lda, Bn, ldb, one, &C[ (n-1)*ldc ], ldc );
+    }
 }
 
 }  // namespace internal
@@ -150,6 +672,34 @@ void gemm(
         blas_error_if( ldc < n );
     }
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (m > nb || n > nb || k > nb) {
+        const scalar_t one = 1;
+        for (int64_t i = 0; i < m; i += nb) {
+            int64_t ib = min( nb, m - i );
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                // C accumulates after its first block of k;
+                // if k = 0, one call still scales C by beta
+                for (int64_t l = 0; l < max( k, int64_t( 1 ) ); l += nb) {
+                    int64_t lb = min( nb, k - l );
+                    scalar_t const* Ail = (transA == Op::NoTrans
+                        ? internal::matrix_block( layout, A, lda, i, l )
+                        : internal::matrix_block( layout, A, lda, l, i ));
+                    scalar_t const* Blj = (transB == Op::NoTrans
+                        ? internal::matrix_block( layout, B, ldb, l, j )
+                        : internal::matrix_block( layout, B, ldb, j, l ));
+                    gemm( layout, transA, transB, ib, jb, lb,
+                          alpha, Ail, lda, Blj, ldb,
+                          (l == 0 ? beta : one),
+                          internal::matrix_block( layout, C, ldc, i, j ), ldc );
+                }
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::gemm_type element;
@@ -161,6 +711,31 @@ void gemm(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    // Reproducible mode uses the generic template's blocked engine, which
+    // sums each C_ij in the same order for any partition of C into tiles.
+    // Scaling C by beta alone is elementwise, so the vendor does it.
+    if (get_reproducible() && k > 0 && alpha != scalar_t( 0 )) {
+        // explicit template arguments avoid recursing into this wrapper
+        blas::gemm< scalar_t, scalar_t, scalar_t >(
+            layout, transA, transB, m, n, k,
+            alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+
+    // tiny problems: inline kernel avoids the Fortran call overhead
+    if (internal::use_small_gemm( m, n, k )) {
+        if (layout == Layout::RowMajor) {
+            // swap transA <=> transB, m <=> n, B <=> A
+            internal::small_gemm_simd( transB, transA, n, m, k,
+                                       alpha, B, ldb, A, lda, beta, C, ldc );
+        }
+        else {
+            internal::small_gemm_simd( transA, transB, m, n, k,
+                                       alpha, A, lda, B, ldb, beta, C, ldc );
+        }
+        return;
+    }
+
     // convert arguments
     blas_int m_   = to_blas_int( m );
     blas_int n_   = to_blas_int( n );
@@ -171,6 +746,58 @@ void gemm(
     char transA_  = to_char( transA );
     char transB_  = to_char( transB );
 
+    // 3M, if enabled, for complex types; takes precedence over Strassen
+    if constexpr (is_complex< scalar_t >::value) {
+        int64_t cutoff = get_gemm3m_cutoff();
+        if (cutoff > 0 && min( m, min( n, k ) ) >= cutoff
+            && alpha != scalar_t( 0 )) {
+            #ifdef BLAS_HAVE_GEMM3M
+                if (layout == Layout::RowMajor) {
+                    // swap transA <=> transB, m <=> n, B <=> A
+                    internal::gemm3m( transB_, transA_, n_, m_, k_,
+                                      alpha, B, ldb_, A, lda_, beta, C, ldc_ );
+                }
+                else {
+                    internal::gemm3m( transA_, transB_, m_, n_, k_,
+                                      alpha, A, lda_, B, ldb_, beta, C, ldc_ );
+                }
+            #else
+                if (layout == Layout::RowMajor) {
+                    // swap transA <=> transB, m <=> n, B <=> A
+                    internal::gemm_3m( transB, transA, n, m, k,
+                                       alpha, B, ldb, A, lda, beta, C, ldc );
+                }
+                else {
+                    internal::gemm_3m( transA, transB, m, n, k,
+                                       alpha, A, lda, B, ldb, beta, C, ldc );
+                }
+            #endif
+            return;
+        }
+    }
+
+    // Strassen-Winograd, if enabled, for double and complex<double>
+    if constexpr (std::is_same< scalar_t, double >::value
+                  || std::is_same< scalar_t, std::complex<double> >::value) {
+        int levels = internal::strassen_levels( m, n, k, get_strassen_cutoff() );
+        if (levels > 0 && alpha != scalar_t( 0 )) {
+            std::vector<scalar_t> work(
+                internal::strassen_workspace( m, n, k, levels ) );
+            if (layout == Layout::RowMajor) {
+                // swap transA <=> transB, m <=> n, B <=> A
+                internal::gemm_strassen( transB, transA, n, m, k,
+                                         alpha, B, ldb, A, lda, beta, C, ldc,
+                                         levels, work.data() );
+            }
+            else {
+                internal::gemm_strassen( transA, transB, m, n, k,
+                                         alpha, A, lda, B, ldb, beta, C, ldc,
+                                         levels, work.data() );
+            }
+            return;
+        }
+    }
+
     // call low-level wrapper
     if (layout == Layout::RowMajor) {
         // swap transA <=> transB, m <=> n, B <=> A
@@ -0,0 +1,626 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "simd.hh"
+
+#include <cstring>
+#include <vector>
+
+// AVX-512 VNNI micro-kernel, compiled with a target attribute and
+// selected at runtime, so the library needn't be built with -march.
+#if (defined(__x86_64__) || defined(_M_X64)) \
+    && (defined(__GNUC__) || defined(__clang__))
+    #define BLAS_GEMM_INT8_VNNI
+    #include <immintrin.h>
+#endif
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Block sizes for the int8 gemm engine, as in gemm_blocking.
+// The mr-by-nr = 32-by-8 register tile is 16 AVX-512 registers of int32 sums.
+// Packed panels hold groups of 4 consecutive k, so kc is a multiple of 4.
+// The mc-by-kc panel of op(A) is 256 KiB; the kc-by-nc panel of op(B) is 2 MiB.
+const int64_t gemm_int8_mr = 32;
+const int64_t gemm_int8_nr = 8;
+const int64_t gemm_int8_mc = 256;
+const int64_t gemm_int8_kc = 1024;
+const int64_t gemm_int8_nc = 2048;
+
+//------------------------------------------------------------------------------
+/// Packs the mc-by-kc block of op(A) into Ap, as ceil( mc / mr )
+/// micro-panels. Within a micro-panel, each group of 4 columns is stored
+/// as mr rows of 4 consecutive bytes,
+/// Ap[ (p/4)*4*mr + 4*i + p%4 ] = op(A)( i, p ) + 128,
+/// i.e., offset to unsigned, as the VNNI instruction multiplies
+/// unsigned by signed bytes. The offset is removed in gemm_int8_store_tile
+/// using column sums of op(B). Padding rows and columns are 0 + 128.
+/// @ingroup gemm_internal
+static void gemm_int8_pack_a(
+    blas::Op transA,
+    int64_t mc, int64_t kc,
+    int8_t const* A, int64_t lda,
+    uint8_t* Ap )
+{
+    const int64_t mr = gemm_int8_mr;
+
+    for (int64_t i0 = 0; i0 < mc; i0 += mr) {
+        int64_t ib = min( mr, mc - i0 );
+        for (int64_t p0 = 0; p0 < kc; p0 += 4) {
+            int64_t pb = min( int64_t( 4 ), kc - p0 );
+            if (transA == Op::NoTrans) {
+                for (int64_t q = 0; q < pb; ++q) {
+                    int8_t const* A_col = &A[ i0 + (p0 + q)*lda ];
+                    for (int64_t i = 0; i < ib; ++i)
+                        Ap[ 4*i + q ] = uint8_t( A_col[ i ] ) ^ 0x80;
+                }
+            }
+            else {
+                for (int64_t i = 0; i < ib; ++i) {
+                    int8_t const* A_row = &A[ p0 + (i0 + i)*lda ];
+                    for (int64_t q = 0; q < pb; ++q)
+                        Ap[ 4*i + q ] = uint8_t( A_row[ q ] ) ^ 0x80;
+                }
+            }
+            for (int64_t q = pb; q < 4; ++q)
+                for (int64_t i = 0; i < ib; ++i)
+                    Ap[ 4*i + q ] = 0x80;
+            for (int64_t i = ib; i < mr; ++i)
+                for (int64_t q = 0; q < 4; ++q)
+                    Ap[ 4*i + q ] = 0x80;
+            Ap += 4*mr;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Packs the kc-by-nc block of op(B) into Bp, as ceil( nc / nr )
+/// micro-panels. Within a micro-panel, each group of 4 rows is stored
+/// as nr columns of 4 consecutive bytes,
+/// Bp[ (p/4)*4*nr + 4*j + p%4 ] = op(B)( p, j ).
+/// Padding rows and columns are 0.
+/// Also computes the column sums, sums[ j ] = sum_p op(B)( p, j ),
+/// modulo 2^32 as in gemm_int8_store_tile.
+/// @ingroup gemm_internal
+static void gemm_int8_pack_b(
+    blas::Op transB,
+    int64_t kc, int64_t nc,
+    int8_t const* B, int64_t ldb,
+    int8_t* Bp, uint32_t* sums )
+{
+    const int64_t nr = gemm_int8_nr;
+
+    for (int64_t j0 = 0; j0 < nc; j0 += nr) {
+        int64_t jb = min( nr, nc - j0 );
+        for (int64_t p0 = 0; p0 < kc; p0 += 4) {
+            int64_t pb = min( int64_t( 4 ), kc - p0 );
+            if (transB == Op::NoTrans) {
+                for (int64_t j = 0; j < jb; ++j) {
+                    int8_t const* B_col = &B[ p0 + (j0 + j)*ldb ];
+                    for (int64_t q = 0; q < pb; ++q)
+                        Bp[ 4*j + q ] = B_col[ q ];
+                }
+            }
+            else {
+                for (int64_t q = 0; q < pb; ++q) {
+                    int8_t const* B_row = &B[ j0 + (p0 + q)*ldb ];
+                    for (int64_t j = 0; j < jb; ++j)
+                        Bp[ 4*j + q ] = B_row[ j ];
+                }
+            }
+            for (int64_t j = 0; j < jb; ++j)
+                for (int64_t q = pb; q < 4; ++q)
+                    Bp[ 4*j + q ] = 0;
+            for (int64_t j = jb; j < nr; ++j)
+                for (int64_t q = 0; q < 4; ++q)
+                    Bp[ 4*j + q ] = 0;
+            Bp += 4*nr;
+        }
+    }
+
+    for (int64_t j = 0; j < nc; ++j) {
+        uint32_t sum = 0;
+        if (transB == Op::NoTrans) {
+            for (int64_t p = 0; p < kc; ++p)
+                sum += uint32_t( B[ p + j*ldb ] );
+        }
+        else {
+            for (int64_t p = 0; p < kc; ++p)
+                sum += uint32_t( B[ j + p*ldb ] );
+        }
+        sums[ j ] = sum;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Micro-kernel computes the mr-by-nr tile AB = Ap * Bp modulo 2^32,
+/// where Ap and Bp are micro-panels packed by gemm_int8_pack_a and
+/// gemm_int8_pack_b, with kc4 = kc rounded up to a multiple of 4.
+/// Portable version, vectorized by the compiler. It accumulates in
+/// uint32, since signed overflow is undefined, while the unsigned
+/// sums wrap as the VNNI instruction does.
+/// @ingroup gemm_internal
+static void gemm_int8_micro_kernel(
+    int64_t kc4,
+    uint8_t const* Ap,
+    int8_t const* Bp,
+    uint32_t* AB )
+{
+    const int64_t mr = gemm_int8_mr;
+    const int64_t nr = gemm_int8_nr;
+
+    uint32_t ab[ nr ][ mr ];
+    for (int64_t j = 0; j < nr; ++j)
+        for (int64_t i = 0; i < mr; ++i)
+            ab[ j ][ i ] = 0;
+
+    for (int64_t p = 0; p < kc4; p += 4) {
+        for (int64_t j = 0; j < nr; ++j) {
+            uint32_t b0 = uint32_t( Bp[ 4*j     ] );
+            uint32_t b1 = uint32_t( Bp[ 4*j + 1 ] );
+            uint32_t b2 = uint32_t( Bp[ 4*j + 2 ] );
+            uint32_t b3 = uint32_t( Bp[ 4*j + 3 ] );
+            #pragma omp simd
+            for (int64_t i = 0; i < mr; ++i) {
+                ab[ j ][ i ] += Ap[ 4*i     ]*b0 + Ap[ 4*i + 1 ]*b1
+                              + Ap[ 4*i + 2 ]*b2 + Ap[ 4*i + 3 ]*b3;
+            }
+        }
+        Ap += 4*mr;
+        Bp += 4*nr;
+    }
+
+    for (int64_t j = 0; j < nr; ++j)
+        for (int64_t i = 0; i < mr; ++i)
+            AB[ i + j*mr ] = ab[ j ][ i ];
+}
+
+#ifdef BLAS_GEMM_INT8_VNNI
+//------------------------------------------------------------------------------
+/// Micro-kernel as above, using AVX-512 VNNI vpdpbusd, which accumulates
+/// the dot product of 4 unsigned by 4 signed bytes into each int32 lane.
+/// Each group of 4 k is two 64-byte loads of Ap, times 8 broadcasts of Bp.
+/// @ingroup gemm_internal
+__attribute__((target( "avx512f,avx512bw,avx512vnni" )))
+static void gemm_int8_micro_kernel_vnni(
+    int64_t kc4,
+    uint8_t const* Ap,
+    int8_t const* Bp,
+    uint32_t* AB )
+{
+    const int64_t mr = gemm_int8_mr;
+    const int64_t nr = gemm_int8_nr;
+    static_assert( gemm_int8_mr == 32, "VNNI kernel assumes mr = 32" );
+
+    __m512i ab0[ nr ], ab1[ nr ];
+    for (int64_t j = 0; j < nr; ++j) {
+        ab0[ j ] = _mm512_setzero_si512();
+        ab1[ j ] = _mm512_setzero_si512();
+    }
+
+    for (int64_t p = 0; p < kc4; p += 4) {
+        __m512i a0 = _mm512_loadu_si512( Ap );
+        __m512i a1 = _mm512_loadu_si512( Ap + 64 );
+        for (int64_t j = 0; j < nr; ++j) {
+            int32_t b4;
+            std::memcpy( &b4, &Bp[ 4*j ], sizeof(b4) );
+            __m512i b = _mm512_set1_epi32( b4 );
+            ab0[ j ] = _mm512_dpbusd_epi32( ab0[ j ], a0, b );
+            ab1[ j ] = _mm512_dpbusd_epi32( ab1[ j ], a1, b );
+        }
+        Ap += 4*mr;
+        Bp += 4*nr;
+    }
+
+    for (int64_t j = 0; j < nr; ++j) {
+        _mm512_storeu_si512( &AB[ j*mr      ], ab0[ j ] );
+        _mm512_storeu_si512( &AB[ j*mr + 16 ], ab1[ j ] );
+    }
+}
+#endif  // BLAS_GEMM_INT8_VNNI
+
+//------------------------------------------------------------------------------
+typedef void (*gemm_int8_kernel_t)(
+    int64_t kc4, uint8_t const* Ap, int8_t const* Bp, uint32_t* AB );
+
+//------------------------------------------------------------------------------
+/// @return micro-kernel for the CPU this is running on.
+/// The VNNI kernel is used only if set_simd_isa allows AVX-512.
+/// @ingroup gemm_internal
+static gemm_int8_kernel_t gemm_int8_select_kernel()
+{
+    #ifdef BLAS_GEMM_INT8_VNNI
+        static const bool has_vnni
+            = __builtin_cpu_supports( "avx512f" )
+              && __builtin_cpu_supports( "avx512bw" )
+              && __builtin_cpu_supports( "avx512vnni" );
+        if (has_vnni && simd_isa() == SimdIsa::AVX512)
+            return gemm_int8_micro_kernel_vnni;
+    #endif
+    return gemm_int8_micro_kernel;
+}
+
+//------------------------------------------------------------------------------
+/// Updates the mb-by-nb tile C = alpha (AB - 128 sums^T) + beta C,
+/// removing the offset added to A by gemm_int8_pack_a.
+/// The update is computed modulo 2^32 in uint32 and converted to int32
+/// (two's complement) only at the store, so it is exact whenever the
+/// true result fits in int32, even if AB or the offset alone do not.
+/// If beta is zero, C is not read.
+/// @ingroup gemm_internal
+static void gemm_int8_store_tile(
+    int64_t mb, int64_t nb,
+    int32_t alpha,
+    uint32_t const* AB,
+    uint32_t const* sums,
+    int32_t beta,
+    int32_t* C, int64_t ldc )
+{
+    const int64_t mr = gemm_int8_mr;
+    const uint32_t alpha_u = uint32_t( alpha );
+    const uint32_t beta_u  = uint32_t( beta );
+
+    for (int64_t j = 0; j < nb; ++j) {
+        uint32_t offset = 128u * sums[ j ];
+        if (beta == 0) {
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = int32_t( alpha_u*(AB[ i + j*mr ] - offset) );
+        }
+        else if (beta == 1) {
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = int32_t( alpha_u*(AB[ i + j*mr ] - offset)
+                                          + uint32_t( C[ i + j*ldc ] ) );
+        }
+        else {
+            for (int64_t i = 0; i < mb; ++i)
+                C[ i + j*ldc ] = int32_t( alpha_u*(AB[ i + j*mr ] - offset)
+                                          + beta_u*uint32_t( C[ i + j*ldc ] ) );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Blocked int8 gemm engine: C = alpha op(A) op(B) + beta C,
+/// for column-major matrices, accumulating modulo 2^32.
+/// Blocking is as in gemm_blocked.
+///
+/// Arguments are assumed valid, with m, n, k > 0 and alpha nonzero.
+/// If beta is zero, C need not be set on input.
+/// @ingroup gemm_internal
+static void gemm_int8_blocked(
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    int8_t const* A, int64_t lda,
+    int8_t const* B, int64_t ldb,
+    int32_t beta,
+    int32_t*      C, int64_t ldc )
+{
+    const int64_t mr = gemm_int8_mr;
+    const int64_t nr = gemm_int8_nr;
+    const int64_t mc = gemm_int8_mc;
+    const int64_t kc = gemm_int8_kc;
+    const int64_t nc = gemm_int8_nc;
+
+    gemm_int8_kernel_t kernel = gemm_int8_select_kernel();
+
+    // workspace, sized for this problem if it is smaller than the blocks
+    int64_t kc_max = min( kc, ((k + 3) / 4) * 4 );
+    int64_t mc_max = min( mc, ((m + mr - 1) / mr) * mr );
+    int64_t nc_max = min( nc, ((n + nr - 1) / nr) * nr );
+    std::vector<uint8_t> Ap( mc_max * kc_max );
+    std::vector<int8_t>  Bp( kc_max * nc_max );
+    std::vector<uint32_t> sums( nc_max );
+    uint32_t AB[ mr*nr ];
+
+    for (int64_t jc = 0; jc < n; jc += nc) {
+        int64_t nb = min( nc, n - jc );
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            int64_t kb  = min( kc, k - pc );
+            int64_t kb4 = ((kb + 3) / 4) * 4;
+
+            // beta applies only to the first block of k
+            int32_t beta_pc = (pc == 0 ? beta : 1);
+
+            int8_t const* Bpc = (transB == Op::NoTrans
+                                 ? &B[ pc + jc*ldb ]
+                                 : &B[ jc + pc*ldb ]);
+            gemm_int8_pack_b( transB, kb, nb, Bpc, ldb, Bp.data(), sums.data() );
+
+            for (int64_t ic = 0; ic < m; ic += mc) {
+                int64_t mb = min( mc, m - ic );
+
+                int8_t const* Aic = (transA == Op::NoTrans
+                                     ? &A[ ic + pc*lda ]
+                                     : &A[ pc + ic*lda ]);
+                gemm_int8_pack_a( transA, mb, kb, Aic, lda, Ap.data() );
+
+                for (int64_t jr = 0; jr < nb; jr += nr) {
+                    int64_t nrb = min( nr, nb - jr );
+                    for (int64_t ir = 0; ir < mb; ir += mr) {
+                        int64_t mrb = min( mr, mb - ir );
+                        kernel( kb4, &Ap[ ir*kb4 ], &Bp[ jr*kb4 ], AB );
+                        gemm_int8_store_tile(
+                            mrb, nrb, alpha, AB, &sums[ jr ], beta_pc,
+                            &C[ (ic + ir) + (jc + jr)*ldc ], ldc );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Checks gemm arguments, as in impl::gemm.
+/// @ingroup gemm_internal
+static void gemm_int8_check(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int64_t lda, int64_t ldb, int64_t ldc )
+{
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if (layout == Layout::ColMajor) {
+        blas_error_if( lda < ((transA != Op::NoTrans) ? k : m) );
+        blas_error_if( ldb < ((transB != Op::NoTrans) ? n : k) );
+        blas_error_if( ldc < m );
+    }
+    else {
+        blas_error_if( lda < ((transA != Op::NoTrans) ? m : k) );
+        blas_error_if( ldb < ((transB != Op::NoTrans) ? k : n) );
+        blas_error_if( ldc < n );
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+/// CPU, int8 version: C = alpha op(A) op(B) + beta C, with int8 A and B
+/// and int32 C.
+/// Uses AVX-512 VNNI instructions if the CPU supports them, and
+/// OpenMP threads, see set_num_threads and set_parallel_threshold.
+///
+/// Since int8 is real, ConjTrans is the same as Trans.
+/// The result is computed in unsigned arithmetic modulo 2^32 and
+/// stored as two's complement int32, so it is exact for any k whenever
+/// the true result fits in int32; otherwise it is the true result
+/// modulo 2^32.
+/// Other arguments are as for the generic gemm.
+///
+/// @see gemm_quantized for float scales and zero points.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    int32_t alpha,
+    int8_t const* A, int64_t lda,
+    int8_t const* B, int64_t ldb,
+    int32_t beta,
+    int32_t*      C, int64_t ldc )
+{
+    internal::gemm_int8_check( layout, transA, transB, m, n, k, lda, ldb, ldc );
+
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        std::swap( transA, transB );
+        std::swap( m, n );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+    }
+
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    if (alpha == 0 || k == 0) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                C(i, j) = (beta == 0
+                           ? 0
+                           : int32_t( uint32_t( beta )*uint32_t( C(i, j) ) ));
+        return;
+    }
+
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    int64_t mt = 1, nt = 1;
+    if (nthreads > 1)
+        internal::parallel_grid( nthreads, m, n, &mt, &nt );
+
+    // 2-D partition of C into one tile per thread.
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                             if( nthreads > 1 )
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i0 = internal::parallel_part( m, mt, ij % mt     );
+        int64_t i1 = internal::parallel_part( m, mt, ij % mt + 1 );
+        int64_t j0 = internal::parallel_part( n, nt, ij / mt     );
+        int64_t j1 = internal::parallel_part( n, nt, ij / mt + 1 );
+        int8_t const* Ai = (transA == Op::NoTrans ? &A[ i0 ] : &A[ i0*lda ]);
+        int8_t const* Bj = (transB == Op::NoTrans ? &B[ j0*ldb ] : &B[ j0 ]);
+        internal::gemm_int8_blocked(
+            transA, transB, i1 - i0, j1 - j0, k,
+            alpha, Ai, lda, Bj, ldb, beta, &C(i0, j0), ldc );
+    }
+
+    #undef C
+}
+
+//==============================================================================
+/// Quantized matrix-matrix multiply:
+/// \[
+///     C = \alpha D_A (op(A) - z_A 1^T) (op(B) - 1 z_B^T) D_B + \beta C,
+/// \]
+/// where op(A) and op(B) are int8 matrices, $D_A$ = diag( scale_A ) and
+/// $z_A$ = zero_A are per-row scales and zero points of op(A),
+/// $D_B$ = diag( scale_B ) and $z_B$ = zero_B are per-column scales and
+/// zero points of op(B), and C is a float matrix.
+///
+/// The product op(A) op(B) is computed by the int8 gemm in chunks of
+/// at most 2^16 in k, each of which is exact in int32, and accumulated
+/// in int64; the zero points are applied using row sums of op(A) and
+/// column sums of op(B), then the result is scaled to float.
+/// Uses AVX-512 VNNI instructions if the CPU supports them, and
+/// OpenMP threads, see set_num_threads and set_parallel_threshold.
+///
+/// Other arguments are as for gemm.
+///
+/// @param[in] scale_A
+///     Array of length m: scale for each row of op(A).
+///     If null, the scales are 1.
+///
+/// @param[in] zero_A
+///     Array of length m: zero point for each row of op(A).
+///     If null, the zero points are 0.
+///
+/// @param[in] scale_B
+///     Array of length n: scale for each column of op(B).
+///     If null, the scales are 1.
+///
+/// @param[in] zero_B
+///     Array of length n: zero point for each column of op(B).
+///     If null, the zero points are 0.
+///
+/// @ingroup gemm
+void gemm_quantized(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    int8_t const* A, int64_t lda,
+    float const* scale_A, int32_t const* zero_A,
+    int8_t const* B, int64_t ldb,
+    float const* scale_B, int32_t const* zero_B,
+    float beta,
+    float*        C, int64_t ldc )
+{
+    internal::gemm_int8_check( layout, transA, transB, m, n, k, lda, ldb, ldc );
+
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A,
+        // including the scales and zero points
+        std::swap( transA, transB );
+        std::swap( m, n );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+        std::swap( scale_A, scale_B );
+        std::swap( zero_A, zero_B );
+    }
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define B(i_, j_) B[ (i_) + (j_)*ldb ]
+    #define C(i_, j_) C[ (i_) + (j_)*ldc ]
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    if (alpha == 0 || k == 0) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                C(i, j) = (beta == 0 ? 0 : beta*C(i, j));
+        return;
+    }
+
+    // row sums of op(A), needed for zero_B; column sums of op(B) for zero_A
+    std::vector<int64_t> sums_A, sums_B;
+    if (zero_B) {
+        sums_A.assign( m, 0 );
+        for (int64_t i = 0; i < m; ++i)
+            for (int64_t p = 0; p < k; ++p)
+                sums_A[ i ] += (transA == Op::NoTrans ? A(i, p) : A(p, i));
+    }
+    if (zero_A) {
+        sums_B.assign( n, 0 );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t p = 0; p < k; ++p)
+                sums_B[ j ] += (transB == Op::NoTrans ? B(p, j) : B(j, p));
+    }
+
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    int64_t mt = 1, nt = 1;
+    if (nthreads > 1)
+        internal::parallel_grid( nthreads, m, n, &mt, &nt );
+
+    // 2-D partition of C into one tile per thread.
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                             if( nthreads > 1 )
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i0 = internal::parallel_part( m, mt, ij % mt     );
+        int64_t i1 = internal::parallel_part( m, mt, ij % mt + 1 );
+        int64_t j0 = internal::parallel_part( n, nt, ij / mt     );
+        int64_t j1 = internal::parallel_part( n, nt, ij / mt + 1 );
+        int64_t mb = i1 - i0;
+
+        // Accumulate a block of columns in an int64 workspace W,
+        // then apply zero points and scales to get C.
+        // Each chunk of kq <= 2^16 in k has |sum| <= 2^30, so it is exact
+        // in the int32 workspace Wq.
+        int64_t nw = max( int64_t( 1 ), min( j1 - j0, int64_t( 1 << 18 ) / mb ) );
+        const int64_t kq = 1 << 16;
+        std::vector<int64_t> W( mb * nw );
+        std::vector<int32_t> Wq( mb * nw );
+        for (int64_t jw = j0; jw < j1; jw += nw) {
+            int64_t jb = min( nw, j1 - jw );
+            for (int64_t p = 0; p < k; p += kq) {
+                int64_t pb = min( kq, k - p );
+                int8_t const* Aip = (transA == Op::NoTrans
+                                     ? &A(i0, p) : &A(p, i0));
+                int8_t const* Bjp = (transB == Op::NoTrans
+                                     ? &B(p, jw) : &B(jw, p));
+                internal::gemm_int8_blocked(
+                    transA, transB, mb, jb, pb,
+                    1, Aip, lda, Bjp, ldb, 0, Wq.data(), mb );
+                for (int64_t ij = 0; ij < mb*jb; ++ij)
+                    W[ ij ] = (p == 0 ? 0 : W[ ij ]) + Wq[ ij ];
+            }
+
+            for (int64_t j = 0; j < jb; ++j) {
+                int64_t jj = jw + j;
+                float alpha_j = alpha * (scale_B ? scale_B[ jj ] : 1.0f);
+                for (int64_t i = 0; i < mb; ++i) {
+                    int64_t ii = i0 + i;
+                    int64_t ab = W[ i + j*mb ];
+                    if (zero_B)
+                        ab -= zero_B[ jj ] * sums_A[ ii ];
+                    if (zero_A)
+                        ab -= zero_A[ ii ] * sums_B[ jj ];
+                    if (zero_A && zero_B)
+                        ab += k * int64_t( zero_A[ ii ] ) * zero_B[ jj ];
+                    float s = alpha_j * (scale_A ? scale_A[ ii ] : 1.0f);
+                    C(ii, jj) = (beta == 0
+                                 ? s * float( ab )
+                                 : s * float( ab ) + beta * C(ii, jj));
+                }
+            }
+        }
+    }
+
+    #undef A
+    #undef B
+    #undef C
+}
+
+}  // namespace blas
@@ -0,0 +1,53 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/gemm_blocked.hh"
+#include "simd.hh"
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( gemm_micro_kernel, gemm_micro_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// Calls the micro-kernel variant for simd_isa(). In reproducible mode,
+/// calls the generic variant, as FMA and the order of operations in
+/// other variants could change the rounding from one CPU to another.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void gemm_micro_kernel_select(
+    int64_t kc,
+    scalar_t const* Ap,
+    scalar_t const* Bp,
+    scalar_t* AB )
+{
+    if (get_reproducible())
+        gemm_micro_kernel( kc, Ap, Bp, AB );
+    else
+        gemm_micro_kernel_dispatch( kc, Ap, Bp, AB );
+}
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup gemm_internal
+void gemm_micro_kernel_simd(
+    int64_t kc, float const* Ap, float const* Bp, float* AB )
+{
+    gemm_micro_kernel_select( kc, Ap, Bp, AB );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup gemm_internal
+void gemm_micro_kernel_simd(
+    int64_t kc, double const* Ap, double const* Bp, double* AB )
+{
+    gemm_micro_kernel_select( kc, Ap, Bp, AB );
+}
+
+}  // namespace internal
+}  // namespace blas
@@ -0,0 +1,788 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/fortran.h"
+#include "blas.hh"
+#include "blas_internal.hh"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+#ifdef BLAS_HAVE_MKL
+
+//------------------------------------------------------------------------------
+/// Low-level wrapper calls MKL ?gemm_pack_get_size.
+/// @return size in bytes of the packed identifier operand.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+size_t gemm_pack_get_size(
+    char identifier, blas_int m, blas_int n, blas_int k );
+
+/// float version.
+/// @ingroup gemm_internal
+template <>
+inline size_t gemm_pack_get_size< float >(
+    char identifier, blas_int m, blas_int n, blas_int k )
+{
+    return BLAS_sgemm_pack_get_size( &identifier, &m, &n, &k );
+}
+
+/// double version.
+/// @ingroup gemm_internal
+template <>
+inline size_t gemm_pack_get_size< double >(
+    char identifier, blas_int m, blas_int n, blas_int k )
+{
+    return BLAS_dgemm_pack_get_size( &identifier, &m, &n, &k );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls MKL sgemm_pack.
+/// @ingroup gemm_internal
+inline void gemm_pack(
+    char identifier, char trans,
+    blas_int m, blas_int n, blas_int k,
+    float alpha,
+    float const* X, blas_int ldx,
+    float*       Xp )
+{
+    BLAS_sgemm_pack( &identifier, &trans, &m, &n, &k,
+                     &alpha, X, &ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls MKL dgemm_pack.
+/// @ingroup gemm_internal
+inline void gemm_pack(
+    char identifier, char trans,
+    blas_int m, blas_int n, blas_int k,
+    double alpha,
+    double const* X, blas_int ldx,
+    double*       Xp )
+{
+    BLAS_dgemm_pack( &identifier, &trans, &m, &n, &k,
+                     &alpha, X, &ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls MKL sgemm_compute.
+/// transA or transB is 'P' for a packed operand.
+/// @ingroup gemm_internal
+inline void gemm_compute(
+    char transA, char transB,
+    blas_int m, blas_int n, blas_int k,
+    float const* A, blas_int lda,
+    float const* B, blas_int ldb,
+    float beta,
+    float*       C, blas_int ldc )
+{
+    BLAS_sgemm_compute( &transA, &transB, &m, &n, &k,
+                        A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls MKL dgemm_compute.
+/// transA or transB is 'P' for a packed operand.
+/// @ingroup gemm_internal
+inline void gemm_compute(
+    char transA, char transB,
+    blas_int m, blas_int n, blas_int k,
+    double const* A, blas_int lda,
+    double const* B, blas_int ldb,
+    double beta,
+    double*       C, blas_int ldc )
+{
+    BLAS_dgemm_compute( &transA, &transB, &m, &n, &k,
+                        A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+#endif  // BLAS_HAVE_MKL
+
+//------------------------------------------------------------------------------
+/// @return length of the BLAS++ packed format of gemm_pack_panels.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+size_t gemm_pack_size(
+    blas::Operand operand,
+    int64_t m, int64_t n, int64_t k )
+{
+    using blocking = gemm_blocking< scalar_t >;
+    if (operand == Operand::A)
+        return size_t( (m + blocking::mr - 1) / blocking::mr ) * blocking::mr * k;
+    else
+        return size_t( (n + blocking::nr - 1) / blocking::nr ) * blocking::nr * k;
+}
+
+//------------------------------------------------------------------------------
+/// Packs Xp = alpha op(X) in the BLAS++ packed format, which is the
+/// panel format of gemm_blocked: for each block of kc columns of op(A),
+/// the m-by-kb panel packed by gemm_pack_a; or for each block of kc rows
+/// of op(B), the kb-by-n panel packed by gemm_pack_b. The panel for the
+/// block starting at p begins at Xp[ mpad*p ] for A, or Xp[ npad*p ] for B,
+/// where mpad and npad are m and n rounded up to multiples of mr and nr.
+/// gemm_packed_tile then passes blocks of the panels to gemm_macro_kernel
+/// without repacking them.
+///
+/// For operand A, op(X) is m-by-k; for operand B, op(X) is k-by-n.
+/// Xp has length mpad*k or npad*k; see gemm_pack_size.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void gemm_pack_panels(
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* X, int64_t ldx,
+    scalar_t* Xp )
+{
+    using blocking = gemm_blocking< scalar_t >;
+    const int64_t kc = blocking::kc;
+
+    if (operand == Operand::A) {
+        int64_t mpad = ((m + blocking::mr - 1) / blocking::mr) * blocking::mr;
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            int64_t kb = min( kc, k - pc );
+            scalar_t const* Xpc = (trans == Op::NoTrans ? &X[ pc*ldx ] : &X[ pc ]);
+            gemm_pack_a( trans, m, kb, Xpc, ldx, &Xp[ mpad*pc ] );
+        }
+    }
+    else {
+        int64_t npad = ((n + blocking::nr - 1) / blocking::nr) * blocking::nr;
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            int64_t kb = min( kc, k - pc );
+            scalar_t const* Xpc = (trans == Op::NoTrans ? &X[ pc ] : &X[ pc*ldx ]);
+            gemm_pack_b( trans, kb, n, Xpc, ldx, &Xp[ npad*pc ] );
+        }
+    }
+
+    if (alpha != scalar_t( 1 )) {
+        size_t size = gemm_pack_size< scalar_t >( operand, m, n, k );
+        #pragma omp simd
+        for (size_t i = 0; i < size; ++i)
+            Xp[ i ] *= alpha;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Computes the tile C( i0 : i1, j0 : j1 ) of the m-by-n product
+/// C = op(A) op(B) + beta C, for column-major matrices, with the loops
+/// of gemm_blocked. If Ap is not null, it is op(A) in the format of
+/// gemm_pack_panels, and its blocks are passed to the macro-kernel
+/// directly; otherwise, blocks of op(A) are packed from A. Likewise for
+/// Bp and B. i0 must be a multiple of mr, and j0 a multiple of nr,
+/// so the tile starts at a micro-panel.
+/// @ingroup gemm_internal
+template <typename scalar_t>
+void gemm_packed_tile(
+    int64_t m, int64_t n, int64_t k,
+    int64_t i0, int64_t i1, int64_t j0, int64_t j1,
+    blas::Op transA, scalar_t const* Ap, scalar_t const* A, int64_t lda,
+    blas::Op transB, scalar_t const* Bp, scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t* C, int64_t ldc )
+{
+    using blocking = gemm_blocking< scalar_t >;
+    const int64_t mr = blocking::mr;
+    const int64_t nr = blocking::nr;
+    const int64_t mc = blocking::mc;
+    const int64_t kc = blocking::kc;
+    const int64_t nc = blocking::nc;
+    const scalar_t one = 1;
+
+    int64_t mpad = ((m + mr - 1) / mr) * mr;
+    int64_t npad = ((n + nr - 1) / nr) * nr;
+
+    // workspace for operands that aren't packed
+    int64_t kc_max = min( kc, k );
+    std::vector<scalar_t> Aw( Ap ? 0 : min( mc, mpad ) * kc_max );
+    std::vector<scalar_t> Bw( Bp ? 0 : min( nc, npad ) * kc_max );
+
+    for (int64_t jc = j0; jc < j1; jc += nc) {
+        int64_t nb = min( nc, j1 - jc );
+        for (int64_t pc = 0; pc < k; pc += kc) {
+            int64_t kb = min( kc, k - pc );
+
+            // beta applies only to the first block of k
+            scalar_t beta_pc = (pc == 0 ? beta : one);
+
+            // op(B)( pc : pc+kb, jc : jc+nb )
+            scalar_t const* Bpc;
+            if (Bp) {
+                Bpc = &Bp[ npad*pc + jc*kb ];
+            }
+            else {
+                scalar_t const* Bsrc = (transB == Op::NoTrans
+                                        ? &B[ pc + jc*ldb ]
+                                        : &B[ jc + pc*ldb ]);
+                gemm_pack_b( transB, kb, nb, Bsrc, ldb, Bw.data() );
+                Bpc = Bw.data();
+            }
+
+            for (int64_t ic = i0; ic < i1; ic += mc) {
+                int64_t mb = min( mc, i1 - ic );
+
+                // op(A)( ic : ic+mb, pc : pc+kb )
+                scalar_t const* Apc;
+                if (Ap) {
+                    Apc = &Ap[ mpad*pc + ic*kb ];
+                }
+                else {
+                    scalar_t const* Asrc = (transA == Op::NoTrans
+                                            ? &A[ ic + pc*lda ]
+                                            : &A[ pc + ic*lda ]);
+                    gemm_pack_a( transA, mb, kb, Asrc, lda, Aw.data() );
+                    Apc = Aw.data();
+                }
+
+                gemm_macro_kernel( mb, nb, kb, one, Apc, Bpc,
+                                   beta_pc, &C[ ic + jc*ldc ], ldc,
+                                   gemm_no_epilogue(), pc + kb == k );
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then packs alpha op(X) using the vendor or BLAS++ format.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* X, int64_t ldx,
+    PackedMatrix<scalar_t>& Xp )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( operand != Operand::A &&
+                   operand != Operand::B );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    // In RowMajor, C = op(A) op(B) is computed as the ColMajor
+    // C^T = op(B)^T op(A)^T, so A and B swap roles, as do m and n.
+    Operand operand_col = operand;
+    int64_t m_col = m;
+    int64_t n_col = n;
+    if (layout == Layout::RowMajor) {
+        operand_col = (operand == Operand::A ? Operand::B : Operand::A);
+        std::swap( m_col, n_col );
+    }
+
+    // op(X) is Xm-by-Xn in ColMajor
+    int64_t Xm = (operand_col == Operand::A ? m_col : k);
+    int64_t Xn = (operand_col == Operand::A ? k : n_col);
+    if (trans == Op::NoTrans)
+        blas_error_if( ldx < Xm );
+    else
+        blas_error_if( ldx < Xn );
+
+    #ifdef BLAS_HAVE_MKL
+        if constexpr (! is_complex< scalar_t >::value) {
+            // convert arguments
+            char id_      = char( operand_col );
+            char trans_   = to_char( trans );
+            blas_int m_   = to_blas_int( m_col );
+            blas_int n_   = to_blas_int( n_col );
+            blas_int k_   = to_blas_int( k );
+            blas_int ldx_ = to_blas_int( ldx );
+
+            size_t bytes = internal::gemm_pack_get_size< scalar_t >(
+                               id_, m_, n_, k_ );
+            Xp.reset( layout, operand, m, n, k, true,
+                      (bytes + sizeof(scalar_t) - 1) / sizeof(scalar_t) );
+            internal::gemm_pack( id_, trans_, m_, n_, k_,
+                                 alpha, X, ldx_, Xp.data() );
+            return;
+        }
+    #endif
+
+    Xp.reset( layout, operand, m, n, k, false,
+              internal::gemm_pack_size< scalar_t >( operand_col, m_col, n_col, k ) );
+    internal::gemm_pack_panels( operand_col, trans, m_col, n_col, k,
+                                alpha, X, ldx, Xp.data() );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then computes C = op(A) op(B) + beta C, where A or B or both are
+/// packed, with alpha included. Exactly one of Ap or A is non-null,
+/// and likewise for Bp and B.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<scalar_t> const* Ap,
+    scalar_t const* A, int64_t lda,
+    PackedMatrix<scalar_t> const* Bp,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if (Ap != nullptr) {
+        blas_error_if( Ap->empty() );
+        blas_error_if( Ap->operand() != Operand::A );
+        blas_error_if( Ap->layout() != layout );
+        blas_error_if( Ap->m() != m );
+        blas_error_if( Ap->k() != k );
+    }
+    else {
+        blas_error_if( transA != Op::NoTrans &&
+                       transA != Op::Trans &&
+                       transA != Op::ConjTrans );
+        if ((transA == Op::NoTrans) == (layout == Layout::ColMajor))
+            blas_error_if( lda < m );
+        else
+            blas_error_if( lda < k );
+    }
+
+    if (Bp != nullptr) {
+        blas_error_if( Bp->empty() );
+        blas_error_if( Bp->operand() != Operand::B );
+        blas_error_if( Bp->layout() != layout );
+        blas_error_if( Bp->n() != n );
+        blas_error_if( Bp->k() != k );
+    }
+    else {
+        blas_error_if( transB != Op::NoTrans &&
+                       transB != Op::Trans &&
+                       transB != Op::ConjTrans );
+        if ((transB == Op::NoTrans) == (layout == Layout::ColMajor))
+            blas_error_if( ldb < k );
+        else
+            blas_error_if( ldb < n );
+    }
+
+    if (layout == Layout::ColMajor)
+        blas_error_if( ldc < m );
+    else
+        blas_error_if( ldc < n );
+
+    if (layout == Layout::RowMajor) {
+        // swap transA <=> transB, m <=> n, B <=> A
+        std::swap( transA, transB );
+        std::swap( m, n );
+        std::swap( Ap, Bp );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+    }
+
+    #ifdef BLAS_HAVE_MKL
+        if constexpr (! is_complex< scalar_t >::value) {
+            // convert arguments
+            char transA_  = (Ap != nullptr ? 'P' : to_char( transA ));
+            char transB_  = (Bp != nullptr ? 'P' : to_char( transB ));
+            blas_int m_   = to_blas_int( m );
+            blas_int n_   = to_blas_int( n );
+            blas_int k_   = to_blas_int( k );
+            blas_int lda_ = to_blas_int( Ap != nullptr ? max( int64_t( 1 ), m ) : lda );
+            blas_int ldb_ = to_blas_int( Bp != nullptr ? max( int64_t( 1 ), k ) : ldb );
+            blas_int ldc_ = to_blas_int( ldc );
+            internal::gemm_compute( transA_, transB_, m_, n_, k_,
+                                    (Ap != nullptr ? Ap->data() : A), lda_,
+                                    (Bp != nullptr ? Bp->data() : B), ldb_,
+                                    beta, C, ldc_ );
+            return;
+        }
+    #endif
+
+    // BLAS++ format: panels of alpha op(X), multiplied without repacking.
+    using blocking = internal::gemm_blocking< scalar_t >;
+    const scalar_t zero = 0;
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                C[ i + j*ldc ] = (beta == zero ? zero : beta*C[ i + j*ldc ]);
+        }
+        return;
+    }
+
+    scalar_t const* Ap_data = (Ap != nullptr ? Ap->data() : nullptr);
+    scalar_t const* Bp_data = (Bp != nullptr ? Bp->data() : nullptr);
+
+    // 2-D partition of C into one tile per thread, on micro-panel
+    // boundaries so each tile starts at a packed micro-panel.
+    int64_t mu = (m + blocking::mr - 1) / blocking::mr;
+    int64_t nu = (n + blocking::nr - 1) / blocking::nr;
+    int nthreads = internal::parallel_num_threads( m*n*k );
+    int64_t mt = 1, nt = 1;
+    if (nthreads > 1)
+        internal::parallel_grid( nthreads, mu, nu, &mt, &nt );
+
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                             if( nthreads > 1 )
+    for (int64_t ij = 0; ij < mt*nt; ++ij) {
+        int64_t i0 = internal::parallel_part( mu, mt, ij % mt     ) * blocking::mr;
+        int64_t i1 = internal::parallel_part( mu, mt, ij % mt + 1 ) * blocking::mr;
+        int64_t j0 = internal::parallel_part( nu, nt, ij / mt     ) * blocking::nr;
+        int64_t j1 = internal::parallel_part( nu, nt, ij / mt + 1 ) * blocking::nr;
+        internal::gemm_packed_tile(
+            m, n, k, i0, min( i1, m ), j0, min( j1, n ),
+            transA, Ap_data, A, lda,
+            transB, Bp_data, B, ldb,
+            beta, C, ldc );
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// Packs the operand alpha op(A) or alpha op(B) of an m-by-n-by-k gemm,
+/// for reuse in many gemm calls that take a PackedMatrix.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] operand
+///     Which operand X is:
+///     - Operand::A: $op(X)$ is the m-by-k matrix op(A); n is not used.
+///     - Operand::B: $op(X)$ is the k-by-n matrix op(B); m is not used.
+///
+/// @param[in] trans
+///     The operation $op(X)$: Op::NoTrans, Op::Trans, or Op::ConjTrans.
+///
+/// @param[in] m
+///     Number of rows of C and $op(A)$. m >= 0.
+///
+/// @param[in] n
+///     Number of columns of C and $op(B)$. n >= 0.
+///
+/// @param[in] k
+///     Number of columns of $op(A)$ and rows of $op(B)$. k >= 0.
+///
+/// @param[in] alpha
+///     Scalar alpha, applied while packing. If both A and B are packed,
+///     gemm computes the product of their alphas.
+///
+/// @param[in] X
+///     The matrix A or B, stored as for gemm.
+///
+/// @param[in] ldx
+///     Leading dimension of X, as lda or ldb for gemm.
+///
+/// @param[out] Xp
+///     The packed operand.
+///
+/// @ingroup gemm
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    float const* X, int64_t ldx,
+    PackedMatrix<float>& Xp )
+{
+    impl::gemm_pack( layout, operand, trans, m, n, k, alpha, X, ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemm
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    double alpha,
+    double const* X, int64_t ldx,
+    PackedMatrix<double>& Xp )
+{
+    impl::gemm_pack( layout, operand, trans, m, n, k, alpha, X, ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemm
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* X, int64_t ldx,
+    PackedMatrix< std::complex<float> >& Xp )
+{
+    impl::gemm_pack( layout, operand, trans, m, n, k, alpha, X, ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemm
+void gemm_pack(
+    blas::Layout layout,
+    blas::Operand operand,
+    blas::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* X, int64_t ldx,
+    PackedMatrix< std::complex<double> >& Xp )
+{
+    impl::gemm_pack( layout, operand, trans, m, n, k, alpha, X, ldx, Xp );
+}
+
+//------------------------------------------------------------------------------
+/// General matrix-matrix multiply with packed A:
+/// \[
+///     C = A_p op(B) + \beta C,
+/// \]
+/// where $A_p = \alpha op(A)$ was packed by gemm_pack with the same
+/// layout, m, and k. Other arguments are as for gemm.
+///
+/// CPU, float version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<float> const& A,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc )
+{
+    impl::gemm< float >(
+        layout, Op::NoTrans, transB, m, n, k,
+        &A, nullptr, 0, nullptr, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<double> const& A,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc )
+{
+    impl::gemm< double >(
+        layout, Op::NoTrans, transB, m, n, k,
+        &A, nullptr, 0, nullptr, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<float> > const& A,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<float> >(
+        layout, Op::NoTrans, transB, m, n, k,
+        &A, nullptr, 0, nullptr, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<double> > const& A,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<double> >(
+        layout, Op::NoTrans, transB, m, n, k,
+        &A, nullptr, 0, nullptr, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// General matrix-matrix multiply with packed B:
+/// \[
+///     C = op(A) B_p + \beta C,
+/// \]
+/// where $B_p = \alpha op(B)$ was packed by gemm_pack with the same
+/// layout, n, and k. Other arguments are as for gemm.
+///
+/// CPU, float version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    PackedMatrix<float> const& B,
+    float beta,
+    float*       C, int64_t ldc )
+{
+    impl::gemm< float >(
+        layout, transA, Op::NoTrans, m, n, k,
+        nullptr, A, lda, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    PackedMatrix<double> const& B,
+    double beta,
+    double*       C, int64_t ldc )
+{
+    impl::gemm< double >(
+        layout, transA, Op::NoTrans, m, n, k,
+        nullptr, A, lda, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    PackedMatrix< std::complex<float> > const& B,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<float> >(
+        layout, transA, Op::NoTrans, m, n, k,
+        nullptr, A, lda, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    blas::Op transA,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    PackedMatrix< std::complex<double> > const& B,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<double> >(
+        layout, transA, Op::NoTrans, m, n, k,
+        nullptr, A, lda, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// General matrix-matrix multiply with packed A and B:
+/// \[
+///     C = A_p B_p + \beta C,
+/// \]
+/// where $A_p = \alpha_A op(A)$ and $B_p = \alpha_B op(B)$ were packed by
+/// gemm_pack with the same layout and dimensions. Other arguments are as
+/// for gemm.
+///
+/// CPU, float version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<float> const& A,
+    PackedMatrix<float> const& B,
+    float beta,
+    float*       C, int64_t ldc )
+{
+    impl::gemm< float >(
+        layout, Op::NoTrans, Op::NoTrans, m, n, k,
+        &A, nullptr, 0, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix<double> const& A,
+    PackedMatrix<double> const& B,
+    double beta,
+    double*       C, int64_t ldc )
+{
+    impl::gemm< double >(
+        layout, Op::NoTrans, Op::NoTrans, m, n, k,
+        &A, nullptr, 0, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<float> > const& A,
+    PackedMatrix< std::complex<float> > const& B,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<float> >(
+        layout, Op::NoTrans, Op::NoTrans, m, n, k,
+        &A, nullptr, 0, &B, nullptr, 0, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemm
+void gemm(
+    blas::Layout layout,
+    int64_t m, int64_t n, int64_t k,
+    PackedMatrix< std::complex<double> > const& A,
+    PackedMatrix< std::complex<double> > const& B,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc )
+{
+    impl::gemm< std::complex<double> >(
+        layout, Op::NoTrans, Op::NoTrans, m, n, k,
+        &A, nullptr, 0, &B, nullptr, 0, beta, C, ldc );
+}
+
+}  // namespace blas
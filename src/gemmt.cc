@@ -0,0 +1,350 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/fortran.h"
+#include "blas.hh"
+#include "blas_internal.hh"
+#include "blas/counter.hh"
+
+#include <limits>
+#include <string.h>
+#include <vector>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+#ifdef BLAS_HAVE_GEMMT
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup gemmt_internal
+inline void gemmt(
+    char uplo, char transA, char transB,
+    blas_int n, blas_int k,
+    float alpha,
+    float const* A, blas_int lda,
+    float const* B, blas_int ldb,
+    float beta,
+    float*       C, blas_int ldc )
+{
+    BLAS_sgemmt( &uplo, &transA, &transB, &n, &k,
+                 &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup gemmt_internal
+inline void gemmt(
+    char uplo, char transA, char transB,
+    blas_int n, blas_int k,
+    double alpha,
+    double const* A, blas_int lda,
+    double const* B, blas_int ldb,
+    double beta,
+    double*       C, blas_int ldc )
+{
+    BLAS_dgemmt( &uplo, &transA, &transB, &n, &k,
+                 &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup gemmt_internal
+inline void gemmt(
+    char uplo, char transA, char transB,
+    blas_int n, blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, blas_int lda,
+    std::complex<float> const* B, blas_int ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, blas_int ldc )
+{
+    BLAS_cgemmt( &uplo, &transA, &transB, &n, &k,
+                 (blas_complex_float*) &alpha,
+                 (blas_complex_float*) A, &lda,
+                 (blas_complex_float*) B, &ldb,
+                 (blas_complex_float*) &beta,
+                 (blas_complex_float*) C, &ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup gemmt_internal
+inline void gemmt(
+    char uplo, char transA, char transB,
+    blas_int n, blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, blas_int lda,
+    std::complex<double> const* B, blas_int ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, blas_int ldc )
+{
+    BLAS_zgemmt( &uplo, &transA, &transB, &n, &k,
+                 (blas_complex_double*) &alpha,
+                 (blas_complex_double*) A, &lda,
+                 (blas_complex_double*) B, &ldb,
+                 (blas_complex_double*) &beta,
+                 (blas_complex_double*) C, &ldc );
+}
+
+#else
+
+//------------------------------------------------------------------------------
+/// Block size for the diagonal blocks of gemmt_recursive.
+/// Computing a full nb-by-nb diagonal block wastes about nb / n of the flops.
+/// @ingroup gemmt_internal
+constexpr int64_t gemmt_recursive_nb = 128;
+
+//------------------------------------------------------------------------------
+/// Triangle-only gemm for BLAS libraries without gemmt, column-major.
+/// Splits the n-by-n triangle of C into two triangles of size n/2 and
+/// an (n/2)-by-(n/2) off-diagonal block, which is one vendor gemm,
+/// recursively. For n <= nb, computes W = alpha op(A) op(B) with gemm
+/// in an nb-by-nb workspace, then updates the triangle of C from W.
+/// Large off-diagonal blocks keep the vendor gemm near its peak rate.
+///
+/// Arguments are as for gemmt, with layout ColMajor;
+/// W is an nb-by-nb workspace.
+/// @ingroup gemmt_internal
+template <typename scalar_t>
+void gemmt_recursive(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc,
+    scalar_t*       W )
+{
+    const scalar_t zero = 0;
+
+    if (n <= gemmt_recursive_nb) {
+        blas::gemm( Layout::ColMajor, transA, transB, n, n, k,
+                    alpha, A, lda, B, ldb, zero, W, n );
+        bool lower = (uplo == Uplo::Lower);
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t i0 = (lower ? j : 0);
+            int64_t i1 = (lower ? n : j + 1);
+            scalar_t* Cj = &C[ j*ldc ];
+            scalar_t* Wj = &W[ j*n ];
+            if (beta == zero) {
+                for (int64_t i = i0; i < i1; ++i)
+                    Cj[ i ] = Wj[ i ];
+            }
+            else {
+                for (int64_t i = i0; i < i1; ++i)
+                    Cj[ i ] = Wj[ i ] + beta * Cj[ i ];
+            }
+        }
+        return;
+    }
+
+    // [ C11     ]  or  [ C11 C12 ]
+    // [ C21 C22 ]      [     C22 ]
+    int64_t n1 = n / 2;
+    int64_t n2 = n - n1;
+    // op(A)( n1:n, : ) and op(B)( :, n1:n )
+    scalar_t const* A2 = (transA == Op::NoTrans ? &A[ n1 ] : &A[ n1*lda ]);
+    scalar_t const* B2 = (transB == Op::NoTrans ? &B[ n1*ldb ] : &B[ n1 ]);
+
+    gemmt_recursive( uplo, transA, transB, n1, k,
+                     alpha, A, lda, B, ldb, beta, C, ldc, W );
+    if (uplo == Uplo::Lower) {
+        // C21 = alpha op(A)( n1:n, : ) op(B)( :, 0:n1 ) + beta C21
+        blas::gemm( Layout::ColMajor, transA, transB, n2, n1, k,
+                    alpha, A2, lda, B, ldb, beta, &C[ n1 ], ldc );
+    }
+    else {
+        // C12 = alpha op(A)( 0:n1, : ) op(B)( :, n1:n ) + beta C12
+        blas::gemm( Layout::ColMajor, transA, transB, n1, n2, k,
+                    alpha, A, lda, B2, ldb, beta, &C[ n1*ldc ], ldc );
+    }
+    gemmt_recursive( uplo, transA, transB, n2, k,
+                     alpha, A2, lda, B2, ldb, beta, &C[ n1 + n1*ldc ], ldc, W );
+}
+
+#endif  // BLAS_HAVE_GEMMT
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then calls low-level wrapper.
+/// @ingroup gemmt_internal
+///
+template <typename scalar_t>
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    blas_error_if( transA != Op::NoTrans &&
+                   transA != Op::Trans &&
+                   transA != Op::ConjTrans );
+    blas_error_if( transB != Op::NoTrans &&
+                   transB != Op::Trans &&
+                   transB != Op::ConjTrans );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    if ((transA == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( lda < n );
+    else
+        blas_error_if( lda < k );
+
+    if ((transB == Op::NoTrans) ^ (layout == Layout::RowMajor))
+        blas_error_if( ldb < k );
+    else
+        blas_error_if( ldb < n );
+
+    blas_error_if( ldc < n );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::gemmt_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { uplo, transA, transB, n, k };
+        counter::insert( element, counter::Id::gemmt );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::gemmt( n, k );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    // quick return
+    if (n == 0)
+        return;
+
+    if (layout == Layout::RowMajor) {
+        // C^T = op(B)^T op(A)^T: swap lower <=> upper,
+        // transA <=> transB, B <=> A
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+        std::swap( transA, transB );
+        std::swap( A, B );
+        std::swap( lda, ldb );
+    }
+
+    #ifdef BLAS_HAVE_GEMMT
+        // convert arguments
+        blas_int n_   = to_blas_int( n );
+        blas_int k_   = to_blas_int( k );
+        blas_int lda_ = to_blas_int( lda );
+        blas_int ldb_ = to_blas_int( ldb );
+        blas_int ldc_ = to_blas_int( ldc );
+        char uplo_    = to_char( uplo );
+        char transA_  = to_char( transA );
+        char transB_  = to_char( transB );
+
+        // call low-level wrapper
+        internal::gemmt( uplo_, transA_, transB_, n_, k_,
+                         alpha, A, lda_, B, ldb_, beta, C, ldc_ );
+    #else
+        int64_t nb = min( n, internal::gemmt_recursive_nb );
+        std::vector<scalar_t> W( nb*nb );
+        internal::gemmt_recursive( uplo, transA, transB, n, k,
+                                   alpha, A, lda, B, ldb, beta, C, ldc,
+                                   W.data() );
+    #endif
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float beta,
+    float*       C, int64_t ldc )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double beta,
+    double*       C, int64_t ldc )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float> beta,
+    std::complex<float>*       C, int64_t ldc )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemmt
+void gemmt(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op transA,
+    blas::Op transB,
+    int64_t n, int64_t k,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double> beta,
+    std::complex<double>*       C, int64_t ldc )
+{
+    impl::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc );
+}
+
+}  // namespace blas
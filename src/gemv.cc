@@ -7,6 +7,10 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "reproducible.hh"
+#include "small.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -88,6 +92,157 @@ inline void gemv(
                 (blas_complex_double*) y, &incy );
 }
 
+#ifdef BLAS_USE_CBLAS
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// float version.
+/// @ingroup gemv_internal
+inline void gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    blas_int m, blas_int n,
+    float alpha,
+    float const* A, blas_int lda,
+    float const* x, blas_int incx,
+    float beta,
+    float*       y, blas_int incy )
+{
+    cblas_sgemv( cblas_layout( layout ), cblas_trans( trans ), m, n, alpha,
+                 A, lda, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// double version.
+/// @ingroup gemv_internal
+inline void gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    blas_int m, blas_int n,
+    double alpha,
+    double const* A, blas_int lda,
+    double const* x, blas_int incx,
+    double beta,
+    double*       y, blas_int incy )
+{
+    cblas_dgemv( cblas_layout( layout ), cblas_trans( trans ), m, n, alpha,
+                 A, lda, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float> version.
+/// @ingroup gemv_internal
+inline void gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    blas_int m, blas_int n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, blas_int lda,
+    std::complex<float> const* x, blas_int incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, blas_int incy )
+{
+    cblas_cgemv( cblas_layout( layout ), cblas_trans( trans ), m, n, &alpha,
+                 A, lda, x, incx, &beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double> version.
+/// @ingroup gemv_internal
+inline void gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    blas_int m, blas_int n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, blas_int lda,
+    std::complex<double> const* x, blas_int incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, blas_int incy )
+{
+    cblas_zgemv( cblas_layout( layout ), cblas_trans( trans ), m, n, &alpha,
+                 A, lda, x, incx, &beta, y, incy );
+}
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
+BLAS_SIMD_KERNEL( gemv_convert_kernel, gemv_convert_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// Calls the gemv_convert kernel variant for simd_isa().
+/// In reproducible mode, calls the generic variant, as FMA in other
+/// variants could change the rounding from one CPU to another.
+/// @ingroup gemv_internal
+template <typename TA, typename scalar_t>
+void gemv_convert_kernel_select(
+    blas::Op trans, bool doconj,
+    int64_t m, int64_t n,
+    TA const* A, int64_t lda,
+    scalar_t const* xw, scalar_t* yw )
+{
+    if (get_reproducible())
+        gemv_convert_kernel( trans, doconj, m, n, A, lda, xw, yw );
+    else
+        gemv_convert_kernel_dispatch( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+//------------------------------------------------------------------------------
+/// float16 A, float workspace version.
+/// @ingroup gemv_internal
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float16 const* A, int64_t lda,
+    float const* xw, float* yw )
+{
+    gemv_convert_kernel_select( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 A, float workspace version.
+/// @ingroup gemv_internal
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    bfloat16 const* A, int64_t lda,
+    float const* xw, float* yw )
+{
+    gemv_convert_kernel_select( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+//------------------------------------------------------------------------------
+/// float A, float workspace version.
+/// @ingroup gemv_internal
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* xw, float* yw )
+{
+    gemv_convert_kernel_select( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+//------------------------------------------------------------------------------
+/// float A, double workspace version.
+/// @ingroup gemv_internal
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    double const* xw, double* yw )
+{
+    gemv_convert_kernel_select( trans, doconj, m, n, A, lda, xw, yw );
+}
+
+//------------------------------------------------------------------------------
+/// double A, double workspace version.
+/// @ingroup gemv_internal
+void gemv_convert_kernel_simd(
+    blas::Op trans, bool doconj, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* xw, double* yw )
+{
+    gemv_convert_kernel_select( trans, doconj, m, n, A, lda, xw, yw );
+}
+
 }  // namespace internal
 
 //==============================================================================
@@ -128,6 +283,34 @@ void gemv(
     blas_error_if( incx == 0 );
     blas_error_if( incy == 0 );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (m > nb || n > nb) {
+        const scalar_t one = 1;
+        for (int64_t i = 0; i < m; i += nb) {
+            int64_t ib = min( nb, m - i );
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                // y accumulates after its first block of op(A) x
+                if (trans == Op::NoTrans) {
+                    gemv( layout, trans, ib, jb, alpha,
+                          internal::matrix_block( layout, A, lda, i, j ), lda,
+                          internal::vector_block( x, n, incx, j, jb ), incx,
+                          (j == 0 ? beta : one),
+                          internal::vector_block( y, m, incy, i, ib ), incy );
+                }
+                else {
+                    gemv( layout, trans, ib, jb, alpha,
+                          internal::matrix_block( layout, A, lda, i, j ), lda,
+                          internal::vector_block( x, m, incx, i, ib ), incx,
+                          (i == 0 ? beta : one),
+                          internal::vector_block( y, n, incy, j, jb ), incy );
+                }
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::gemv_type element;
@@ -139,6 +322,19 @@ void gemv(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    if (get_reproducible()) {
+        internal::reproducible_gemv( layout, trans, m, n,
+                                     alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
+    // tiny problems: inline kernel avoids the Fortran call overhead
+    if (internal::use_small_gemv( m, n )) {
+        internal::small_gemv_simd( layout, trans, m, n,
+                                   alpha, A, lda, x, incx, beta, y, incy );
+        return;
+    }
+
     // convert arguments
     blas_int m_    = to_blas_int( m );
     blas_int n_    = to_blas_int( n );
@@ -146,53 +342,59 @@ void gemv(
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
 
-    // Deal with layout. RowMajor ConjTrans needs copy of x in x2;
-    // in other cases, x2 == x.
-    scalar_t* x2 = const_cast< scalar_t* >( x );
-    Op trans2 = trans;
-    if (layout == Layout::RowMajor) {
-        if constexpr (is_complex_v<scalar_t>) {
-            if (trans == Op::ConjTrans) {
-                // conjugate alpha, beta, x (in x2), and y (in-place)
-                alpha = conj( alpha );
-                beta  = conj( beta );
-
-                x2 = new scalar_t[ m ];
-                int64_t ix = (incx > 0 ? 0 : (-m + 1)*incx);
-                for (int64_t i = 0; i < m; ++i) {
-                    x2[ i ] = conj( x[ ix ] );
-                    ix += incx;
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself, without conjugated copies
+        internal::gemv( layout, trans, m_, n_,
+                        alpha, A, lda_, x, incx_, beta, y, incy_ );
+    #else
+        // Deal with layout. RowMajor ConjTrans needs copy of x in x2;
+        // in other cases, x2 == x.
+        scalar_t* x2 = const_cast< scalar_t* >( x );
+        Op trans2 = trans;
+        if (layout == Layout::RowMajor) {
+            if constexpr (is_complex_v<scalar_t>) {
+                if (trans == Op::ConjTrans) {
+                    // conjugate alpha, beta, x (in x2), and y (in-place)
+                    alpha = conj( alpha );
+                    beta  = conj( beta );
+
+                    x2 = new scalar_t[ m ];
+                    int64_t ix = (incx > 0 ? 0 : (-m + 1)*incx);
+                    for (int64_t i = 0; i < m; ++i) {
+                        x2[ i ] = conj( x[ ix ] );
+                        ix += incx;
+                    }
+                    incx_ = 1;
+
+                    int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+                    for (int64_t i = 0; i < n; ++i) {
+                        y[ iy ] = conj( y[ iy ] );
+                        iy += incy;
+                    }
                 }
-                incx_ = 1;
+            }
+            // A => A^T; A^T => A; A^H => A + conj
+            swap( m_, n_ );
+            trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+        }
+        char trans_ = to_char( trans2 );
 
+        // call low-level wrapper
+        internal::gemv( trans_, m_, n_,
+                        alpha, A, lda_, x2, incx_, beta, y, incy_ );
+
+        if constexpr (is_complex_v<scalar_t>) {
+            if (x2 != x) {  // RowMajor ConjTrans
+                // y = conj( y )
                 int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
                 for (int64_t i = 0; i < n; ++i) {
                     y[ iy ] = conj( y[ iy ] );
                     iy += incy;
                 }
+                delete[] x2;
             }
         }
-        // A => A^T; A^T => A; A^H => A + conj
-        swap( m_, n_ );
-        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
-    }
-    char trans_ = to_char( trans2 );
-
-    // call low-level wrapper
-    internal::gemv( trans_, m_, n_,
-                    alpha, A, lda_, x2, incx_, beta, y, incy_ );
-
-    if constexpr (is_complex_v<scalar_t>) {
-        if (x2 != x) {  // RowMajor ConjTrans
-            // y = conj( y )
-            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
-            for (int64_t i = 0; i < n; ++i) {
-                y[ iy ] = conj( y[ iy ] );
-                iy += incy;
-            }
-            delete[] x2;
-        }
-    }
+    #endif
 }
 
 }  // namespace impl
@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( gemv2_kernel, gemv2_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup gemv2_internal
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    float const* A, int64_t lda,
+    float const* x, int64_t incx,
+    float* hi, float* lo )
+{
+    gemv2_kernel_dispatch( conj_A, ib, n, A, lda, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup gemv2_internal
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    double const* A, int64_t lda,
+    double const* x, int64_t incx,
+    double* hi, double* lo )
+{
+    gemv2_kernel_dispatch( conj_A, ib, n, A, lda, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup gemv2_internal
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float>* hi, std::complex<float>* lo )
+{
+    gemv2_kernel_dispatch( conj_A, ib, n, A, lda, x, incx, hi, lo );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup gemv2_internal
+void gemv2_kernel_simd(
+    bool conj_A, int64_t ib, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double>* hi, std::complex<double>* lo )
+{
+    gemv2_kernel_dispatch( conj_A, ib, n, A, lda, x, incx, hi, lo );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no compensated gemv.
+/// @ingroup gemv2_internal
+///
+template <typename scalar_t>
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* x, int64_t incx,
+    scalar_t beta,
+    scalar_t*       y, int64_t incy )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( lda < ((layout == Layout::ColMajor) ? m : n) );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::gemv2_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { trans, m, n };
+        counter::insert( element, counter::Id::gemv2 );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::gemv( m, n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::gemv2< scalar_t >( layout, trans, m, n,
+                             alpha, A, lda, x, incx, beta, y, incy );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup gemv2
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* A, int64_t lda,
+    float const* x, int64_t incx,
+    float beta,
+    float*       y, int64_t incy )
+{
+    impl::gemv2( layout, trans, m, n,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gemv2
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* A, int64_t lda,
+    double const* x, int64_t incx,
+    double beta,
+    double*       y, int64_t incy )
+{
+    impl::gemv2( layout, trans, m, n,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gemv2
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, int64_t incy )
+{
+    impl::gemv2( layout, trans, m, n,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gemv2
+void gemv2(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, int64_t incy )
+{
+    impl::gemv2( layout, trans, m, n,
+                 alpha, A, lda, x, incx, beta, y, incy );
+}
+
+}  // namespace blas
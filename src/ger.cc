@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -117,6 +118,104 @@ inline void geru(
                 (blas_complex_double*) A, &lda );
 }
 
+#ifdef BLAS_USE_CBLAS
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float> version.
+/// @ingroup ger_internal
+inline void ger(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, blas_int incx,
+    std::complex<float> const* y, blas_int incy,
+    std::complex<float>*       A, blas_int lda )
+{
+    cblas_cgerc( cblas_layout( layout ), m, n, &alpha, x, incx, y, incy,
+                 A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double> version.
+/// @ingroup ger_internal
+inline void ger(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, blas_int incx,
+    std::complex<double> const* y, blas_int incy,
+    std::complex<double>*       A, blas_int lda )
+{
+    cblas_zgerc( cblas_layout( layout ), m, n, &alpha, x, incx, y, incy,
+                 A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// float, unconjugated x y^T version.
+/// @ingroup geru_internal
+inline void geru(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    float alpha,
+    float const* x, blas_int incx,
+    float const* y, blas_int incy,
+    float*       A, blas_int lda )
+{
+    cblas_sger( cblas_layout( layout ), m, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// double, unconjugated x y^T version.
+/// @ingroup geru_internal
+inline void geru(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    double alpha,
+    double const* x, blas_int incx,
+    double const* y, blas_int incy,
+    double*       A, blas_int lda )
+{
+    cblas_dger( cblas_layout( layout ), m, n, alpha, x, incx, y, incy, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float>, unconjugated x y^T version.
+/// @ingroup geru_internal
+inline void geru(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, blas_int incx,
+    std::complex<float> const* y, blas_int incy,
+    std::complex<float>*       A, blas_int lda )
+{
+    cblas_cgeru( cblas_layout( layout ), m, n, &alpha, x, incx, y, incy,
+                 A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double>, unconjugated x y^T version.
+/// @ingroup geru_internal
+inline void geru(
+    blas::Layout layout,
+    blas_int m, blas_int n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, blas_int incx,
+    std::complex<double> const* y, blas_int incy,
+    std::complex<double>*       A, blas_int lda )
+{
+    cblas_zgeru( cblas_layout( layout ), m, n, &alpha, x, incx, y, incy,
+                 A, lda );
+}
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
 }  // namespace internal
 
 //==============================================================================
@@ -152,6 +251,22 @@ void ger(
     else
         blas_error_if( lda < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (m > nb || n > nb) {
+        for (int64_t i = 0; i < m; i += nb) {
+            int64_t ib = min( nb, m - i );
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                ger( layout, ib, jb, alpha,
+                     internal::vector_block( x, m, incx, i, ib ), incx,
+                     internal::vector_block( y, n, incy, j, jb ), incy,
+                     internal::matrix_block( layout, A, lda, i, j ), lda );
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::ger_type element;
@@ -170,25 +285,30 @@ void ger(
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
 
-    // call low-level wrapper
-    if (layout == Layout::RowMajor) {
-        // conjugate y (in y2)
-        scalar_t* y2 = new scalar_t[ n ];
-        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
-        for (int64_t i = 0; i < n; ++i) {
-            y2[ i ] = conj( y[ iy ] );
-            iy += incy;
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself, without conjugated copies
+        internal::ger( layout, m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
+    #else
+        // call low-level wrapper
+        if (layout == Layout::RowMajor) {
+            // conjugate y (in y2)
+            scalar_t* y2 = new scalar_t[ n ];
+            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+            for (int64_t i = 0; i < n; ++i) {
+                y2[ i ] = conj( y[ iy ] );
+                iy += incy;
+            }
+            incy_ = 1;
+
+            // swap m <=> n, x <=> y, call geru
+            internal::geru( n_, m_, alpha, y2, incy_, x, incx_, A, lda_ );
+
+            delete[] y2;
         }
-        incy_ = 1;
-
-        // swap m <=> n, x <=> y, call geru
-        internal::geru( n_, m_, alpha, y2, incy_, x, incx_, A, lda_ );
-
-        delete[] y2;
-    }
-    else {
-        internal::ger( m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
-    }
+        else {
+            internal::ger( m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
+        }
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -219,6 +339,22 @@ void geru(
     else
         blas_error_if( lda < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (m > nb || n > nb) {
+        for (int64_t i = 0; i < m; i += nb) {
+            int64_t ib = min( nb, m - i );
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                geru( layout, ib, jb, alpha,
+                      internal::vector_block( x, m, incx, i, ib ), incx,
+                      internal::vector_block( y, n, incy, j, jb ), incy,
+                      internal::matrix_block( layout, A, lda, i, j ), lda );
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::geru_type element;
@@ -236,13 +372,18 @@ void geru(
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
 
-    if (layout == Layout::RowMajor) {
-        // swap m <=> n, x <=> y
-        internal::geru( n_, m_, alpha, y, incy_, x, incx_, A, lda_ );
-    }
-    else {
-        internal::geru( m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
-    }
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself
+        internal::geru( layout, m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
+    #else
+        if (layout == Layout::RowMajor) {
+            // swap m <=> n, x <=> y
+            internal::geru( n_, m_, alpha, y, incy_, x, incx_, A, lda_ );
+        }
+        else {
+            internal::geru( m_, n_, alpha, x, incx_, y, incy_, A, lda_ );
+        }
+    #endif
 }
 
 }  // namespace impl
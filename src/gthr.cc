@@ -0,0 +1,207 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( gthr_kernel, gthr_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup gthr_internal
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    float* y, float* x, int64_t const* indx )
+{
+    gthr_kernel_dispatch( zero, nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup gthr_internal
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    double* y, double* x, int64_t const* indx )
+{
+    gthr_kernel_dispatch( zero, nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup gthr_internal
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    std::complex<float>* y, std::complex<float>* x, int64_t const* indx )
+{
+    gthr_kernel_dispatch( zero, nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup gthr_internal
+void gthr_kernel_simd(
+    bool zero, int64_t nz,
+    std::complex<double>* y, std::complex<double>* x, int64_t const* indx )
+{
+    gthr_kernel_dispatch( zero, nz, y, x, indx );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup gthr_internal
+///
+template <typename scalar_t>
+void gthr(
+    int64_t nz,
+    scalar_t const* y,
+    scalar_t* x, int64_t const* indx )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::gthr_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::gthr );
+    #endif
+
+    blas::gthr< scalar_t, scalar_t >( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup gthr_internal
+///
+template <typename scalar_t>
+void gthrz(
+    int64_t nz,
+    scalar_t* y,
+    scalar_t* x, int64_t const* indx )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::gthrz_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::gthrz );
+    #endif
+
+    blas::gthrz< scalar_t, scalar_t >( nz, y, x, indx );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup gthr
+void gthr(
+    int64_t nz,
+    float const* y,
+    float* x, int64_t const* indx )
+{
+    impl::gthr( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gthr
+void gthr(
+    int64_t nz,
+    double const* y,
+    double* x, int64_t const* indx )
+{
+    impl::gthr( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gthr
+void gthr(
+    int64_t nz,
+    std::complex<float> const* y,
+    std::complex<float>* x, int64_t const* indx )
+{
+    impl::gthr( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gthr
+void gthr(
+    int64_t nz,
+    std::complex<double> const* y,
+    std::complex<double>* x, int64_t const* indx )
+{
+    impl::gthr( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup gthr
+void gthrz(
+    int64_t nz,
+    float* y,
+    float* x, int64_t const* indx )
+{
+    impl::gthrz( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup gthr
+void gthrz(
+    int64_t nz,
+    double* y,
+    double* x, int64_t const* indx )
+{
+    impl::gthrz( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup gthr
+void gthrz(
+    int64_t nz,
+    std::complex<float>* y,
+    std::complex<float>* x, int64_t const* indx )
+{
+    impl::gthrz( nz, y, x, indx );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup gthr
+void gthrz(
+    int64_t nz,
+    std::complex<double>* y,
+    std::complex<double>* x, int64_t const* indx )
+{
+    impl::gthrz( nz, y, x, indx );
+}
+
+}  // namespace blas
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -29,12 +30,17 @@ inline void hemm(
     std::complex<float> beta,
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_chemm( &side, &uplo, &m, &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) A, &lda,
-                (blas_complex_float*) B, &ldb,
-                (blas_complex_float*) &beta,
-                (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_chemm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_chemm( &side, &uplo, &m, &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) A, &lda,
+                    (blas_complex_float*) B, &ldb,
+                    (blas_complex_float*) &beta,
+                    (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -50,12 +56,17 @@ inline void hemm(
     std::complex<double> beta,
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zhemm( &side, &uplo, &m, &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) A, &lda,
-                (blas_complex_double*) B, &ldb,
-                (blas_complex_double*) &beta,
-                (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zhemm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_zhemm( &side, &uplo, &m, &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) A, &lda,
+                    (blas_complex_double*) B, &ldb,
+                    (blas_complex_double*) &beta,
+                    (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -108,6 +119,34 @@ void hemm(
         blas_error_if( ldc < n );
     }
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if ((side == Side::Left ? n : m) > nb) {
+        // A is not split; split columns of B, C if A is on the left,
+        // rows if A is on the right
+        if (side == Side::Left) {
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                hemm( layout, side, uplo, m, jb,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, 0, j ), ldb,
+                      beta,
+                      internal::matrix_block( layout, C, ldc, 0, j ), ldc );
+            }
+        }
+        else {
+            for (int64_t i = 0; i < m; i += nb) {
+                int64_t ib = min( nb, m - i );
+                hemm( layout, side, uplo, ib, n,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, i, 0 ), ldb,
+                      beta,
+                      internal::matrix_block( layout, C, ldc, i, 0 ), ldc );
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::hemm_type element;
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -56,6 +57,46 @@ inline void hemv(
                 (blas_complex_double*) y, &incy );
 }
 
+#ifdef BLAS_USE_CBLAS
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float> version.
+/// @ingroup hemv_internal
+inline void hemv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas_int n,
+    std::complex<float> alpha,
+    std::complex<float> const* A, blas_int lda,
+    std::complex<float> const* x, blas_int incx,
+    std::complex<float> beta,
+    std::complex<float>*       y, blas_int incy )
+{
+    cblas_chemv( cblas_layout( layout ), cblas_uplo( uplo ), n, &alpha, A, lda,
+                 x, incx, &beta, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double> version.
+/// @ingroup hemv_internal
+inline void hemv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas_int n,
+    std::complex<double> alpha,
+    std::complex<double> const* A, blas_int lda,
+    std::complex<double> const* x, blas_int incx,
+    std::complex<double> beta,
+    std::complex<double>*       y, blas_int incy )
+{
+    cblas_zhemv( cblas_layout( layout ), cblas_uplo( uplo ), n, &alpha, A, lda,
+                 x, incx, &beta, y, incy );
+}
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
 }  // namespace internal
 
 //==============================================================================
@@ -106,46 +147,52 @@ void hemv(
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
 
-    // Deal with layout. RowMajor needs copy of x in x2;
-    // in other cases, x2 == x.
-    scalar_t* x2 = const_cast< scalar_t* >( x );
-    if (layout == Layout::RowMajor) {
-        // swap lower <=> upper
-        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
-
-        // conjugate alpha, beta, x (in x2), and y (in-place)
-        alpha = conj( alpha );
-        beta  = conj( beta );
-
-        x2 = new scalar_t[ n ];
-        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
-        for (int64_t i = 0; i < n; ++i) {
-            x2[ i ] = conj( x[ ix ] );
-            ix += incx;
-        }
-        incx_ = 1;
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself, without conjugated copies
+        internal::hemv( layout, uplo, n_,
+                        alpha, A, lda_, x, incx_, beta, y, incy_ );
+    #else
+        // Deal with layout. RowMajor needs copy of x in x2;
+        // in other cases, x2 == x.
+        scalar_t* x2 = const_cast< scalar_t* >( x );
+        if (layout == Layout::RowMajor) {
+            // swap lower <=> upper
+            uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
+            // conjugate alpha, beta, x (in x2), and y (in-place)
+            alpha = conj( alpha );
+            beta  = conj( beta );
 
-        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
-        for (int64_t i = 0; i < n; ++i) {
-            y[ iy ] = conj( y[ iy ] );
-            iy += incy;
+            x2 = new scalar_t[ n ];
+            int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+            for (int64_t i = 0; i < n; ++i) {
+                x2[ i ] = conj( x[ ix ] );
+                ix += incx;
+            }
+            incx_ = 1;
+
+            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+            for (int64_t i = 0; i < n; ++i) {
+                y[ iy ] = conj( y[ iy ] );
+                iy += incy;
+            }
         }
-    }
-    char uplo_ = to_char( uplo );
-
-    // call low-level wrapper
-    internal::hemv( uplo_, n_,
-                    alpha, A, lda_, x2, incx_, beta, y, incy_ );
-
-    if (layout == Layout::RowMajor) {
-        // y = conj( y )
-        int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
-        for (int64_t i = 0; i < n; ++i) {
-            y[ iy ] = conj( y[ iy ] );
-            iy += incy;
+        char uplo_ = to_char( uplo );
+
+        // call low-level wrapper
+        internal::hemv( uplo_, n_,
+                        alpha, A, lda_, x2, incx_, beta, y, incy_ );
+
+        if (layout == Layout::RowMajor) {
+            // y = conj( y )
+            int64_t iy = (incy > 0 ? 0 : (-n + 1)*incy);
+            for (int64_t i = 0; i < n; ++i) {
+                y[ iy ] = conj( y[ iy ] );
+                iy += incy;
+            }
+            delete[] x2;
         }
-        delete[] x2;
-    }
+    #endif
 }
 
 }  // namespace impl
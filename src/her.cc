@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -48,6 +49,42 @@ inline void her(
                (blas_complex_double*) A, &lda );
 }
 
+#ifdef BLAS_USE_CBLAS
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float> version.
+/// @ingroup her_internal
+inline void her(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas_int n,
+    float alpha,
+    std::complex<float> const* x, blas_int incx,
+    std::complex<float>*       A, blas_int lda )
+{
+    cblas_cher( cblas_layout( layout ), cblas_uplo( uplo ), n, alpha, x, incx,
+                A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double> version.
+/// @ingroup her_internal
+inline void her(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas_int n,
+    double alpha,
+    std::complex<double> const* x, blas_int incx,
+    std::complex<double>*       A, blas_int lda )
+{
+    cblas_zher( cblas_layout( layout ), cblas_uplo( uplo ), n, alpha, x, incx,
+                A, lda );
+}
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
 }  // namespace internal
 
 //==============================================================================
@@ -92,31 +129,36 @@ void her(
     blas_int lda_  = to_blas_int( lda );
     blas_int incx_ = to_blas_int( incx );
 
-    // Deal with layout. RowMajor needs copy of x in x2;
-    // in other cases, x2 == x.
-    scalar_t* x2 = const_cast< scalar_t* >( x );
-    if (layout == Layout::RowMajor) {
-        // swap lower <=> upper
-        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
-
-        // conjugate x (in x2)
-        x2 = new scalar_t[ n ];
-        int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
-        for (int64_t i = 0; i < n; ++i) {
-            x2[ i ] = conj( x[ ix ] );
-            ix += incx;
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself, without conjugated copies
+        internal::her( layout, uplo, n_, alpha, x, incx_, A, lda_ );
+    #else
+        // Deal with layout. RowMajor needs copy of x in x2;
+        // in other cases, x2 == x.
+        scalar_t* x2 = const_cast< scalar_t* >( x );
+        if (layout == Layout::RowMajor) {
+            // swap lower <=> upper
+            uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
+            // conjugate x (in x2)
+            x2 = new scalar_t[ n ];
+            int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+            for (int64_t i = 0; i < n; ++i) {
+                x2[ i ] = conj( x[ ix ] );
+                ix += incx;
+            }
+            incx_ = 1;
         }
-        incx_ = 1;
-    }
-    char uplo_ = to_char( uplo );
+        char uplo_ = to_char( uplo );
 
-    // call low-level wrapper
-    internal::her( uplo_, n_,
-                   alpha, x2, incx_, A, lda_ );
+        // call low-level wrapper
+        internal::her( uplo_, n_,
+                       alpha, x2, incx_, A, lda_ );
 
-    if (layout == Layout::RowMajor) {
-        delete[] x2;
-    }
+        if (layout == Layout::RowMajor) {
+            delete[] x2;
+        }
+    #endif
 }
 
 }  // namespace impl
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -27,11 +28,16 @@ inline void her2(
     std::complex<float> const* y, blas_int incy,
     std::complex<float>*       A, blas_int lda )
 {
-    BLAS_cher2( &uplo, &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) x, &incx,
-                (blas_complex_float*) y, &incy,
-                (blas_complex_float*) A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cher2( CblasColMajor, cblas_uplo( uplo ), n, &alpha, x, incx, y,
+                     incy, A, lda );
+    #else
+        BLAS_cher2( &uplo, &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) x, &incx,
+                    (blas_complex_float*) y, &incy,
+                    (blas_complex_float*) A, &lda );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -45,11 +51,16 @@ inline void her2(
     std::complex<double> const* y, blas_int incy,
     std::complex<double>*       A, blas_int lda )
 {
-    BLAS_zher2( &uplo, &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) x, &incx,
-                (blas_complex_double*) y, &incy,
-                (blas_complex_double*) A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zher2( CblasColMajor, cblas_uplo( uplo ), n, &alpha, x, incx, y,
+                     incy, A, lda );
+    #else
+        BLAS_zher2( &uplo, &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) x, &incx,
+                    (blas_complex_double*) y, &incy,
+                    (blas_complex_double*) A, &lda );
+    #endif
 }
 
 }  // namespace internal
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -29,12 +30,17 @@ inline void her2k(
     float beta,   // note: real
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_cher2k( &uplo, &trans, &n, &k,
-                 (blas_complex_float*) &alpha,
-                 (blas_complex_float*) A, &lda,
-                 (blas_complex_float*) B, &ldb,
-                 &beta,
-                 (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cher2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, &alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_cher2k( &uplo, &trans, &n, &k,
+                     (blas_complex_float*) &alpha,
+                     (blas_complex_float*) A, &lda,
+                     (blas_complex_float*) B, &ldb,
+                     &beta,
+                     (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -50,12 +56,17 @@ inline void her2k(
     double beta,  // note: real
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zher2k( &uplo, &trans, &n, &k,
-                 (blas_complex_double*) &alpha,
-                 (blas_complex_double*) A, &lda,
-                 (blas_complex_double*) B, &ldb,
-                 &beta,
-                 (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zher2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, &alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_zher2k( &uplo, &trans, &n, &k,
+                     (blas_complex_double*) &alpha,
+                     (blas_complex_double*) A, &lda,
+                     (blas_complex_double*) B, &ldb,
+                     &beta,
+                     (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -101,6 +112,27 @@ void her2k(
 
     blas_error_if( ldc < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (k > nb) {
+        // C accumulates after the first block of k
+        const real_type<scalar_t> one = 1;
+        for (int64_t l = 0; l < k; l += nb) {
+            int64_t lb = min( nb, k - l );
+            scalar_t const* Al = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, A, lda, 0, l )
+                : internal::matrix_block( layout, A, lda, l, 0 ));
+            scalar_t const* Bl = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, B, ldb, 0, l )
+                : internal::matrix_block( layout, B, ldb, l, 0 ));
+            her2k( layout, uplo, trans, n, lb,
+                   alpha, Al, lda, Bl, ldb,
+                   (l == 0 ? beta : one),
+                   C, ldc );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::her2k_type element;
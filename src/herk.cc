@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -28,11 +29,16 @@ inline void herk(
     float beta,   // note: real
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_cherk( &uplo, &trans, &n, &k,
-                &alpha,
-                (blas_complex_float*) A, &lda,
-                &beta,
-                (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cherk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, alpha, A, lda, beta, C, ldc );
+    #else
+        BLAS_cherk( &uplo, &trans, &n, &k,
+                    &alpha,
+                    (blas_complex_float*) A, &lda,
+                    &beta,
+                    (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -47,11 +53,16 @@ inline void herk(
     double beta,   // note: real
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zherk( &uplo, &trans, &n, &k,
-                &alpha,
-                (blas_complex_double*) A, &lda,
-                &beta,
-                (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zherk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, alpha, A, lda, beta, C, ldc );
+    #else
+        BLAS_zherk( &uplo, &trans, &n, &k,
+                    &alpha,
+                    (blas_complex_double*) A, &lda,
+                    &beta,
+                    (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -92,6 +103,24 @@ void herk(
 
     blas_error_if( ldc < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (k > nb) {
+        // C accumulates after the first block of k
+        const real_type<scalar_t> one = 1;
+        for (int64_t l = 0; l < k; l += nb) {
+            int64_t lb = min( nb, k - l );
+            scalar_t const* Al = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, A, lda, 0, l )
+                : internal::matrix_block( layout, A, lda, l, 0 ));
+            herk( layout, uplo, trans, n, lb,
+                  alpha, Al, lda,
+                  (l == 0 ? beta : one),
+                  C, ldc );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::herk_type element;
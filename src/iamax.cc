@@ -7,6 +7,8 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -23,7 +25,12 @@ inline blas_int iamax(
     blas_int n,
     float const* x, blas_int incx )
 {
-    return BLAS_isamax( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS returns 0-based index
+        return cblas_isamax( n, x, incx ) + 1;
+    #else
+        return BLAS_isamax( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -33,7 +40,12 @@ inline blas_int iamax(
     blas_int n,
     double const* x, blas_int incx )
 {
-    return BLAS_idamax( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS returns 0-based index
+        return cblas_idamax( n, x, incx ) + 1;
+    #else
+        return BLAS_idamax( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -43,8 +55,13 @@ inline blas_int iamax(
     blas_int n,
     std::complex<float> const* x, blas_int incx )
 {
-    return BLAS_icamax( &n,
-                        (blas_complex_float*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS returns 0-based index
+        return cblas_icamax( n, x, incx ) + 1;
+    #else
+        return BLAS_icamax( &n,
+                            (blas_complex_float*) x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -54,8 +71,31 @@ inline blas_int iamax(
     blas_int n,
     std::complex<double> const* x, blas_int incx )
 {
-    return BLAS_izamax( &n,
-                        (blas_complex_double*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS returns 0-based index
+        return cblas_izamax( n, x, incx ) + 1;
+    #else
+        return BLAS_izamax( &n,
+                            (blas_complex_double*) x, &incx );
+    #endif
+}
+
+BLAS_SIMD_KERNEL( iamax_kernel, iamax_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float16 version.
+/// @ingroup iamax_internal
+int64_t iamax_kernel_simd( int64_t n, float16 const* x )
+{
+    return iamax_kernel_dispatch( n, x );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 version.
+/// @ingroup iamax_internal
+int64_t iamax_kernel_simd( int64_t n, bfloat16 const* x )
+{
+    return iamax_kernel_dispatch( n, x );
 }
 
 }  // namespace internal
@@ -77,6 +117,24 @@ int64_t iamax(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        // first index of the largest of the blocks' maxima
+        int64_t imax = 0;
+        real_type<scalar_t> xmax = -1;
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            int64_t k = i + iamax( ib, x + i*incx, incx );
+            real_type<scalar_t> xk = abs1( x[ k*incx ] );
+            if (xk > xmax) {
+                xmax = xk;
+                imax = k;
+            }
+        }
+        return imax;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::iamax_type element;
@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no multiple axpy.
+/// @ingroup maxpy_internal
+///
+template <typename scalar_t>
+void maxpy(
+    int64_t n, int64_t k,
+    scalar_t const* alpha,
+    scalar_t const* X, int64_t ldx,
+    scalar_t*       y, int64_t incy )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( ldx < max( 1, n ) );
+    blas_error_if( incy == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::maxpy_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n, k };
+        counter::insert( element, counter::Id::maxpy );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::maxpy( n, k );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::maxpy< scalar_t, scalar_t >( n, k, alpha, X, ldx, y, incy );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup maxpy
+void maxpy(
+    int64_t n, int64_t k,
+    float const* alpha,
+    float const* X, int64_t ldx,
+    float*       y, int64_t incy )
+{
+    impl::maxpy( n, k, alpha, X, ldx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup maxpy
+void maxpy(
+    int64_t n, int64_t k,
+    double const* alpha,
+    double const* X, int64_t ldx,
+    double*       y, int64_t incy )
+{
+    impl::maxpy( n, k, alpha, X, ldx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup maxpy
+void maxpy(
+    int64_t n, int64_t k,
+    std::complex<float> const* alpha,
+    std::complex<float> const* X, int64_t ldx,
+    std::complex<float>*       y, int64_t incy )
+{
+    impl::maxpy( n, k, alpha, X, ldx, y, incy );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup maxpy
+void maxpy(
+    int64_t n, int64_t k,
+    std::complex<double> const* alpha,
+    std::complex<double> const* X, int64_t ldx,
+    std::complex<double>*       y, int64_t incy )
+{
+    impl::maxpy( n, k, alpha, X, ldx, y, incy );
+}
+
+}  // namespace blas
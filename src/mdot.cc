@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no multiple dot.
+/// @ingroup mdot_internal
+///
+template <typename scalar_t>
+void mdot(
+    int64_t n, int64_t k,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* y, int64_t incy,
+    scalar_t*       result )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+    blas_error_if( ldx < max( 1, n ) );
+    blas_error_if( incy == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::mdot_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n, k };
+        counter::insert( element, counter::Id::mdot );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::mdot( n, k );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::mdot< scalar_t, scalar_t >( n, k, X, ldx, y, incy, result );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup mdot
+void mdot(
+    int64_t n, int64_t k,
+    float const* X, int64_t ldx,
+    float const* y, int64_t incy,
+    float*       result )
+{
+    impl::mdot( n, k, X, ldx, y, incy, result );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup mdot
+void mdot(
+    int64_t n, int64_t k,
+    double const* X, int64_t ldx,
+    double const* y, int64_t incy,
+    double*       result )
+{
+    impl::mdot( n, k, X, ldx, y, incy, result );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup mdot
+void mdot(
+    int64_t n, int64_t k,
+    std::complex<float> const* X, int64_t ldx,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>*       result )
+{
+    impl::mdot( n, k, X, ldx, y, incy, result );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup mdot
+void mdot(
+    int64_t n, int64_t k,
+    std::complex<double> const* X, int64_t ldx,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>*       result )
+{
+    impl::mdot( n, k, X, ldx, y, incy, result );
+}
+
+}  // namespace blas
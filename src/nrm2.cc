@@ -7,7 +7,10 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "reproducible.hh"
+#include "cblas.hh"
 
+#include <cmath>
 #include <limits>
 #include <string.h>
 
@@ -23,7 +26,11 @@ inline float nrm2(
     blas_int n,
     float const* x, blas_int incx )
 {
-    return BLAS_snrm2( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_snrm2( n, x, incx );
+    #else
+        return BLAS_snrm2( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -33,7 +40,11 @@ inline double nrm2(
     blas_int n,
     double const* x, blas_int incx )
 {
-    return BLAS_dnrm2( &n, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_dnrm2( n, x, incx );
+    #else
+        return BLAS_dnrm2( &n, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -43,7 +54,11 @@ inline float nrm2(
     blas_int n,
     std::complex<float> const* x, blas_int incx )
 {
-    return BLAS_scnrm2( &n, (blas_complex_float*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_scnrm2( n, x, incx );
+    #else
+        return BLAS_scnrm2( &n, (blas_complex_float*) x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -53,7 +68,11 @@ inline double nrm2(
     blas_int n,
     std::complex<double> const* x, blas_int incx )
 {
-    return BLAS_dznrm2( &n, (blas_complex_double*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        return cblas_dznrm2( n, x, incx );
+    #else
+        return BLAS_dznrm2( &n, (blas_complex_double*) x, &incx );
+    #endif
 }
 
 }  // namespace internal
@@ -75,6 +94,18 @@ real_type<scalar_t> nrm2(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        // combine as sqrt( sum r_i^2 ), avoiding overflow
+        real_type<scalar_t> result = 0;
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            result = std::hypot( result, nrm2( ib, x + i*incx, incx ) );
+        }
+        return result;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::nrm2_type element;
@@ -86,6 +117,9 @@ real_type<scalar_t> nrm2(
         counter::inc_flop_count( (long long int)gflops );
     #endif
 
+    if (get_reproducible())
+        return internal::reproducible_nrm2( n, x, incx );
+
     // convert arguments
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
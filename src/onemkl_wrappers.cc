@@ -580,6 +580,92 @@ void gemm(
             beta,  dC, lddc ) );
 }
 
+//------------------------------------------------------------------------------
+// gemmt
+//------------------------------------------------------------------------------
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    float alpha,
+    float const *dA, device_blas_int ldda,
+    float const *dB, device_blas_int lddb,
+    float beta,
+    float       *dC, device_blas_int lddc,
+    blas::Queue& queue )
+{
+    blas_dev_call(
+        oneapi::mkl::blas::gemmt(
+            queue.stream(),
+            uplo2onemkl( uplo ), op2onemkl( transA ), op2onemkl( transB ),
+            n, k,
+            alpha, dA, ldda,
+                   dB, lddb,
+            beta,  dC, lddc ) );
+}
+
+//------------------------------------------------------------------------------
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    double alpha,
+    double const *dA, device_blas_int ldda,
+    double const *dB, device_blas_int lddb,
+    double beta,
+    double       *dC, device_blas_int lddc,
+    blas::Queue& queue )
+{
+    blas_dev_call(
+        oneapi::mkl::blas::gemmt(
+            queue.stream(),
+            uplo2onemkl( uplo ), op2onemkl( transA ), op2onemkl( transB ),
+            n, k,
+            alpha, dA, ldda,
+                   dB, lddb,
+            beta,  dC, lddc ) );
+}
+
+//------------------------------------------------------------------------------
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    std::complex<float> alpha,
+    std::complex<float> const *dA, device_blas_int ldda,
+    std::complex<float> const *dB, device_blas_int lddb,
+    std::complex<float> beta,
+    std::complex<float>       *dC, device_blas_int lddc,
+    blas::Queue& queue )
+{
+    blas_dev_call(
+        oneapi::mkl::blas::gemmt(
+            queue.stream(),
+            uplo2onemkl( uplo ), op2onemkl( transA ), op2onemkl( transB ),
+            n, k,
+            alpha, dA, ldda,
+                   dB, lddb,
+            beta,  dC, lddc ) );
+}
+
+//------------------------------------------------------------------------------
+void gemmt(
+    blas::Uplo uplo, blas::Op transA, blas::Op transB,
+    device_blas_int n, device_blas_int k,
+    std::complex<double> alpha,
+    std::complex<double> const *dA, device_blas_int ldda,
+    std::complex<double> const *dB, device_blas_int lddb,
+    std::complex<double> beta,
+    std::complex<double>       *dC, device_blas_int lddc,
+    blas::Queue& queue )
+{
+    blas_dev_call(
+        oneapi::mkl::blas::gemmt(
+            queue.stream(),
+            uplo2onemkl( uplo ), op2onemkl( transA ), op2onemkl( transB ),
+            n, k,
+            alpha, dA, ldda,
+                   dB, lddb,
+            beta,  dC, lddc ) );
+}
+
 //------------------------------------------------------------------------------
 // trsm
 //------------------------------------------------------------------------------
@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas/parallel.hh"
+#include "blas/config.h"
+#include "simd.hh"
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace blas {
+
+namespace {
+
+// 0 means use omp_get_max_threads().
+std::atomic<int> g_num_threads( 0 );
+
+// 64^3 multiply-adds.
+std::atomic<int64_t> g_parallel_threshold( 262144 );
+
+// Inline kernels beat OpenBLAS up to about 4x4 gemm and 16-element axpy, dot.
+std::atomic<int64_t> g_small_threshold( 4 );
+
+std::atomic<bool> g_reproducible( false );
+
+std::atomic<int64_t> g_split_size( std::numeric_limits<blas_int>::max() );
+
+// -1 means use the best instruction set the CPU supports.
+std::atomic<int> g_simd_isa( -1 );
+
+//------------------------------------------------------------------------------
+// @return best instruction set with kernel variants that the CPU supports.
+// __builtin_cpu_supports also checks that the OS saves the vector registers.
+internal::SimdIsa detect_simd_isa()
+{
+    using internal::SimdIsa;
+    #ifdef BLAS_SIMD_X86
+        __builtin_cpu_init();
+        bool fma = __builtin_cpu_supports( "fma" );
+        if (fma
+            && __builtin_cpu_supports( "avx512f" )
+            && __builtin_cpu_supports( "avx512vl" )
+            && __builtin_cpu_supports( "avx512bw" )
+            && __builtin_cpu_supports( "avx512dq" ))
+            return SimdIsa::AVX512;
+        if (fma && __builtin_cpu_supports( "avx2" ))
+            return SimdIsa::AVX2;
+    #endif
+    return SimdIsa::Generic;
+}
+
+//------------------------------------------------------------------------------
+internal::SimdIsa detected_simd_isa()
+{
+    static const internal::SimdIsa isa = detect_simd_isa();
+    return isa;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void set_num_threads( int num_threads )
+{
+    g_num_threads = max( num_threads, 0 );
+}
+
+//------------------------------------------------------------------------------
+int get_num_threads()
+{
+    #ifdef _OPENMP
+        int num_threads = g_num_threads;
+        return (num_threads > 0 ? num_threads : omp_get_max_threads());
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+void set_parallel_threshold( int64_t threshold )
+{
+    g_parallel_threshold = threshold;
+}
+
+//------------------------------------------------------------------------------
+int64_t get_parallel_threshold()
+{
+    return g_parallel_threshold;
+}
+
+//------------------------------------------------------------------------------
+void set_small_threshold( int64_t threshold )
+{
+    g_small_threshold = max( threshold, int64_t( 0 ) );
+}
+
+//------------------------------------------------------------------------------
+int64_t get_small_threshold()
+{
+    return g_small_threshold;
+}
+
+//------------------------------------------------------------------------------
+void set_split_size( int64_t size )
+{
+    int64_t max_size = std::numeric_limits<blas_int>::max();
+    g_split_size = (size > 0 ? min( size, max_size ) : max_size);
+}
+
+//------------------------------------------------------------------------------
+int64_t get_split_size()
+{
+    return g_split_size;
+}
+
+//------------------------------------------------------------------------------
+void set_reproducible( bool reproducible )
+{
+    g_reproducible = reproducible;
+}
+
+//------------------------------------------------------------------------------
+bool get_reproducible()
+{
+    return g_reproducible;
+}
+
+//------------------------------------------------------------------------------
+void set_simd_isa( char const* isa )
+{
+    using internal::SimdIsa;
+    if (isa == nullptr || strcmp( isa, "" ) == 0 || strcmp( isa, "auto" ) == 0) {
+        g_simd_isa = -1;
+        return;
+    }
+
+    SimdIsa value;
+    if (strcmp( isa, "avx512" ) == 0)
+        value = SimdIsa::AVX512;
+    else if (strcmp( isa, "avx2" ) == 0)
+        value = SimdIsa::AVX2;
+    else if (strcmp( isa, "generic" ) == 0 || strcmp( isa, "neon" ) == 0)
+        value = SimdIsa::Generic;
+    else
+        throw Error( "unknown instruction set: " + std::string( isa ) );
+
+    blas_error_if_msg( value > detected_simd_isa(),
+                       "CPU doesn't support instruction set %s", isa );
+    g_simd_isa = int( value );
+}
+
+//------------------------------------------------------------------------------
+char const* get_simd_isa()
+{
+    switch (internal::simd_isa()) {
+        case internal::SimdIsa::AVX512: return "avx512";
+        case internal::SimdIsa::AVX2:   return "avx2";
+        default:
+            #if defined(__ARM_NEON) || defined(__aarch64__)
+                return "neon";
+            #else
+                return "generic";
+            #endif
+    }
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+SimdIsa simd_isa()
+{
+    int isa = g_simd_isa;
+    return (isa < 0 ? detected_simd_isa() : SimdIsa( isa ));
+}
+
+}  // namespace internal
+
+}  // namespace blas
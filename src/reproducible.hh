@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_REPRODUCIBLE_HH
+#define BLAS_REPRODUCIBLE_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+
+#include <cmath>
+#include <vector>
+
+// Fixed-order kernels for reproducible mode, see set_reproducible.
+// The order of every sum depends only on the dimensions, never on the
+// number of threads, so results are bitwise identical for any thread count.
+
+namespace blas {
+namespace internal {
+
+/// Reductions sum blocks of this many elements; blocks are the unit
+/// of parallelism.
+const int64_t reproducible_block = 4096;
+
+/// Each block is summed in this many interleaved partial sums,
+/// so the loop vectorizes without reassociation by the compiler.
+const int reproducible_lanes = 8;
+
+//------------------------------------------------------------------------------
+/// @return sum_{i = 0}^{n-1} term( i ), summed in reproducible_lanes
+/// interleaved partial sums, which are then added pairwise.
+/// The order depends only on n.
+/// @ingroup reproducible_internal
+template <typename T, typename Term>
+inline T reproducible_sum_serial( int64_t n, Term&& term )
+{
+    constexpr int lanes = reproducible_lanes;
+    T s[ lanes ];
+    for (int l = 0; l < lanes; ++l)
+        s[ l ] = T( 0 );
+
+    int64_t n8 = n - n % lanes;
+    for (int64_t i = 0; i < n8; i += lanes) {
+        for (int l = 0; l < lanes; ++l)
+            s[ l ] += term( i + l );
+    }
+    for (int64_t i = n8; i < n; ++i)
+        s[ i - n8 ] += term( i );
+
+    for (int w = lanes/2; w > 0; w /= 2) {
+        for (int l = 0; l < w; ++l)
+            s[ l ] += s[ l + w ];
+    }
+    return s[ 0 ];
+}
+
+//------------------------------------------------------------------------------
+/// @return sum_{i = 0}^{n-1} term( i ), summed in blocks of
+/// reproducible_block elements, in parallel, then the block sums
+/// are added in order. The order depends only on n.
+/// @ingroup reproducible_internal
+template <typename T, typename Term>
+T reproducible_sum( int64_t n, Term&& term )
+{
+    const int64_t nb = reproducible_block;
+    int64_t nblocks = (n + nb - 1) / nb;
+    if (nblocks <= 1)
+        return reproducible_sum_serial<T>( n, term );
+
+    std::vector<T> partial( nblocks );
+    int nthreads = parallel_num_threads( n );
+    #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                if( nthreads > 1 )
+    for (int64_t b = 0; b < nblocks; ++b) {
+        int64_t i0 = b*nb;
+        int64_t ib = min( nb, n - i0 );
+        partial[ b ] = reproducible_sum_serial<T>(
+            ib, [&]( int64_t i ) { return term( i0 + i ); } );
+    }
+
+    T sum = partial[ 0 ];
+    for (int64_t b = 1; b < nblocks; ++b)
+        sum += partial[ b ];
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+/// Reproducible dot product, x^H y if conj_x, else x^T y.
+/// Arguments are as for dot.
+/// @ingroup reproducible_internal
+template <typename scalar_t>
+scalar_t reproducible_dot(
+    bool conj_x, int64_t n,
+    scalar_t const* x, int64_t incx,
+    scalar_t const* y, int64_t incy )
+{
+    // with negative inc, element i is at (n - 1 - i)*|inc|
+    if (incx < 0)
+        x += (1 - n)*incx;
+    if (incy < 0)
+        y += (1 - n)*incy;
+
+    if (is_complex_v<scalar_t> && conj_x) {
+        return reproducible_sum<scalar_t>( n, [=]( int64_t i ) {
+            return conj( x[ i*incx ] ) * y[ i*incy ];
+        } );
+    }
+    else {
+        return reproducible_sum<scalar_t>( n, [=]( int64_t i ) {
+            return x[ i*incx ] * y[ i*incy ];
+        } );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Reproducible sum of |Re(x_i)| + |Im(x_i)|. Arguments are as for asum.
+/// @ingroup reproducible_internal
+template <typename scalar_t>
+real_type<scalar_t> reproducible_asum(
+    int64_t n,
+    scalar_t const* x, int64_t incx )
+{
+    using real_t = real_type<scalar_t>;
+    return reproducible_sum<real_t>( n, [=]( int64_t i ) {
+        scalar_t xi = x[ i*incx ];
+        return real_t( std::abs( real( xi ) ) + std::abs( imag( xi ) ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+/// Reproducible 2-norm. Arguments are as for nrm2.
+///
+/// Single precision accumulates squares in double, which can neither
+/// overflow nor underflow. Double precision first finds
+/// amax = max_i |Re(x_i)|, |Im(x_i)|, which is exact and independent of
+/// order, then sums squares scaled by a power of 2 that puts amax in
+/// [0.5, 1), so the sum can't overflow and scaling is exact.
+///
+/// @ingroup reproducible_internal
+template <typename scalar_t>
+real_type<scalar_t> reproducible_nrm2(
+    int64_t n,
+    scalar_t const* x, int64_t incx )
+{
+    using real_t = real_type<scalar_t>;
+
+    if constexpr (std::is_same< real_t, float >::value) {
+        double sum = reproducible_sum<double>( n, [=]( int64_t i ) {
+            double re = real( x[ i*incx ] );
+            double im = imag( x[ i*incx ] );
+            return re*re + im*im;
+        } );
+        return real_t( std::sqrt( sum ) );
+    }
+    else {
+        // Comparisons skip NaN, which then propagates through the sum.
+        real_t amax = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t xi = x[ i*incx ];
+            real_t a = max( std::abs( real( xi ) ), std::abs( imag( xi ) ) );
+            if (a > amax)
+                amax = a;
+        }
+        if (amax == 0)
+            return amax;
+
+        // For Inf, scale = 1; squares are Inf, or NaN if x has NaN.
+        int e = 0;
+        if (amax <= std::numeric_limits<real_t>::max()) {
+            std::frexp( amax, &e );
+            e = max( e, std::numeric_limits<real_t>::min_exponent );
+        }
+        real_t scale = std::ldexp( real_t( 1 ), -e );
+        real_t sum = reproducible_sum<real_t>( n, [=]( int64_t i ) {
+            real_t re = scale * real( x[ i*incx ] );
+            real_t im = scale * imag( x[ i*incx ] );
+            return re*re + im*im;
+        } );
+        return std::ldexp( std::sqrt( sum ), e );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Reproducible gemv, y = alpha op(A) x + beta y, with each
+/// (op(A) x)_i summed in the order of the columns of op(A).
+/// Arguments are as for gemv; they are assumed valid.
+/// @ingroup reproducible_internal
+template <typename scalar_t>
+void reproducible_gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* x, int64_t incx,
+    scalar_t beta,
+    scalar_t*       y, int64_t incy )
+{
+    const scalar_t zero = 0;
+
+    // quick return, as in the reference BLAS
+    if (m == 0 || n == 0)
+        return;
+
+    // In column-major terms, op(A) is A or A^T, maybe conjugated;
+    // row-major A is column-major A^T.
+    bool transpose = (trans != Op::NoTrans);
+    bool conj_A    = (trans == Op::ConjTrans);
+    if (layout == Layout::RowMajor) {
+        transpose = ! transpose;
+        std::swap( m, n );
+    }
+    // op(A) is my-by-nx
+    int64_t my = (transpose ? n : m);
+    int64_t nx = (transpose ? m : n);
+
+    if (incx < 0)
+        x += (1 - nx)*incx;
+    if (incy < 0)
+        y += (1 - my)*incy;
+
+    auto Aij = [=]( int64_t i, int64_t j ) {
+        scalar_t a = A[ i + j*lda ];
+        if constexpr (is_complex_v<scalar_t>) {
+            if (conj_A)
+                a = conj( a );
+        }
+        return a;
+    };
+
+    auto update_y = [=]( int64_t i, scalar_t t ) {
+        y[ i*incy ] = (beta == zero ? alpha*t : alpha*t + beta*y[ i*incy ]);
+    };
+
+    if (alpha == zero) {
+        // y = beta y; A and x are not accessed
+        for (int64_t i = 0; i < my; ++i)
+            y[ i*incy ] = (beta == zero ? zero : beta*y[ i*incy ]);
+        return;
+    }
+
+    int nthreads = parallel_num_threads( m*n );
+    if (transpose) {
+        // y_j = alpha dot( A(:, j), x ) + beta y_j
+        #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                    if( nthreads > 1 )
+        for (int64_t j = 0; j < my; ++j) {
+            scalar_t t = reproducible_sum_serial<scalar_t>(
+                nx, [&]( int64_t i ) { return Aij( i, j ) * x[ i*incx ]; } );
+            update_y( j, t );
+        }
+    }
+    else {
+        // For each block of rows, t = A(i0:i1, :) x, accumulated
+        // column by column, so t_i is summed in order j = 0, ..., n-1.
+        const int64_t mb = 256;
+        int64_t nblocks = (my + mb - 1) / mb;
+        #pragma omp parallel for num_threads( nthreads ) schedule( static ) \
+                    if( nthreads > 1 )
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t i0 = b*mb;
+            int64_t ib = min( mb, my - i0 );
+            scalar_t t[ mb ];
+            for (int64_t i = 0; i < ib; ++i)
+                t[ i ] = zero;
+            for (int64_t j = 0; j < nx; ++j) {
+                scalar_t xj = x[ j*incx ];
+                if (conj_A) {
+                    for (int64_t i = 0; i < ib; ++i)
+                        t[ i ] += Aij( i0 + i, j ) * xj;
+                }
+                else {
+                    scalar_t const* Aj = &A[ i0 + j*lda ];
+                    #pragma omp simd
+                    for (int64_t i = 0; i < ib; ++i)
+                        t[ i ] += Aj[ i ] * xj;
+                }
+            }
+            for (int64_t i = 0; i < ib; ++i)
+                update_y( i0 + i, t[ i ] );
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif // BLAS_REPRODUCIBLE_HH
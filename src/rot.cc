@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -30,6 +31,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
@@ -45,7 +59,11 @@ void rot(
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
-    BLAS_srot( &n_, x, &incx_, y, &incy_, &c, &s );
+    #ifdef BLAS_USE_CBLAS
+        cblas_srot( n_, x, incx_, y, incy_, c, s );
+    #else
+        BLAS_srot( &n_, x, &incx_, y, &incy_, &c, &s );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -62,6 +80,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
@@ -77,7 +108,11 @@ void rot(
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
-    BLAS_drot( &n_, x, &incx_, y, &incy_, &c, &s );
+    #ifdef BLAS_USE_CBLAS
+        cblas_drot( n_, x, incx_, y, incy_, c, s );
+    #else
+        BLAS_drot( &n_, x, &incx_, y, &incy_, &c, &s );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -99,6 +134,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
@@ -135,6 +183,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
@@ -174,6 +235,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
@@ -211,6 +285,19 @@ void rot(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rot( ib,
+                 internal::vector_block( x, n, incx, i, ib ), incx,
+                 internal::vector_block( y, n, incy, i, ib ), incy,
+                 c, s );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rot_type element;
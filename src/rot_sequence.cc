@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( rot_sequence_block, rot_sequence_block_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup rot_sequence_internal
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    float const* C, int64_t ldc,
+    float const* S, int64_t lds,
+    float* A, int64_t lda )
+{
+    rot_sequence_block_dispatch( forward, len, nrot, k, C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup rot_sequence_internal
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    double const* C, int64_t ldc,
+    double const* S, int64_t lds,
+    double* A, int64_t lda )
+{
+    rot_sequence_block_dispatch( forward, len, nrot, k, C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup rot_sequence_internal
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    float const* C, int64_t ldc,
+    std::complex<float> const* S, int64_t lds,
+    std::complex<float>* A, int64_t lda )
+{
+    rot_sequence_block_dispatch( forward, len, nrot, k, C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup rot_sequence_internal
+void rot_sequence_block_simd(
+    bool forward, int64_t len, int64_t nrot, int64_t k,
+    double const* C, int64_t ldc,
+    std::complex<double> const* S, int64_t lds,
+    std::complex<double>* A, int64_t lda )
+{
+    rot_sequence_block_dispatch( forward, len, nrot, k, C, ldc, S, lds, A, lda );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sequence of rotations.
+/// @ingroup rot_sequence_internal
+///
+template <typename scalar_t>
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    real_type<scalar_t> const* C, int64_t ldc,
+    scalar_t const* S, int64_t lds,
+    scalar_t*       A, int64_t lda )
+{
+    // check arguments
+    blas_error_if( layout != Layout::ColMajor &&
+                   layout != Layout::RowMajor );
+    blas_error_if( side != Side::Left &&
+                   side != Side::Right );
+    blas_error_if( direction != Direction::Forward &&
+                   direction != Direction::Backward );
+    blas_error_if( m < 0 );
+    blas_error_if( n < 0 );
+    blas_error_if( k < 0 );
+
+    int64_t nrot = (side == Side::Left ? m : n) - 1;
+    blas_error_if( ldc < max( 1, nrot ) );
+    blas_error_if( lds < max( 1, nrot ) );
+    if (layout == Layout::ColMajor)
+        blas_error_if( lda < max( 1, m ) );
+    else
+        blas_error_if( lda < max( 1, n ) );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::rot_sequence_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { side, m, n, k };
+        counter::insert( element, counter::Id::rot_sequence );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::rot_sequence( side, m, n, k );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::rot_sequence< scalar_t >( layout, side, direction, m, n, k,
+                                    C, ldc, S, lds, A, lda );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup rot_sequence
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    float const* C, int64_t ldc,
+    float const* S, int64_t lds,
+    float*       A, int64_t lda )
+{
+    impl::rot_sequence( layout, side, direction, m, n, k,
+                        C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup rot_sequence
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    double const* C, int64_t ldc,
+    double const* S, int64_t lds,
+    double*       A, int64_t lda )
+{
+    impl::rot_sequence( layout, side, direction, m, n, k,
+                        C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup rot_sequence
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    float const* C, int64_t ldc,
+    std::complex<float> const* S, int64_t lds,
+    std::complex<float>*       A, int64_t lda )
+{
+    impl::rot_sequence( layout, side, direction, m, n, k,
+                        C, ldc, S, lds, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup rot_sequence
+void rot_sequence(
+    blas::Layout layout,
+    blas::Side side,
+    blas::Direction direction,
+    int64_t m, int64_t n, int64_t k,
+    double const* C, int64_t ldc,
+    std::complex<double> const* S, int64_t lds,
+    std::complex<double>*       A, int64_t lda )
+{
+    impl::rot_sequence( layout, side, direction, m, n, k,
+                        C, ldc, S, lds, A, lda );
+}
+
+}  // namespace blas
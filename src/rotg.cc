@@ -6,6 +6,7 @@
 #include "blas/fortran.h"
 #include "blas.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -34,7 +35,11 @@ void rotg(
         // need to call counter::inc_flop_count()
     #endif
 
-    BLAS_srotg( a, b, c, s );
+    #ifdef BLAS_USE_CBLAS
+        cblas_srotg( a, b, c, s );
+    #else
+        BLAS_srotg( a, b, c, s );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -56,7 +61,11 @@ void rotg(
         // need to call counter::inc_flop_count()
     #endif
 
-    BLAS_drotg( a, b, c, s );
+    #ifdef BLAS_USE_CBLAS
+        cblas_drotg( a, b, c, s );
+    #else
+        BLAS_drotg( a, b, c, s );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -30,6 +31,19 @@ void rotm(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rotm( ib,
+                  internal::vector_block( x, n, incx, i, ib ), incx,
+                  internal::vector_block( y, n, incy, i, ib ), incy,
+                  param );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rotm_type element;
@@ -45,7 +59,11 @@ void rotm(
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
-    BLAS_srotm( &n_, x, &incx_, y, &incy_, param );
+    #ifdef BLAS_USE_CBLAS
+        cblas_srotm( n_, x, incx_, y, incy_, param );
+    #else
+        BLAS_srotm( &n_, x, &incx_, y, &incy_, param );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -61,6 +79,19 @@ void rotm(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            rotm( ib,
+                  internal::vector_block( x, n, incx, i, ib ), incx,
+                  internal::vector_block( y, n, incy, i, ib ), incy,
+                  param );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::rotm_type element;
@@ -76,7 +107,11 @@ void rotm(
     blas_int n_    = to_blas_int( n );
     blas_int incx_ = to_blas_int( incx );
     blas_int incy_ = to_blas_int( incy );
-    BLAS_drotm( &n_, x, &incx_, y, &incy_, param );
+    #ifdef BLAS_USE_CBLAS
+        cblas_drotm( n_, x, incx_, y, incy_, param );
+    #else
+        BLAS_drotm( &n_, x, &incx_, y, &incy_, param );
+    #endif
 }
 
 }  // namespace blas
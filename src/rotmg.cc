@@ -6,6 +6,7 @@
 #include "blas/fortran.h"
 #include "blas.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -36,7 +37,11 @@ void rotmg(
         // need to call counter::inc_flop_count()
     #endif
 
-    BLAS_srotmg( d1, d2, a, &b, param );
+    #ifdef BLAS_USE_CBLAS
+        cblas_srotmg( d1, d2, a, b, param );
+    #else
+        BLAS_srotmg( d1, d2, a, &b, param );
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -59,7 +64,11 @@ void rotmg(
         // need to call counter::inc_flop_count()
     #endif
 
-    BLAS_drotmg( d1, d2, a, &b, param );
+    #ifdef BLAS_USE_CBLAS
+        cblas_drotmg( d1, d2, a, b, param );
+    #else
+        BLAS_drotmg( d1, d2, a, &b, param );
+    #endif
 }
 
 }  // namespace blas
@@ -7,6 +7,8 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "simd.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -24,7 +26,11 @@ inline void scal(
     float alpha,
     float* x, blas_int incx )
 {
-    BLAS_sscal( &n, &alpha, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        cblas_sscal( n, alpha, x, incx );
+    #else
+        BLAS_sscal( &n, &alpha, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -35,7 +41,11 @@ inline void scal(
     double alpha,
     double* x, blas_int incx )
 {
-    BLAS_dscal( &n, &alpha, x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dscal( n, alpha, x, incx );
+    #else
+        BLAS_dscal( &n, &alpha, x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,9 +56,13 @@ inline void scal(
     std::complex<float> alpha,
     std::complex<float>* x, blas_int incx )
 {
-    BLAS_cscal( &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cscal( n, &alpha, x, incx );
+    #else
+        BLAS_cscal( &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) x, &incx );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -59,9 +73,31 @@ inline void scal(
     std::complex<double> alpha,
     std::complex<double>* x, blas_int incx )
 {
-    BLAS_zscal( &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) x, &incx );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zscal( n, &alpha, x, incx );
+    #else
+        BLAS_zscal( &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) x, &incx );
+    #endif
+}
+
+BLAS_SIMD_KERNEL( scal_kernel, scal_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float16 version.
+/// @ingroup scal_internal
+void scal_kernel_simd( int64_t n, float16 alpha, float16* x )
+{
+    scal_kernel_dispatch( n, alpha, x );
+}
+
+//------------------------------------------------------------------------------
+/// bfloat16 version.
+/// @ingroup scal_internal
+void scal_kernel_simd( int64_t n, bfloat16 alpha, bfloat16* x )
+{
+    scal_kernel_dispatch( n, alpha, x );
 }
 
 }  // namespace internal
@@ -84,6 +120,16 @@ void scal(
     blas_error_if( n < 0 );      // standard BLAS returns, doesn't fail
     blas_error_if( incx <= 0 );  // standard BLAS returns, doesn't fail
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            scal( ib, alpha, x + i*incx, incx );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::scal_type element;
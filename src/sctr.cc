@@ -0,0 +1,142 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+#include "simd.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace internal {
+
+BLAS_SIMD_KERNEL( sctr_kernel, sctr_kernel_dispatch )
+
+//------------------------------------------------------------------------------
+/// float version.
+/// @ingroup sctr_internal
+void sctr_kernel_simd(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float* y )
+{
+    sctr_kernel_dispatch( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// double version.
+/// @ingroup sctr_internal
+void sctr_kernel_simd(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double* y )
+{
+    sctr_kernel_dispatch( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<float> version.
+/// @ingroup sctr_internal
+void sctr_kernel_simd(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y )
+{
+    sctr_kernel_dispatch( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// complex<double> version.
+/// @ingroup sctr_internal
+void sctr_kernel_simd(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y )
+{
+    sctr_kernel_dispatch( nz, x, indx, y );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no sparse routines.
+/// @ingroup sctr_internal
+///
+template <typename scalar_t>
+void sctr(
+    int64_t nz,
+    scalar_t const* x, int64_t const* indx,
+    scalar_t* y )
+{
+    // check arguments
+    blas_error_if( nz < 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::sctr_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { nz };
+        counter::insert( element, counter::Id::sctr );
+    #endif
+
+    blas::sctr< scalar_t, scalar_t >( nz, x, indx, y );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup sctr
+void sctr(
+    int64_t nz,
+    float const* x, int64_t const* indx,
+    float* y )
+{
+    impl::sctr( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup sctr
+void sctr(
+    int64_t nz,
+    double const* x, int64_t const* indx,
+    double* y )
+{
+    impl::sctr( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup sctr
+void sctr(
+    int64_t nz,
+    std::complex<float> const* x, int64_t const* indx,
+    std::complex<float>* y )
+{
+    impl::sctr( nz, x, indx, y );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup sctr
+void sctr(
+    int64_t nz,
+    std::complex<double> const* x, int64_t const* indx,
+    std::complex<double>* y )
+{
+    impl::sctr( nz, x, indx, y );
+}
+
+}  // namespace blas
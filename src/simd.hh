@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SIMD_HH
+#define BLAS_SIMD_HH
+
+#include "blas/parallel.hh"
+
+// Runtime selection among variants of the inline kernels, each compiled
+// for one instruction set with a target attribute, so a portable build
+// of the library still uses wide vectors on newer CPUs. See set_simd_isa.
+//
+// On x86-64, the generic variant is the baseline, SSE2 (or whatever -march
+// the library is built with). On aarch64, NEON is the baseline, so the
+// generic variant already uses it.
+#if (defined(__x86_64__) || defined(_M_X64)) \
+    && (defined(__GNUC__) || defined(__clang__))
+    #define BLAS_SIMD_X86
+
+    // flatten inlines the kernel, and everything it calls, into the
+    // variant, so all of it is compiled for the target.
+    #define BLAS_TARGET_AVX2 \
+        __attribute__((target( "avx2,fma" ), flatten))
+    #define BLAS_TARGET_AVX512 \
+        __attribute__((target( "avx512f,avx512vl,avx512bw,avx512dq,avx2,fma" ), \
+                       flatten))
+#endif
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Instruction sets with kernel variants, in increasing order.
+/// @ingroup simd_internal
+enum class SimdIsa {
+    Generic = 0,
+    AVX2,
+    AVX512,
+};
+
+//------------------------------------------------------------------------------
+/// @return instruction set of the kernel variants to call, as detected
+/// at startup or set by set_simd_isa.
+/// @ingroup simd_internal
+SimdIsa simd_isa();
+
+}  // namespace internal
+}  // namespace blas
+
+//------------------------------------------------------------------------------
+/// Defines kernel_avx2 and kernel_avx512, copies of the inline kernel
+/// compiled for AVX2 and AVX-512, and dispatch( args... ), which calls
+/// the variant for simd_isa(). Without x86 variants, dispatch calls kernel.
+/// Use inside namespace blas::internal.
+/// @ingroup simd_internal
+#ifdef BLAS_SIMD_X86
+    #define BLAS_SIMD_KERNEL( kernel, dispatch ) \
+        template <typename... Args> \
+        BLAS_TARGET_AVX512 auto kernel##_avx512( Args... args ) \
+        { \
+            return kernel( args... ); \
+        } \
+        \
+        template <typename... Args> \
+        BLAS_TARGET_AVX2 auto kernel##_avx2( Args... args ) \
+        { \
+            return kernel( args... ); \
+        } \
+        \
+        template <typename... Args> \
+        inline auto dispatch( Args... args ) \
+        { \
+            switch (simd_isa()) { \
+                case SimdIsa::AVX512: return kernel##_avx512( args... ); \
+                case SimdIsa::AVX2:   return kernel##_avx2( args... ); \
+                default:              return kernel( args... ); \
+            } \
+        }
+#else
+    #define BLAS_SIMD_KERNEL( kernel, dispatch ) \
+        template <typename... Args> \
+        inline auto dispatch( Args... args ) \
+        { \
+            return kernel( args... ); \
+        }
+#endif
+
+#endif        //  #ifndef BLAS_SIMD_HH
@@ -0,0 +1,309 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef BLAS_SMALL_HH
+#define BLAS_SMALL_HH
+
+#include "blas/util.hh"
+#include "blas/parallel.hh"
+#include "blas/nrm2.hh"
+#include "simd.hh"
+
+#include <cmath>
+#include <limits>
+
+// Inline kernels for tiny problems, see set_small_threshold.
+// For a few dozen flops, calling the vendor BLAS through the Fortran
+// interface, passing every argument by pointer, costs more than the
+// arithmetic, so these simple loops, which the compiler vectorizes,
+// are faster. Arguments are assumed to be already checked.
+
+namespace blas {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return true if gemm with all of m, n, k <= the small threshold
+/// should use small_gemm.
+/// @ingroup small_internal
+inline bool use_small_gemm( int64_t m, int64_t n, int64_t k )
+{
+    int64_t t = get_small_threshold();
+    return m <= t && n <= t && k <= t;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if gemv with both m, n <= the small threshold
+/// should use small_gemv.
+/// @ingroup small_internal
+inline bool use_small_gemv( int64_t m, int64_t n )
+{
+    int64_t t = get_small_threshold();
+    return m <= t && n <= t;
+}
+
+//------------------------------------------------------------------------------
+/// @return maximum length n for a Level 1 routine to use the small kernel.
+/// Level 1 routines do O(n) work, like one column of gemv, so the
+/// threshold is scaled to the threshold^2 elements of a small gemv.
+/// Batch routines read this once, rather than per vector.
+/// @ingroup small_internal
+inline int64_t small_level1_max()
+{
+    int64_t t = get_small_threshold();
+    return t*t;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if a Level 1 routine of length n should use the small kernel.
+/// @ingroup small_internal
+inline bool use_small_level1( int64_t n )
+{
+    return n <= small_level1_max();
+}
+
+//------------------------------------------------------------------------------
+/// Small gemm: C = alpha op(A) op(B) + beta C, for column-major matrices.
+/// If beta is zero, C need not be set on input.
+/// @ingroup small_internal
+template <typename scalar_t>
+void small_gemm(
+    blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t beta,
+    scalar_t*       C, int64_t ldc )
+{
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Cj = &C[ j*ldc ];
+
+        // C(:, j) = beta C(:, j)
+        if (beta == zero) {
+            for (int64_t i = 0; i < m; ++i)
+                Cj[ i ] = zero;
+        }
+        else if (beta != one) {
+            #pragma omp simd
+            for (int64_t i = 0; i < m; ++i)
+                Cj[ i ] *= beta;
+        }
+        if (alpha == zero)
+            continue;
+
+        // op(B)(l, j)
+        auto Blj = [&]( int64_t l ) {
+            if (transB == Op::NoTrans)
+                return B[ l + j*ldb ];
+            else if (transB == Op::Trans)
+                return B[ j + l*ldb ];
+            else
+                return conj( B[ j + l*ldb ] );
+        };
+
+        if (transA == Op::NoTrans) {
+            // C(:, j) += A(:, l) alpha op(B)(l, j), vectorized over i
+            for (int64_t l = 0; l < k; ++l) {
+                scalar_t b = alpha * Blj( l );
+                scalar_t const* Al = &A[ l*lda ];
+                #pragma omp simd
+                for (int64_t i = 0; i < m; ++i)
+                    Cj[ i ] += Al[ i ] * b;
+            }
+        }
+        else {
+            // C(i, j) += alpha op(A)(i, :) op(B)(:, j), as dot products
+            bool doconj = (transA == Op::ConjTrans);
+            for (int64_t i = 0; i < m; ++i) {
+                scalar_t const* Ai = &A[ i*lda ];
+                scalar_t sum = zero;
+                for (int64_t l = 0; l < k; ++l)
+                    sum += (doconj ? conj( Ai[ l ] ) : Ai[ l ]) * Blj( l );
+                Cj[ i ] += alpha * sum;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Small gemv: y = alpha op(A) x + beta y.
+/// If beta is zero, y need not be set on input.
+/// @ingroup small_internal
+template <typename scalar_t>
+void small_gemv(
+    blas::Layout layout,
+    blas::Op trans,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* x, int64_t incx,
+    scalar_t beta,
+    scalar_t*       y, int64_t incy )
+{
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    // A is stored column-major as mA-by-nA; RowMajor stores A^T.
+    int64_t mA = (layout == Layout::ColMajor ? m : n);
+    int64_t nA = (layout == Layout::ColMajor ? n : m);
+    int64_t lenx = (trans == Op::NoTrans ? n : m);
+    int64_t leny = (trans == Op::NoTrans ? m : n);
+    bool doconj = (trans == Op::ConjTrans);
+
+    // BLAS convention for negative increments
+    int64_t kx = (incx > 0 ? 0 : (1 - lenx)*incx);
+    int64_t ky = (incy > 0 ? 0 : (1 - leny)*incy);
+
+    // y = beta y
+    if (beta == zero) {
+        for (int64_t i = 0; i < leny; ++i)
+            y[ ky + i*incy ] = zero;
+    }
+    else if (beta != one) {
+        for (int64_t i = 0; i < leny; ++i)
+            y[ ky + i*incy ] *= beta;
+    }
+    if (alpha == zero)
+        return;
+
+    if ((trans == Op::NoTrans) == (layout == Layout::ColMajor)) {
+        // y += stored A x, as axpys with columns of stored A
+        for (int64_t j = 0; j < nA; ++j) {
+            scalar_t const* Aj = &A[ j*lda ];
+            scalar_t t = alpha * x[ kx + j*incx ];
+            if (incy == 1 && ! doconj) {
+                #pragma omp simd
+                for (int64_t i = 0; i < mA; ++i)
+                    y[ i ] += Aj[ i ] * t;
+            }
+            else {
+                for (int64_t i = 0; i < mA; ++i)
+                    y[ ky + i*incy ] += (doconj ? conj( Aj[ i ] ) : Aj[ i ]) * t;
+            }
+        }
+    }
+    else {
+        // y += stored A^T x, as dots with columns of stored A
+        for (int64_t j = 0; j < nA; ++j) {
+            scalar_t const* Aj = &A[ j*lda ];
+            scalar_t sum = zero;
+            if constexpr (! is_complex_v<scalar_t>) {
+                if (incx == 1) {
+                    #pragma omp simd reduction(+: sum)
+                    for (int64_t i = 0; i < mA; ++i)
+                        sum += Aj[ i ] * x[ i ];
+                    y[ ky + j*incy ] += alpha * sum;
+                    continue;
+                }
+            }
+            for (int64_t i = 0; i < mA; ++i)
+                sum += (doconj ? conj( Aj[ i ] ) : Aj[ i ]) * x[ kx + i*incx ];
+            y[ ky + j*incy ] += alpha * sum;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Small axpy: y = alpha x + y.
+/// @ingroup small_internal
+template <typename scalar_t>
+void small_axpy(
+    int64_t n,
+    scalar_t alpha,
+    scalar_t const* x, int64_t incx,
+    scalar_t*       y, int64_t incy )
+{
+    if (alpha == scalar_t( 0 ))
+        return;
+
+    if (incx == 1 && incy == 1) {
+        #pragma omp simd
+        for (int64_t i = 0; i < n; ++i)
+            y[ i ] += alpha * x[ i ];
+    }
+    else {
+        int64_t ix = (incx > 0 ? 0 : (1 - n)*incx);
+        int64_t iy = (incy > 0 ? 0 : (1 - n)*incy);
+        for (int64_t i = 0; i < n; ++i)
+            y[ iy + i*incy ] += alpha * x[ ix + i*incx ];
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Small dot: @return x^H y if conjugate, else x^T y.
+/// @ingroup small_internal
+template <typename scalar_t>
+scalar_t small_dot(
+    bool conjugate,
+    int64_t n,
+    scalar_t const* x, int64_t incx,
+    scalar_t const* y, int64_t incy )
+{
+    scalar_t sum = 0;
+    if constexpr (! is_complex_v<scalar_t>) {
+        if (incx == 1 && incy == 1) {
+            #pragma omp simd reduction(+: sum)
+            for (int64_t i = 0; i < n; ++i)
+                sum += x[ i ] * y[ i ];
+            return sum;
+        }
+    }
+    int64_t ix = (incx > 0 ? 0 : (1 - n)*incx);
+    int64_t iy = (incy > 0 ? 0 : (1 - n)*incy);
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t xi = x[ ix + i*incx ];
+        sum += (conjugate ? conj( xi ) : xi) * y[ iy + i*incy ];
+    }
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+/// Small nrm2: @return ||x||_2, for incx > 0.
+/// Sums squares without scaling; if the sum underflows or overflows,
+/// recomputes with the scaled generic nrm2.
+/// @ingroup small_internal
+template <typename scalar_t>
+real_type<scalar_t> small_nrm2(
+    int64_t n,
+    scalar_t const* x, int64_t incx )
+{
+    using real_t = real_type<scalar_t>;
+
+    real_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t xi = x[ i*incx ];
+        if constexpr (is_complex_v<scalar_t>)
+            sum += real( xi )*real( xi ) + imag( xi )*imag( xi );
+        else
+            sum += xi*xi;
+    }
+
+    // Squares below min lose accuracy; if the sum is below n*min/eps,
+    // that loss may exceed eps relative to the sum.
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t lo  = n * (std::numeric_limits<real_t>::min() / eps);
+    const real_t hi  = std::numeric_limits<real_t>::max();
+    if (sum >= lo && sum <= hi)
+        return std::sqrt( sum );
+    else
+        return nrm2< scalar_t >( n, x, incx );
+}
+
+//------------------------------------------------------------------------------
+// Variants of the kernels above for each instruction set, selected at
+// runtime by simd_isa(); callers use these. See simd.hh.
+BLAS_SIMD_KERNEL( small_gemm, small_gemm_simd )
+BLAS_SIMD_KERNEL( small_gemv, small_gemv_simd )
+BLAS_SIMD_KERNEL( small_axpy, small_axpy_simd )
+BLAS_SIMD_KERNEL( small_dot,  small_dot_simd  )
+BLAS_SIMD_KERNEL( small_nrm2, small_nrm2_simd )
+
+}  // namespace internal
+}  // namespace blas
+
+#endif        //  #ifndef BLAS_SMALL_HH
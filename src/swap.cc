@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -24,7 +25,11 @@ inline void swap(
     float* x, blas_int incx,
     float* y, blas_int incy )
 {
-    BLAS_sswap( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_sswap( n, x, incx, y, incy );
+    #else
+        BLAS_sswap( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -35,7 +40,11 @@ inline void swap(
     double* x, blas_int incx,
     double* y, blas_int incy )
 {
-    BLAS_dswap( &n, x, &incx, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dswap( n, x, incx, y, incy );
+    #else
+        BLAS_dswap( &n, x, &incx, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,9 +55,13 @@ inline void swap(
     std::complex<float>* x, blas_int incx,
     std::complex<float>* y, blas_int incy )
 {
-    BLAS_cswap( &n,
-                (blas_complex_float*) x, &incx,
-                (blas_complex_float*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_cswap( n, x, incx, y, incy );
+    #else
+        BLAS_cswap( &n,
+                    (blas_complex_float*) x, &incx,
+                    (blas_complex_float*) y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -59,9 +72,13 @@ inline void swap(
     std::complex<double>* x, blas_int incx,
     std::complex<double>* y, blas_int incy )
 {
-    BLAS_zswap( &n,
-                (blas_complex_double*) x, &incx,
-                (blas_complex_double*) y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zswap( n, x, incx, y, incy );
+    #else
+        BLAS_zswap( &n,
+                    (blas_complex_double*) x, &incx,
+                    (blas_complex_double*) y, &incy );
+    #endif
 }
 
 }  // namespace internal
@@ -85,6 +102,18 @@ void swap(
     blas_error_if( incx == 0 );  // standard BLAS doesn't detect inc[xy] == 0
     blas_error_if( incy == 0 );
 
+    // split n that overflows blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (n > nb) {
+        for (int64_t i = 0; i < n; i += nb) {
+            int64_t ib = min( nb, n - i );
+            swap( ib,
+                  internal::vector_block( x, n, incx, i, ib ), incx,
+                  internal::vector_block( y, n, incy, i, ib ), incy );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::swap_type element;
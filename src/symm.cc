@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -29,8 +30,13 @@ inline void symm(
     float beta,
     float*       C, blas_int ldc )
 {
-    BLAS_ssymm( &side, &uplo, &m, &n,
-                &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssymm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_ssymm( &side, &uplo, &m, &n,
+                    &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,8 +52,13 @@ inline void symm(
     double beta,
     double*       C, blas_int ldc )
 {
-    BLAS_dsymm( &side, &uplo, &m, &n,
-                &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsymm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_dsymm( &side, &uplo, &m, &n,
+                    &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -63,12 +74,17 @@ inline void symm(
     std::complex<float> beta,
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_csymm( &side, &uplo, &m, &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) A, &lda,
-                (blas_complex_float*) B, &ldb,
-                (blas_complex_float*) &beta,
-                (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_csymm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_csymm( &side, &uplo, &m, &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) A, &lda,
+                    (blas_complex_float*) B, &ldb,
+                    (blas_complex_float*) &beta,
+                    (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -84,12 +100,17 @@ inline void symm(
     std::complex<double> beta,
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zsymm( &side, &uplo, &m, &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) A, &lda,
-                (blas_complex_double*) B, &ldb,
-                (blas_complex_double*) &beta,
-                (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zsymm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ), m,
+                     n, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_zsymm( &side, &uplo, &m, &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) A, &lda,
+                    (blas_complex_double*) B, &ldb,
+                    (blas_complex_double*) &beta,
+                    (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -142,6 +163,34 @@ void symm(
         blas_error_if( ldc < n );
     }
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if ((side == Side::Left ? n : m) > nb) {
+        // A is not split; split columns of B, C if A is on the left,
+        // rows if A is on the right
+        if (side == Side::Left) {
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                symm( layout, side, uplo, m, jb,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, 0, j ), ldb,
+                      beta,
+                      internal::matrix_block( layout, C, ldc, 0, j ), ldc );
+            }
+        }
+        else {
+            for (int64_t i = 0; i < m; i += nb) {
+                int64_t ib = min( nb, m - i );
+                symm( layout, side, uplo, ib, n,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, i, 0 ), ldb,
+                      beta,
+                      internal::matrix_block( layout, C, ldc, i, 0 ), ldc );
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::symm_type element;
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -28,8 +29,13 @@ inline void symv(
     float beta,
     float*       y, blas_int incy )
 {
-    BLAS_ssymv( &uplo, &n,
-                &alpha, A, &lda, x, &incx, &beta, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssymv( CblasColMajor, cblas_uplo( uplo ), n, alpha, A, lda, x,
+                     incx, beta, y, incy );
+    #else
+        BLAS_ssymv( &uplo, &n,
+                    &alpha, A, &lda, x, &incx, &beta, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -44,8 +50,13 @@ inline void symv(
     double beta,
     double*       y, blas_int incy )
 {
-    BLAS_dsymv( &uplo, &n,
-                &alpha, A, &lda, x, &incx, &beta, y, &incy );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsymv( CblasColMajor, cblas_uplo( uplo ), n, alpha, A, lda, x,
+                     incx, beta, y, incy );
+    #else
+        BLAS_dsymv( &uplo, &n,
+                    &alpha, A, &lda, x, &incx, &beta, y, &incy );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -26,7 +27,12 @@ inline void syr(
     float const* x, blas_int incx,
     float*       A, blas_int lda )
 {
-    BLAS_ssyr( &uplo, &n, &alpha, x, &incx, A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssyr( CblasColMajor, cblas_uplo( uplo ), n, alpha, x, incx, A,
+                    lda );
+    #else
+        BLAS_ssyr( &uplo, &n, &alpha, x, &incx, A, &lda );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -39,7 +45,12 @@ inline void syr(
     double const* x, blas_int incx,
     double*       A, blas_int lda )
 {
-    BLAS_dsyr( &uplo, &n, &alpha, x, &incx, A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsyr( CblasColMajor, cblas_uplo( uplo ), n, alpha, x, incx, A,
+                    lda );
+    #else
+        BLAS_dsyr( &uplo, &n, &alpha, x, &incx, A, &lda );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -27,7 +28,12 @@ inline void syr2(
     float const* y, blas_int incy,
     float*       A, blas_int lda )
 {
-    BLAS_ssyr2( &uplo, &n, &alpha, x, &incx, y, &incy, A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssyr2( CblasColMajor, cblas_uplo( uplo ), n, alpha, x, incx, y,
+                     incy, A, lda );
+    #else
+        BLAS_ssyr2( &uplo, &n, &alpha, x, &incx, y, &incy, A, &lda );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -41,7 +47,12 @@ inline void syr2(
     double const* y, blas_int incy,
     double*       A, blas_int lda )
 {
-    BLAS_dsyr2( &uplo, &n, &alpha, x, &incx, y, &incy, A, &lda );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsyr2( CblasColMajor, cblas_uplo( uplo ), n, alpha, x, incx, y,
+                     incy, A, lda );
+    #else
+        BLAS_dsyr2( &uplo, &n, &alpha, x, &incx, y, &incy, A, &lda );
+    #endif
 }
 
 }  // namespace internal
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -29,8 +30,13 @@ inline void syr2k(
     float beta,
     float*       C, blas_int ldc )
 {
-    BLAS_ssyr2k( &uplo, &trans, &n, &k,
-                 &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssyr2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_ssyr2k( &uplo, &trans, &n, &k,
+                     &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,8 +52,13 @@ inline void syr2k(
     double beta,
     double*       C, blas_int ldc )
 {
-    BLAS_dsyr2k( &uplo, &trans, &n, &k,
-                 &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsyr2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+    #else
+        BLAS_dsyr2k( &uplo, &trans, &n, &k,
+                     &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -63,12 +74,17 @@ inline void syr2k(
     std::complex<float> beta,
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_csyr2k( &uplo, &trans, &n, &k,
-                 (blas_complex_float*) &alpha,
-                 (blas_complex_float*) A, &lda,
-                 (blas_complex_float*) B, &ldb,
-                 (blas_complex_float*) &beta,
-                 (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_csyr2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_csyr2k( &uplo, &trans, &n, &k,
+                     (blas_complex_float*) &alpha,
+                     (blas_complex_float*) A, &lda,
+                     (blas_complex_float*) B, &ldb,
+                     (blas_complex_float*) &beta,
+                     (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -84,12 +100,17 @@ inline void syr2k(
     std::complex<double> beta,
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zsyr2k( &uplo, &trans, &n, &k,
-                 (blas_complex_double*) &alpha,
-                 (blas_complex_double*) A, &lda,
-                 (blas_complex_double*) B, &ldb,
-                 (blas_complex_double*) &beta,
-                 (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zsyr2k( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ),
+                      n, k, &alpha, A, lda, B, ldb, &beta, C, ldc );
+    #else
+        BLAS_zsyr2k( &uplo, &trans, &n, &k,
+                     (blas_complex_double*) &alpha,
+                     (blas_complex_double*) A, &lda,
+                     (blas_complex_double*) B, &ldb,
+                     (blas_complex_double*) &beta,
+                     (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -143,6 +164,27 @@ void syr2k(
 
     blas_error_if( ldc < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (k > nb) {
+        // C accumulates after the first block of k
+        const scalar_t one = 1;
+        for (int64_t l = 0; l < k; l += nb) {
+            int64_t lb = min( nb, k - l );
+            scalar_t const* Al = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, A, lda, 0, l )
+                : internal::matrix_block( layout, A, lda, l, 0 ));
+            scalar_t const* Bl = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, B, ldb, 0, l )
+                : internal::matrix_block( layout, B, ldb, l, 0 ));
+            syr2k( layout, uplo, trans, n, lb,
+                   alpha, Al, lda, Bl, ldb,
+                   (l == 0 ? beta : one),
+                   C, ldc );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::syr2k_type element;
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -28,8 +29,13 @@ inline void syrk(
     float beta,
     float*       C, blas_int ldc )
 {
-    BLAS_ssyrk( &uplo, &trans, &n, &k,
-                &alpha, A, &lda, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ssyrk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, alpha, A, lda, beta, C, ldc );
+    #else
+        BLAS_ssyrk( &uplo, &trans, &n, &k,
+                    &alpha, A, &lda, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -44,8 +50,13 @@ inline void syrk(
     double beta,
     double*       C, blas_int ldc )
 {
-    BLAS_dsyrk( &uplo, &trans, &n, &k,
-                &alpha, A, &lda, &beta, C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dsyrk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, alpha, A, lda, beta, C, ldc );
+    #else
+        BLAS_dsyrk( &uplo, &trans, &n, &k,
+                    &alpha, A, &lda, &beta, C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -60,11 +71,16 @@ inline void syrk(
     std::complex<float> beta,
     std::complex<float>*       C, blas_int ldc )
 {
-    BLAS_csyrk( &uplo, &trans, &n, &k,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) A, &lda,
-                (blas_complex_float*) &beta,
-                (blas_complex_float*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_csyrk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, &alpha, A, lda, &beta, C, ldc );
+    #else
+        BLAS_csyrk( &uplo, &trans, &n, &k,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) A, &lda,
+                    (blas_complex_float*) &beta,
+                    (blas_complex_float*) C, &ldc );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -79,11 +95,16 @@ inline void syrk(
     std::complex<double> beta,
     std::complex<double>*       C, blas_int ldc )
 {
-    BLAS_zsyrk( &uplo, &trans, &n, &k,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) A, &lda,
-                (blas_complex_double*) &beta,
-                (blas_complex_double*) C, &ldc );
+    #ifdef BLAS_USE_CBLAS
+        cblas_zsyrk( CblasColMajor, cblas_uplo( uplo ), cblas_trans( trans ), n,
+                     k, &alpha, A, lda, &beta, C, ldc );
+    #else
+        BLAS_zsyrk( &uplo, &trans, &n, &k,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) A, &lda,
+                    (blas_complex_double*) &beta,
+                    (blas_complex_double*) C, &ldc );
+    #endif
 }
 
 }  // namespace internal
@@ -132,6 +153,24 @@ void syrk(
 
     blas_error_if( ldc < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if (k > nb) {
+        // C accumulates after the first block of k
+        const scalar_t one = 1;
+        for (int64_t l = 0; l < k; l += nb) {
+            int64_t lb = min( nb, k - l );
+            scalar_t const* Al = (trans == Op::NoTrans
+                ? internal::matrix_block( layout, A, lda, 0, l )
+                : internal::matrix_block( layout, A, lda, l, 0 ));
+            syrk( layout, uplo, trans, n, lb,
+                  alpha, Al, lda,
+                  (l == 0 ? beta : one),
+                  C, ldc );
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::syrk_type element;
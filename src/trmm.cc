@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -29,8 +30,14 @@ inline void trmm(
     float const* A, blas_int lda,
     float*       B, blas_int ldb )
 {
-    BLAS_strmm( &side, &uplo, &trans, &diag, &m, &n,
-                &alpha, A, &lda, B, &ldb );
+    #ifdef BLAS_USE_CBLAS
+        cblas_strmm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ),
+                     cblas_trans( trans ), cblas_diag( diag ), m, n, alpha, A,
+                     lda, B, ldb );
+    #else
+        BLAS_strmm( &side, &uplo, &trans, &diag, &m, &n,
+                    &alpha, A, &lda, B, &ldb );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -46,8 +53,14 @@ inline void trmm(
     double const* A, blas_int lda,
     double*       B, blas_int ldb )
 {
-    BLAS_dtrmm( &side, &uplo, &trans, &diag, &m, &n,
-                &alpha, A, &lda, B, &ldb );
+    #ifdef BLAS_USE_CBLAS
+        cblas_dtrmm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ),
+                     cblas_trans( trans ), cblas_diag( diag ), m, n, alpha, A,
+                     lda, B, ldb );
+    #else
+        BLAS_dtrmm( &side, &uplo, &trans, &diag, &m, &n,
+                    &alpha, A, &lda, B, &ldb );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -63,10 +76,16 @@ inline void trmm(
     std::complex<float> const* A, blas_int lda,
     std::complex<float>*       B, blas_int ldb )
 {
-    BLAS_ctrmm( &side, &uplo, &trans, &diag, &m, &n,
-                (blas_complex_float*) &alpha,
-                (blas_complex_float*) A, &lda,
-                (blas_complex_float*) B, &ldb );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ctrmm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ),
+                     cblas_trans( trans ), cblas_diag( diag ), m, n, &alpha, A,
+                     lda, B, ldb );
+    #else
+        BLAS_ctrmm( &side, &uplo, &trans, &diag, &m, &n,
+                    (blas_complex_float*) &alpha,
+                    (blas_complex_float*) A, &lda,
+                    (blas_complex_float*) B, &ldb );
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -82,10 +101,16 @@ inline void trmm(
     std::complex<double> const* A, blas_int lda,
     std::complex<double>*       B, blas_int ldb )
 {
-    BLAS_ztrmm( &side, &uplo, &trans, &diag, &m, &n,
-                (blas_complex_double*) &alpha,
-                (blas_complex_double*) A, &lda,
-                (blas_complex_double*) B, &ldb );
+    #ifdef BLAS_USE_CBLAS
+        cblas_ztrmm( CblasColMajor, cblas_side( side ), cblas_uplo( uplo ),
+                     cblas_trans( trans ), cblas_diag( diag ), m, n, &alpha, A,
+                     lda, B, ldb );
+    #else
+        BLAS_ztrmm( &side, &uplo, &trans, &diag, &m, &n,
+                    (blas_complex_double*) &alpha,
+                    (blas_complex_double*) A, &lda,
+                    (blas_complex_double*) B, &ldb );
+    #endif
 }
 
 }  // namespace internal
@@ -137,6 +162,30 @@ void trmm(
     else
         blas_error_if( ldb < n );
 
+    // split dimensions that overflow blas_int into blocks; see set_split_size
+    int64_t nb = get_split_size();
+    if ((side == Side::Left ? n : m) > nb) {
+        // A is not split; split columns of B if A is on the left,
+        // rows if A is on the right
+        if (side == Side::Left) {
+            for (int64_t j = 0; j < n; j += nb) {
+                int64_t jb = min( nb, n - j );
+                trmm( layout, side, uplo, trans, diag, m, jb,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, 0, j ), ldb );
+            }
+        }
+        else {
+            for (int64_t i = 0; i < m; i += nb) {
+                int64_t ib = min( nb, m - i );
+                trmm( layout, side, uplo, trans, diag, ib, n,
+                      alpha, A, lda,
+                      internal::matrix_block( layout, B, ldb, i, 0 ), ldb );
+            }
+        }
+        return;
+    }
+
     #ifdef BLAS_HAVE_PAPI
         // PAPI instrumentation
         counter::trmm_type element;
@@ -7,6 +7,7 @@
 #include "blas.hh"
 #include "blas_internal.hh"
 #include "blas/counter.hh"
+#include "cblas.hh"
 
 #include <limits>
 #include <string.h>
@@ -76,6 +77,78 @@ inline void trsv(
                 (blas_complex_double*) x, &incx );
 }
 
+#ifdef BLAS_USE_CBLAS
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// float version.
+/// @ingroup trsv_internal
+inline void trsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    blas_int n,
+    float const* A, blas_int lda,
+    float*       x, blas_int incx )
+{
+    cblas_strsv( cblas_layout( layout ), cblas_uplo( uplo ),
+                 cblas_trans( trans ), cblas_diag( diag ), n, A, lda, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// double version.
+/// @ingroup trsv_internal
+inline void trsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    blas_int n,
+    double const* A, blas_int lda,
+    double*       x, blas_int incx )
+{
+    cblas_dtrsv( cblas_layout( layout ), cblas_uplo( uplo ),
+                 cblas_trans( trans ), cblas_diag( diag ), n, A, lda, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<float> version.
+/// @ingroup trsv_internal
+inline void trsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    blas_int n,
+    std::complex<float> const* A, blas_int lda,
+    std::complex<float>*       x, blas_int incx )
+{
+    cblas_ctrsv( cblas_layout( layout ), cblas_uplo( uplo ),
+                 cblas_trans( trans ), cblas_diag( diag ), n, A, lda, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls CBLAS with native layout,
+/// complex<double> version.
+/// @ingroup trsv_internal
+inline void trsv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    blas::Op trans,
+    blas::Diag diag,
+    blas_int n,
+    std::complex<double> const* A, blas_int lda,
+    std::complex<double>*       x, blas_int incx )
+{
+    cblas_ztrsv( cblas_layout( layout ), cblas_uplo( uplo ),
+                 cblas_trans( trans ), cblas_diag( diag ), n, A, lda, x, incx );
+}
+
+#endif        //  #ifdef BLAS_USE_CBLAS
+
 }  // namespace internal
 
 //==============================================================================
@@ -126,15 +199,37 @@ void trsv(
     blas_int lda_  = to_blas_int( lda );
     blas_int incx_ = to_blas_int( incx );
 
-    blas::Op trans2 = trans;
-    if (layout == Layout::RowMajor) {
-        // swap lower <=> upper
-        // A => A^T; A^T => A; A^H => A
-        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
-        trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+    #ifdef BLAS_USE_CBLAS
+        // CBLAS handles RowMajor itself, without conjugated copies
+        internal::trsv( layout, uplo, trans, diag, n_, A, lda_, x, incx_ );
+    #else
+        blas::Op trans2 = trans;
+        if (layout == Layout::RowMajor) {
+            // swap lower <=> upper
+            // A => A^T; A^T => A; A^H => A
+            uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+            trans2 = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+
+            if constexpr (is_complex_v<scalar_t>) {
+                if (trans == Op::ConjTrans) {
+                    // conjugate x (in-place)
+                    int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
+                    for (int64_t i = 0; i < n; ++i) {
+                        x[ ix ] = conj( x[ ix ] );
+                        ix += incx;
+                    }
+                }
+            }
+        }
+        char uplo_  = to_char( uplo );
+        char trans_ = to_char( trans2 );
+        char diag_  = to_char( diag );
+
+        // call low-level wrapper
+        internal::trsv( uplo_, trans_, diag_, n_, A, lda_, x, incx_ );
 
         if constexpr (is_complex_v<scalar_t>) {
-            if (trans == Op::ConjTrans) {
+            if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
                 // conjugate x (in-place)
                 int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
                 for (int64_t i = 0; i < n; ++i) {
@@ -143,24 +238,7 @@ void trsv(
                 }
             }
         }
-    }
-    char uplo_  = to_char( uplo );
-    char trans_ = to_char( trans2 );
-    char diag_  = to_char( diag );
-
-    // call low-level wrapper
-    internal::trsv( uplo_, trans_, diag_, n_, A, lda_, x, incx_ );
-
-    if constexpr (is_complex_v<scalar_t>) {
-        if (layout == Layout::RowMajor && trans == Op::ConjTrans) {
-            // conjugate x (in-place)
-            int64_t ix = (incx > 0 ? 0 : (-n + 1)*incx);
-            for (int64_t i = 0; i < n; ++i) {
-                x[ ix ] = conj( x[ ix ] );
-                ix += incx;
-            }
-        }
-    }
+    #endif
 }
 
 }  // namespace impl
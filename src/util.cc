@@ -12,5 +12,6 @@ const char* Op_help     = "one of: N or NoTrans; T or Trans; C or ConjTrans";
 const char* Uplo_help   = "one of: L or Lower; U or Upper";
 const char* Diag_help   = "one of: N or NonUnit; U or Unit";
 const char* Side_help   = "one of: L or Left; R or Right";
+const char* Direction_help = "one of: F or Forward; B or Backward";
 
 }  // namespace blas
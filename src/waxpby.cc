@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "blas.hh"
+#include "blas/counter.hh"
+
+#include <string.h>
+
+namespace blas {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then calls the
+/// generic template, as BLAS has no waxpby.
+/// @ingroup waxpby_internal
+///
+template <typename scalar_t>
+void waxpby(
+    int64_t n,
+    scalar_t alpha,
+    scalar_t const* x, int64_t incx,
+    scalar_t beta,
+    scalar_t const* y, int64_t incy,
+    scalar_t*       w, int64_t incw )
+{
+    // check arguments
+    blas_error_if( n < 0 );
+    blas_error_if( incx == 0 );
+    blas_error_if( incy == 0 );
+    blas_error_if( incw == 0 );
+
+    #ifdef BLAS_HAVE_PAPI
+        // PAPI instrumentation
+        counter::waxpby_type element;
+        memset( &element, 0, sizeof( element ) );
+        element = { n };
+        counter::insert( element, counter::Id::waxpby );
+
+        double gflops = 1e9 * blas::Gflop< scalar_t >::waxpby( n );
+        counter::inc_flop_count( (long long int)gflops );
+    #endif
+
+    blas::waxpby< scalar_t, scalar_t, scalar_t >(
+        n, alpha, x, incx, beta, y, incy, w, incw );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// High-level overloaded wrappers call mid-level templated wrapper.
+
+//------------------------------------------------------------------------------
+/// CPU, float version.
+/// @ingroup waxpby
+void waxpby(
+    int64_t n,
+    float alpha,
+    float const* x, int64_t incx,
+    float beta,
+    float const* y, int64_t incy,
+    float*       w, int64_t incw )
+{
+    impl::waxpby( n, alpha, x, incx, beta, y, incy, w, incw );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, double version.
+/// @ingroup waxpby
+void waxpby(
+    int64_t n,
+    double alpha,
+    double const* x, int64_t incx,
+    double beta,
+    double const* y, int64_t incy,
+    double*       w, int64_t incw )
+{
+    impl::waxpby( n, alpha, x, incx, beta, y, incy, w, incw );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<float> version.
+/// @ingroup waxpby
+void waxpby(
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float> const* y, int64_t incy,
+    std::complex<float>*       w, int64_t incw )
+{
+    impl::waxpby( n, alpha, x, incx, beta, y, incy, w, incw );
+}
+
+//------------------------------------------------------------------------------
+/// CPU, complex<double> version.
+/// @ingroup waxpby
+void waxpby(
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double> const* y, int64_t incy,
+    std::complex<double>*       w, int64_t incw )
+{
+    impl::waxpby( n, alpha, x, incx, beta, y, incy, w, incw );
+}
+
+}  // namespace blas
@@ -61,6 +61,7 @@ categories = [
     group_cat.add_argument( '--blas1', action='store_true', help='run Level 1 BLAS tests' ),
     group_cat.add_argument( '--blas2', action='store_true', help='run Level 2 BLAS tests' ),
     group_cat.add_argument( '--blas3', action='store_true', help='run Level 3 BLAS tests' ),
+    group_cat.add_argument( '--batch-blas1', action='store_true', help='run Level 1 Batch BLAS tests' ),
     group_cat.add_argument( '--batch-blas3', action='store_true', help='run Level 3 Batch BLAS tests' ),
 
     group_cat.add_argument( '--host', action='store_true', help='run all CPU host routines' ),
@@ -87,6 +88,7 @@ group_opt.add_argument( '--trans',  action='store', help='default=%(default)s',
 group_opt.add_argument( '--uplo',   action='store', help='default=%(default)s', default='l,u' )
 group_opt.add_argument( '--diag',   action='store', help='default=%(default)s', default='n,u' )
 group_opt.add_argument( '--side',   action='store', help='default=%(default)s', default='l,r' )
+group_opt.add_argument( '--direction', action='store', help='default=%(default)s', default='f,b' )
 group_opt.add_argument( '--alpha',  action='store', help='default=%(default)s', default='' )
 group_opt.add_argument( '--beta',   action='store', help='default=%(default)s', default='' )
 group_opt.add_argument( '--incx',   action='store', help='default=%(default)s', default='1,2,-1,-2' )
@@ -221,6 +223,18 @@ if (not opts.dim):
         mnk = mn
 # end
 
+# sizes instantiated with static extents in test_gemm_fixed.cc,
+# plus static k with dynamic m, n, and all dynamic
+mnk_fixed = dim if (opts.dim) else ' --dim 3,4,8,13,16,32 --dim 10x20x8 --dim 7x5x3'
+
+# reproducible reductions sum blocks of 4096 elements; cover several blocks
+n_repro  = dim if (opts.dim) else ' --dim 100,5000,20000'
+
+# tiny sizes around the default set_small_threshold
+n_small   = dim if (opts.dim) else ' --dim 1,2,3,4,8,16,64'
+mn_small  = dim if (opts.dim) else ' --dim 1,2,3,4,8,16 --dim 3x5 --dim 5x3'
+mnk_small = dim if (opts.dim) else ' --dim 1,2,3,4,8,16 --dim 2x3x4 --dim 4x3x2'
+
 # BLAS and LAPACK
 dtype  = ' --type '   + opts.type   if (opts.type)   else ''
 layout = ' --layout ' + opts.layout if (opts.layout) else ''
@@ -230,6 +244,7 @@ trans  = ' --trans '  + opts.trans  if (opts.trans)  else ''
 uplo   = ' --uplo '   + opts.uplo   if (opts.uplo)   else ''
 diag   = ' --diag '   + opts.diag   if (opts.diag)   else ''
 side   = ' --side '   + opts.side   if (opts.side)   else ''
+direction = ' --direction ' + opts.direction if (opts.direction) else ''
 a      = ' --alpha '  + opts.alpha  if (opts.alpha)  else ''
 ab     = a+' --beta ' + opts.beta   if (opts.beta)   else a
 incx   = ' --incx '   + opts.incx   if (opts.incx)   else ''
@@ -254,6 +269,8 @@ def filter_csv( values, csv ):
 dtype_real    = ' --type ' + filter_csv( ('s', 'd'), opts.type )
 dtype_complex = ' --type ' + filter_csv( ('c', 'z'), opts.type )
 dtype_double  = ' --type ' + filter_csv( ('d', 'z'), opts.type )
+dtype_half    = ' --type h'
+dtype_int     = ' --type i'
 
 trans_nt = ' --trans ' + filter_csv( ('n', 't'), opts.trans )
 trans_nc = ' --trans ' + filter_csv( ('n', 'c'), opts.trans )
@@ -276,11 +293,41 @@ if (opts.blas1):
     [ 'iamax', dtype      + n + incx_pos ],
     [ 'nrm2',  dtype      + n + incx_pos ],
     [ 'rot',   dtype      + n + incx + incy ],
+    [ 'rot-sequence', dtype + layout + align + side + direction + mnk ],
     [ 'rotg',  dtype ],
     [ 'rotm',  dtype_real + n + incx + incy ],
     [ 'rotmg', dtype_real ],
     [ 'scal',  dtype      + n + incx_pos ],
     [ 'swap',  dtype      + n + incx + incy ],
+    [ 'asum-generic',  dtype + n + incx_pos ],
+    [ 'axpy-generic',  dtype + n + incx + incy ],
+    [ 'copy-generic',  dtype + n + incx + incy ],
+    [ 'dot-generic',   dtype + n + incx + incy ],
+    [ 'dotu-generic',  dtype + n + incx + incy ],
+    [ 'iamax-generic', dtype + n + incx_pos ],
+    [ 'scal-generic',  dtype + n + incx_pos ],
+    [ 'blas1-half',    dtype_half + n + incx_pos + incy_pos ],
+    [ 'blas1-bf16',    dtype_half + n + incx_pos + incy_pos ],
+    [ 'dot-repro',  dtype + n_repro + incx + incy ],
+    [ 'nrm2-repro', dtype + n_repro + incx_pos ],
+    [ 'asum-repro', dtype + n_repro + incx_pos ],
+    [ 'dot2',   dtype + n + incx + incy ],
+    [ 'asum2',  dtype + n + incx_pos ],
+    [ 'axpy-small', dtype + n_small + incx + incy ],
+    [ 'dot-small',  dtype + n_small + incx + incy ],
+    [ 'dot-split',   dtype + n + incx + incy + ' --cutoff 7,64' ],
+    [ 'iamax-split', dtype + n + incx_pos + ' --cutoff 7,64' ],
+    [ 'axpby',    dtype + n + incx + incy ],
+    [ 'waxpby',   dtype + n + incx + incy ],
+    [ 'dot-axpy', dtype + n + incx + incy ],
+    [ 'mdot',     dtype + mnk + incy ],
+    [ 'maxpy',    dtype + mnk + incy ],
+    [ 'axpyi',    dtype + n ],
+    [ 'doti',     dtype + n ],
+    [ 'dotui',    dtype + n ],
+    [ 'gthr',     dtype + n ],
+    [ 'gthrz',    dtype + n ],
+    [ 'sctr',     dtype + n ],
     ]
 
 if (opts.blas1_device):
@@ -298,6 +345,13 @@ if (opts.blas1_device):
 if (opts.blas2):
     cmds += [
     [ 'gemv',  dtype      + layout + align + trans + mn + incx + incy ],
+    [ 'gemv-generic', dtype + layout + align + trans + mn + incx + incy ],
+    [ 'gemv-half', dtype_half + layout + align + trans + mn + incx + incy ],
+    [ 'gemv-bf16', dtype_half + layout + align + trans + mn + incx + incy ],
+    [ 'gemv-repro', dtype     + layout + align + trans + mn + incx + incy ],
+    [ 'gemv2',  dtype      + layout + align + trans + mn + incx + incy ],
+    [ 'gemv-small', dtype     + layout + align + trans + mn_small + incx + incy ],
+    [ 'gemv-split', dtype     + layout + align + trans + mn + incx + incy + ' --cutoff 7,64' ],
     [ 'ger',   dtype      + layout + align + mn + incx + incy ],
     [ 'geru',  dtype      + layout + align + mn + incx + incy ],
     [ 'hemv',  dtype      + layout + align + uplo + n + incx + incy ],
@@ -308,12 +362,29 @@ if (opts.blas2):
     [ 'syr2',  dtype      + layout + align + uplo + n + incx + incy ],
     [ 'trmv',  dtype      + layout + align + uplo + trans + diag + n + incx ],
     [ 'trsv',  dtype      + layout + align + uplo + trans + diag + n + incx ],
+    [ 'trmv-generic', dtype + layout + align + uplo + trans + diag + n + incx ],
+    [ 'trsv-generic', dtype + layout + align + uplo + trans + diag + n + incx ],
     ]
 
 # Level 3
 if (opts.blas3):
     cmds += [
     [ 'gemm',  dtype         + layout + align + transA + transB + mnk ],
+    [ 'gemm-generic', dtype  + layout + align + transA + transB + mnk ],
+    [ 'gemm-fixed',   dtype  + layout + align + transA + transB + mnk_fixed ],
+    [ 'gemm-half',    dtype_half + layout + align + transA + transB + mnk ],
+    [ 'gemm-bf16',    dtype_half + layout + align + transA + transB + mnk ],
+    [ 'gemm-int8',    dtype_int  + layout + align + transA + transB + mnk ],
+    [ 'gemm-quantized', dtype_int + layout + align + transA + transB + mnk ],
+    [ 'gemm-strassen',  dtype_double + layout + align + transA + transB + mnk + ' --cutoff 16,64' ],
+    [ 'gemm-3m',        dtype_complex + layout + align + transA + transB + mnk + ' --cutoff 16,64' ],
+    [ 'gemm-pack',      dtype + layout + align + transA + transB + mnk ],
+    [ 'gemm-repro',     dtype + layout + align + transA + transB + mnk ],
+    [ 'gemm-small',     dtype + layout + align + transA + transB + mnk_small ],
+    [ 'gemm-split',     dtype + layout + align + transA + transB + mnk + ' --cutoff 7,64' ],
+    [ 'gemm-epilogue',  dtype_real + layout + align + transA + transB + mnk + ' --activation n,r,c,s,t,g' ],
+    [ 'gemm-epilogue',  dtype_complex + layout + align + transA + transB + mnk ],
+    [ 'gemmt', dtype         + layout + align + uplo + transA + transB + mn ],
     [ 'hemm',  dtype         + layout + align + side + uplo + mn ],
     [ 'symm',  dtype         + layout + align + side + uplo + mn ],
     [ 'trmm',  dtype         + layout + align + side + uplo + trans + diag + mn ],
@@ -326,16 +397,39 @@ if (opts.blas3):
     [ 'her2k', dtype_complex + layout + align + uplo + trans_nc + mn ],
     [ 'syr2k', dtype_real    + layout + align + uplo + trans    + mn ],
     [ 'syr2k', dtype_complex + layout + align + uplo + trans_nt + mn ],
+    [ 'hemm-generic',  dtype         + layout + align + side + uplo + mn ],
+    [ 'symm-generic',  dtype         + layout + align + side + uplo + mn ],
+    [ 'trmm-generic',  dtype         + layout + align + side + uplo + trans + diag + mn ],
+    [ 'trsm-generic',  dtype         + layout + align + side + uplo + trans + diag + mn ],
+    [ 'herk-generic',  dtype_real    + layout + align + uplo + trans    + mn ],
+    [ 'herk-generic',  dtype_complex + layout + align + uplo + trans_nc + mn ],
+    [ 'syrk-generic',  dtype_real    + layout + align + uplo + trans    + mn ],
+    [ 'syrk-generic',  dtype_complex + layout + align + uplo + trans_nt + mn ],
+    [ 'her2k-generic', dtype_real    + layout + align + uplo + trans    + mn ],
+    [ 'her2k-generic', dtype_complex + layout + align + uplo + trans_nc + mn ],
+    [ 'syr2k-generic', dtype_real    + layout + align + uplo + trans    + mn ],
+    [ 'syr2k-generic', dtype_complex + layout + align + uplo + trans_nt + mn ],
+    ]
+
+# Batch Level 1
+if (opts.batch_blas1):
+    cmds += [
+    [ 'batch-axpy', dtype + batch + n_small + incx + incy ],
+    [ 'batch-dot',  dtype + batch + n_small + incx + incy ],
+    [ 'batch-nrm2', dtype + batch + n_small + incx_pos ],
+    [ 'batch-scal', dtype + batch + n_small + incx_pos ],
     ]
 
 # Batch Level 3
 if (opts.batch_blas3):
     cmds += [
     [ 'batch-gemm',  dtype         + batch + layout + align + transA + transB + mnk ],
+    [ 'batch-gemm-strided', dtype  + batch + layout + align + transA + transB + mnk ],
     [ 'batch-hemm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'batch-symm',  dtype         + batch + layout + align + side + uplo + mn ],
     [ 'batch-trmm',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
     [ 'batch-trsm',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-trsm-strided', dtype  + batch + layout + align + side + uplo + trans + diag + mn ],
     [ 'batch-herk',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
     [ 'batch-herk',  dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
     [ 'batch-syrk',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
@@ -344,11 +438,23 @@ if (opts.batch_blas3):
     [ 'batch-her2k', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
     [ 'batch-syr2k', dtype_real    + batch + layout + align + uplo + trans    + mn ],
     [ 'batch-syr2k', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'batch-hemm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'batch-symm-strided',  dtype         + batch + layout + align + side + uplo + mn ],
+    [ 'batch-trmm-strided',  dtype         + batch + layout + align + side + uplo + trans + diag + mn ],
+    [ 'batch-herk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-herk-strided',  dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'batch-syrk-strided',  dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-syrk-strided',  dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
+    [ 'batch-her2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-her2k-strided', dtype_complex + batch + layout + align + uplo + trans_nc + mn ],
+    [ 'batch-syr2k-strided', dtype_real    + batch + layout + align + uplo + trans    + mn ],
+    [ 'batch-syr2k-strided', dtype_complex + batch + layout + align + uplo + trans_nt + mn ],
     ]
 
 if (opts.blas3_device):
     cmds += [
     [ 'dev-gemm',  dtype         + layout + align + transA + transB + mnk ],
+    [ 'dev-gemmt', dtype         + layout + align + uplo + transA + transB + mn ],
     [ 'schur-gemm',dtype         + align + ' --dim 512x512x32:64:32' + ' --format l,t' ],
     [ 'dev-hemm',  dtype         + layout + align + side + uplo + mn ],
     [ 'dev-symm',  dtype         + layout + align + side + uplo + mn ],
@@ -42,6 +42,7 @@ using testsweeper::ansi_normal;
 
 using blas::Layout, blas::Layout_help;
 using blas::Side,   blas::Side_help;
+using blas::Direction, blas::Direction_help;
 using blas::Uplo,   blas::Uplo_help;
 using blas::Op,     blas::Op_help;
 using blas::Diag,   blas::Diag_help;
@@ -95,6 +96,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "iamax",  test_iamax,  Section::blas1   },
     { "nrm2",   test_nrm2,   Section::blas1   },
     { "rot",    test_rot,    Section::blas1   },
+    { "rot-sequence", test_rot_sequence, Section::blas1 },
     { "rotg",   test_rotg,   Section::blas1   },
     { "rotm",   test_rotm,   Section::blas1   },
     { "rotmg",  test_rotmg,  Section::blas1   },
@@ -102,8 +104,64 @@ std::vector< testsweeper::routines_t > routines = {
     { "swap",   test_swap,   Section::blas1   },
     { "",       nullptr,     Section::newline },
 
+    { "asum-generic",  test_asum_generic,  Section::blas1 },
+    { "axpy-generic",  test_axpy_generic,  Section::blas1 },
+    { "copy-generic",  test_copy_generic,  Section::blas1 },
+    { "dot-generic",   test_dot_generic,   Section::blas1 },
+    { "dotu-generic",  test_dotu_generic,  Section::blas1 },
+    { "iamax-generic", test_iamax_generic, Section::blas1 },
+    { "scal-generic",  test_scal_generic,  Section::blas1 },
+    { "blas1-half",    test_blas1_half,    Section::blas1 },
+    { "blas1-bf16",    test_blas1_bf16,    Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
+    { "dot-repro",  test_dot_repro,  Section::blas1 },
+    { "nrm2-repro", test_nrm2_repro, Section::blas1 },
+    { "asum-repro", test_asum_repro, Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
+    { "dot2",   test_dot2,   Section::blas1   },
+    { "asum2",  test_asum2,  Section::blas1   },
+    { "",       nullptr,     Section::newline },
+
+    { "axpy-small", test_axpy_small, Section::blas1 },
+    { "dot-small",  test_dot_small,  Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
+    { "dot-split",   test_dot_split,   Section::blas1 },
+    { "iamax-split", test_iamax_split, Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
+    { "axpby",    test_axpby,    Section::blas1 },
+    { "waxpby",   test_waxpby,   Section::blas1 },
+    { "dot-axpy", test_dot_axpy, Section::blas1 },
+    { "mdot",     test_mdot,     Section::blas1 },
+    { "maxpy",    test_maxpy,    Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
+    { "axpyi",  test_axpyi,  Section::blas1   },
+    { "doti",   test_doti,   Section::blas1   },
+    { "dotui",  test_dotui,  Section::blas1   },
+    { "gthr",   test_gthr,   Section::blas1   },
+    { "gthrz",  test_gthrz,  Section::blas1   },
+    { "sctr",   test_sctr,   Section::blas1   },
+    { "",       nullptr,     Section::newline },
+
+    { "batch-axpy", test_batch_axpy, Section::blas1 },
+    { "batch-dot",  test_batch_dot,  Section::blas1 },
+    { "batch-nrm2", test_batch_nrm2, Section::blas1 },
+    { "batch-scal", test_batch_scal, Section::blas1 },
+    { "",       nullptr,     Section::newline },
+
     // Level 2 BLAS
     { "gemv",   test_gemv,   Section::blas2   },
+    { "gemv-half", test_gemv_half, Section::blas2 },
+    { "gemv-bf16", test_gemv_bf16, Section::blas2 },
+    { "gemv-repro", test_gemv_repro, Section::blas2 },
+    { "gemv2",  test_gemv2,  Section::blas2   },
+    { "gemv-small", test_gemv_small, Section::blas2 },
+    { "gemv-split", test_gemv_split, Section::blas2 },
+    { "gemv-generic", test_gemv_generic, Section::blas2 },
     { "ger",    test_ger,    Section::blas2   },
     { "geru",   test_geru,   Section::blas2   },
     { "",       nullptr,     Section::newline },
@@ -120,27 +178,52 @@ std::vector< testsweeper::routines_t > routines = {
 
     { "trmv",   test_trmv,   Section::blas2   },
     { "trsv",   test_trsv,   Section::blas2   },
+    { "trmv-generic", test_trmv_generic, Section::blas2 },
+    { "trsv-generic", test_trsv_generic, Section::blas2 },
     { "",       nullptr,     Section::newline },
 
     // Level 3 BLAS
     { "gemm",   test_gemm,   Section::blas3   },
+    { "gemm-generic", test_gemm_generic, Section::blas3 },
+    { "gemm-fixed",   test_gemm_fixed,   Section::blas3 },
+    { "gemm-half",    test_gemm_half,    Section::blas3 },
+    { "gemm-bf16",    test_gemm_bf16,    Section::blas3 },
+    { "gemm-int8",    test_gemm_int8,    Section::blas3 },
+    { "gemm-quantized", test_gemm_quantized, Section::blas3 },
+    { "gemm-strassen",  test_gemm_strassen,  Section::blas3 },
+    { "gemm-3m",        test_gemm_3m,        Section::blas3 },
+    { "gemm-pack",      test_gemm_pack,      Section::blas3 },
+    { "gemm-repro",     test_gemm_repro,     Section::blas3 },
+    { "gemm-small",     test_gemm_small,     Section::blas3 },
+    { "gemm-split",     test_gemm_split,     Section::blas3 },
+    { "gemm-epilogue",  test_gemm_epilogue,  Section::blas3 },
+    { "gemmt",          test_gemmt,          Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "hemm",   test_hemm,   Section::blas3   },
     { "herk",   test_herk,   Section::blas3   },
     { "her2k",  test_her2k,  Section::blas3   },
+    { "hemm-generic",  test_hemm_generic,  Section::blas3 },
+    { "herk-generic",  test_herk_generic,  Section::blas3 },
+    { "her2k-generic", test_her2k_generic, Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "symm",   test_symm,   Section::blas3   },
     { "syrk",   test_syrk,   Section::blas3   },
     { "syr2k",  test_syr2k,  Section::blas3   },
+    { "symm-generic",  test_symm_generic,  Section::blas3 },
+    { "syrk-generic",  test_syrk_generic,  Section::blas3 },
+    { "syr2k-generic", test_syr2k_generic, Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "trmm",   test_trmm,   Section::blas3   },
     { "trsm",   test_trsm,   Section::blas3   },
+    { "trmm-generic",  test_trmm_generic,  Section::blas3 },
+    { "trsm-generic",  test_trsm_generic,  Section::blas3 },
     { "",       nullptr,     Section::newline },
 
     { "batch-gemm",   test_batch_gemm,   Section::blas3   },
+    { "batch-gemm-strided", test_batch_gemm_strided, Section::blas3 },
     { "",             nullptr,           Section::newline },
 
     { "batch-hemm",   test_batch_hemm,   Section::blas3   },
@@ -148,13 +231,25 @@ std::vector< testsweeper::routines_t > routines = {
     { "batch-her2k",  test_batch_her2k,  Section::blas3   },
     { "",             nullptr,           Section::newline },
 
+    { "batch-hemm-strided",  test_batch_hemm_strided,  Section::blas3 },
+    { "batch-herk-strided",  test_batch_herk_strided,  Section::blas3 },
+    { "batch-her2k-strided", test_batch_her2k_strided, Section::blas3 },
+    { "",             nullptr,           Section::newline },
+
     { "batch-symm",   test_batch_symm,   Section::blas3   },
     { "batch-syrk",   test_batch_syrk,   Section::blas3   },
     { "batch-syr2k",  test_batch_syr2k,  Section::blas3   },
     { "",              nullptr,          Section::newline },
 
+    { "batch-symm-strided",  test_batch_symm_strided,  Section::blas3 },
+    { "batch-syrk-strided",  test_batch_syrk_strided,  Section::blas3 },
+    { "batch-syr2k-strided", test_batch_syr2k_strided, Section::blas3 },
+    { "",              nullptr,          Section::newline },
+
     { "batch-trmm",   test_batch_trmm,   Section::blas3   },
+    { "batch-trmm-strided", test_batch_trmm_strided, Section::blas3 },
     { "batch-trsm",   test_batch_trsm,   Section::blas3   },
+    { "batch-trsm-strided", test_batch_trsm_strided, Section::blas3 },
     { "",              nullptr,          Section::newline },
 
     // Device Level 1 BLAS
@@ -169,6 +264,7 @@ std::vector< testsweeper::routines_t > routines = {
 
     // Device Level 3 BLAS
     { "dev-gemm",         test_gemm_device,         Section::device_blas3   },
+    { "dev-gemmt",        test_gemmt_device,        Section::device_blas3   },
     { "",                 nullptr,                  Section::newline },
 
     { "dev-hemm",         test_hemm_device,         Section::device_blas3   },
@@ -250,12 +346,14 @@ Params::Params():
     layout    ( "layout",     6, PT_List, Layout::ColMajor, Layout_help ),
     format    ( "format",     6, PT_List, Format::LAPACK, Format_help ),
     side      ( "side",       6, PT_List, Side::Left, Side_help ),
+    direction ( "direction",  9, PT_List, Direction::Forward, Direction_help ),
     uplo      ( "uplo",       6, PT_List, Uplo::Lower, Uplo_help ),
     trans     ( "trans",      7, PT_List, Op::NoTrans, Op_help ),
     transA    ( "transA",     7, PT_List, Op::NoTrans, Op_help ),
     transB    ( "transB",     7, PT_List, Op::NoTrans, Op_help ),
     diag      ( "diag",       7, PT_List, Diag::NonUnit, Diag_help ),
     pointer_mode( "ptr",      3, PT_List, 'h', "hd", "one of: h or host; d or device" ),
+    activation( "act",        3, PT_List, 'n', "nrcstg", "gemm_epilogue activation: n none, r ReLU, c clamp to [-1, 1], s sigmoid, t tanh, g GELU" ),
 
     //----- routine parameters, numeric
     //          name,         w, p, type,    default,  min,  max, help
@@ -267,6 +365,7 @@ Params::Params():
     align     ( "align",      0,    PT_List,       1,    1, 1024, "column alignment (sets lda, ldb, etc. to multiple of align)" ),
     batch     ( "batch",      6,    PT_List,     100,    0,  1e6, "batch size" ),
     device    ( "device",     6,    PT_List,       0,    0,  100, "device id" ),
+    cutoff    ( "cutoff",     6,    PT_List,       0,    0,  1e6, "Strassen or 3M cutoff, or split size; 0 disables" ),
 
     //----- output parameters
     // min, max are ignored
@@ -305,6 +404,7 @@ Params::Params():
 {
     // set header different than command line prefix
     pointer_mode.name("ptr", "pointer-mode");
+    activation.name("act", "activation");
 
     // mark standard set of output fields as used
     okay();
@@ -393,6 +493,7 @@ int main( int argc, char** argv )
         #ifdef BLAS_HAVE_SYCL
             printf( ", SYCL" );
         #endif
+        printf( ", SIMD %s", blas::get_simd_isa() );
         printf( "\n" );
 
         // print input so running `test [input] > out.txt` documents input
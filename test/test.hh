@@ -86,12 +86,14 @@ public:
     testsweeper::ParamEnum< blas::Layout >          layout;
     testsweeper::ParamEnum< blas::Format >          format;
     testsweeper::ParamEnum< blas::Side >            side;
+    testsweeper::ParamEnum< blas::Direction >       direction;
     testsweeper::ParamEnum< blas::Uplo >            uplo;
     testsweeper::ParamEnum< blas::Op >              trans;
     testsweeper::ParamEnum< blas::Op >              transA;
     testsweeper::ParamEnum< blas::Op >              transB;
     testsweeper::ParamEnum< blas::Diag >            diag;
     testsweeper::ParamChar                          pointer_mode;
+    testsweeper::ParamChar                          activation;
 
     //----- routine parameters, numeric
     testsweeper::ParamInt3    dim;  // m, n, k
@@ -102,6 +104,7 @@ public:
     testsweeper::ParamInt     align;
     testsweeper::ParamInt     batch;
     testsweeper::ParamInt     device;
+    testsweeper::ParamInt     cutoff;
 
     //----- output parameters
     testsweeper::ParamScientific error;
@@ -182,6 +185,46 @@ double sync_get_wtime( blas::Queue& queue )
     return testsweeper::get_wtime();
 }
 
+//------------------------------------------------------------------------------
+/// Runs routine with 3 threads and parallel threshold 0, so generic
+/// templates take their parallel branch even for small problems, with
+/// uneven parts, then restores the defaults. Returns the time.
+template <typename Routine>
+double run_threaded( Routine&& routine )
+{
+    int64_t threshold = blas::get_parallel_threshold();
+    blas::set_parallel_threshold( 0 );
+    blas::set_num_threads( 3 );
+
+    double time = testsweeper::get_wtime();
+    routine();
+    time = testsweeper::get_wtime() - time;
+
+    blas::set_num_threads( 0 );
+    blas::set_parallel_threshold( threshold );
+    return time;
+}
+
+//------------------------------------------------------------------------------
+/// Calls routine() with each instruction set the CPU supports selected
+/// for BLAS++'s own kernels (see blas::set_simd_isa), then restores the
+/// previous one.
+template <typename Routine>
+void for_each_simd_isa( Routine&& routine )
+{
+    std::string isa_save = blas::get_simd_isa();
+    for (char const* isa : { "generic", "avx2", "avx512" }) {
+        try {
+            blas::set_simd_isa( isa );
+        }
+        catch (blas::Error const&) {
+            continue;  // not supported by this CPU
+        }
+        routine();
+    }
+    blas::set_simd_isa( isa_save.c_str() );
+}
+
 //------------------------------------------------------------------------------
 // Level 1 BLAS
 void test_asum  ( Params& params, bool run );
@@ -192,15 +235,58 @@ void test_dotu  ( Params& params, bool run );
 void test_iamax ( Params& params, bool run );
 void test_nrm2  ( Params& params, bool run );
 void test_rot   ( Params& params, bool run );
+void test_rot_sequence( Params& params, bool run );
 void test_rotg  ( Params& params, bool run );
 void test_rotm  ( Params& params, bool run );
 void test_rotmg ( Params& params, bool run );
 void test_scal  ( Params& params, bool run );
 void test_swap  ( Params& params, bool run );
+void test_asum_generic ( Params& params, bool run );
+void test_axpy_generic ( Params& params, bool run );
+void test_copy_generic ( Params& params, bool run );
+void test_dot_generic  ( Params& params, bool run );
+void test_dotu_generic ( Params& params, bool run );
+void test_iamax_generic( Params& params, bool run );
+void test_scal_generic ( Params& params, bool run );
+void test_blas1_half    ( Params& params, bool run );
+void test_blas1_bf16    ( Params& params, bool run );
+
+void test_dot_repro ( Params& params, bool run );
+void test_nrm2_repro( Params& params, bool run );
+void test_asum_repro( Params& params, bool run );
+
+void test_dot2 ( Params& params, bool run );
+void test_asum2( Params& params, bool run );
+
+void test_axpy_small( Params& params, bool run );
+void test_dot_small ( Params& params, bool run );
+
+void test_dot_split  ( Params& params, bool run );
+void test_iamax_split( Params& params, bool run );
+
+void test_axpby   ( Params& params, bool run );
+void test_waxpby  ( Params& params, bool run );
+void test_dot_axpy( Params& params, bool run );
+void test_mdot    ( Params& params, bool run );
+void test_maxpy   ( Params& params, bool run );
+
+void test_axpyi( Params& params, bool run );
+void test_doti ( Params& params, bool run );
+void test_dotui( Params& params, bool run );
+void test_gthr ( Params& params, bool run );
+void test_gthrz( Params& params, bool run );
+void test_sctr ( Params& params, bool run );
 
 //------------------------------------------------------------------------------
 // Level 2 BLAS
 void test_gemv  ( Params& params, bool run );
+void test_gemv_half( Params& params, bool run );
+void test_gemv_bf16( Params& params, bool run );
+void test_gemv_repro( Params& params, bool run );
+void test_gemv2 ( Params& params, bool run );
+void test_gemv_small( Params& params, bool run );
+void test_gemv_split( Params& params, bool run );
+void test_gemv_generic( Params& params, bool run );
 void test_ger   ( Params& params, bool run );
 void test_geru  ( Params& params, bool run );
 void test_hemv  ( Params& params, bool run );
@@ -211,10 +297,26 @@ void test_syr   ( Params& params, bool run );
 void test_syr2  ( Params& params, bool run );
 void test_trmv  ( Params& params, bool run );
 void test_trsv  ( Params& params, bool run );
+void test_trmv_generic( Params& params, bool run );
+void test_trsv_generic( Params& params, bool run );
 
 //------------------------------------------------------------------------------
 // Level 3 BLAS
 void test_gemm  ( Params& params, bool run );
+void test_gemm_generic( Params& params, bool run );
+void test_gemm_fixed  ( Params& params, bool run );
+void test_gemm_half   ( Params& params, bool run );
+void test_gemm_bf16   ( Params& params, bool run );
+void test_gemm_int8   ( Params& params, bool run );
+void test_gemm_quantized( Params& params, bool run );
+void test_gemm_strassen( Params& params, bool run );
+void test_gemm_3m( Params& params, bool run );
+void test_gemm_pack( Params& params, bool run );
+void test_gemm_repro( Params& params, bool run );
+void test_gemm_small( Params& params, bool run );
+void test_gemm_split( Params& params, bool run );
+void test_gemm_epilogue( Params& params, bool run );
+void test_gemmt ( Params& params, bool run );
 void test_hemm  ( Params& params, bool run );
 void test_her2k ( Params& params, bool run );
 void test_herk  ( Params& params, bool run );
@@ -223,18 +325,42 @@ void test_syr2k ( Params& params, bool run );
 void test_syrk  ( Params& params, bool run );
 void test_trmm  ( Params& params, bool run );
 void test_trsm  ( Params& params, bool run );
+void test_hemm_generic ( Params& params, bool run );
+void test_her2k_generic( Params& params, bool run );
+void test_herk_generic ( Params& params, bool run );
+void test_symm_generic ( Params& params, bool run );
+void test_syr2k_generic( Params& params, bool run );
+void test_syrk_generic ( Params& params, bool run );
+void test_trmm_generic ( Params& params, bool run );
+void test_trsm_generic ( Params& params, bool run );
+
+//------------------------------------------------------------------------------
+// Level 1 Batch BLAS
+void test_batch_axpy  ( Params& params, bool run );
+void test_batch_dot   ( Params& params, bool run );
+void test_batch_nrm2  ( Params& params, bool run );
+void test_batch_scal  ( Params& params, bool run );
 
 //------------------------------------------------------------------------------
 // Level 3 Batch BLAS
 void test_batch_gemm  ( Params& params, bool run );
+void test_batch_gemm_strided ( Params& params, bool run );
 void test_batch_hemm  ( Params& params, bool run );
+void test_batch_hemm_strided  ( Params& params, bool run );
 void test_batch_her2k ( Params& params, bool run );
+void test_batch_her2k_strided ( Params& params, bool run );
 void test_batch_herk  ( Params& params, bool run );
+void test_batch_herk_strided  ( Params& params, bool run );
 void test_batch_symm  ( Params& params, bool run );
+void test_batch_symm_strided  ( Params& params, bool run );
 void test_batch_syr2k ( Params& params, bool run );
+void test_batch_syr2k_strided ( Params& params, bool run );
 void test_batch_syrk  ( Params& params, bool run );
+void test_batch_syrk_strided  ( Params& params, bool run );
 void test_batch_trmm  ( Params& params, bool run );
+void test_batch_trmm_strided  ( Params& params, bool run );
 void test_batch_trsm  ( Params& params, bool run );
+void test_batch_trsm_strided ( Params& params, bool run );
 
 //------------------------------------------------------------------------------
 // Level 1 GPU BLAS
@@ -249,6 +375,7 @@ void test_copy_device  ( Params& params, bool run );
 //------------------------------------------------------------------------------
 // Level 3 GPU BLAS
 void test_gemm_device  ( Params& params, bool run );
+void test_gemmt_device ( Params& params, bool run );
 void test_hemm_device  ( Params& params, bool run );
 void test_her2k_device ( Params& params, bool run );
 void test_herk_device  ( Params& params, bool run );
@@ -0,0 +1,506 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the fixed-size strided batch routines hemm, symm, herk, her2k,
+// syrk, syr2k, and trmm (time), compared to a loop over the batch calling
+// the vendor BLAS (ref_time). gemm and trsm have their own testers.
+// Item s of each operand is at offset s*stride in one array.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_batch_strided( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests hemm (if herm) or symm.
+template <typename scalar_t>
+void test_batch_hemm_strided_work( Params& params, bool run, bool herm )
+{
+    using namespace testsweeper;
+    using blas::Side;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side = params.side();
+    blas::Uplo uplo = params.uplo();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    size_t  batch   = params.batch();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t An = (side == Side::Left ? m : n);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor)
+        std::swap( Cm, Cn );
+    int64_t lda = roundup( An, align );
+    int64_t ldb = roundup( Cm, align );
+    int64_t ldc = roundup( Cm, align );
+    int64_t strideA = lda*An;
+    int64_t strideB = ldb*Cn;
+    int64_t strideC = ldc*Cn;
+    std::vector<scalar_t> A( batch*strideA ), B( batch*strideB ),
+                          C( batch*strideC ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, A.size(), A.data() );
+    lapack_larnv( idist, iseed, B.size(), B.data() );
+    lapack_larnv( idist, iseed, C.size(), C.data() );
+    Cref = C;
+
+    // norms for error check
+    real_t work[1];
+    std::vector<real_t> Anorm( batch ), Bnorm( batch ), Cnorm( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[s] = lapack_lansy( "f", to_c_string( uplo ), An,
+                                 &A[ s*strideA ], lda, work );
+        Bnorm[s] = lapack_lange( "f", Cm, Cn, &B[ s*strideB ], ldb, work );
+        Cnorm[s] = lapack_lange( "f", Cm, Cn, &C[ s*strideC ], ldc, work );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    if (herm) {
+        blas::batch::hemm( layout, side, uplo, m, n,
+                           alpha, A.data(), lda, strideA,
+                                  B.data(), ldb, strideB,
+                           beta,  C.data(), ldc, strideC, batch );
+    }
+    else {
+        blas::batch::symm( layout, side, uplo, m, n,
+                           alpha, A.data(), lda, strideA,
+                                  B.data(), ldb, strideB,
+                           beta,  C.data(), ldc, strideC, batch );
+    }
+    time = get_wtime() - time;
+
+    double gflop = batch * (herm ? blas::Gflop< scalar_t >::hemm( side, m, n )
+                                 : blas::Gflop< scalar_t >::symm( side, m, n ));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            if (herm) {
+                cblas_hemm( cblas_layout_const(layout),
+                            cblas_side_const(side),
+                            cblas_uplo_const(uplo),
+                            m, n, alpha, &A[ s*strideA ], lda,
+                            &B[ s*strideB ], ldb,
+                            beta, &Cref[ s*strideC ], ldc );
+            }
+            else {
+                cblas_symm( cblas_layout_const(layout),
+                            cblas_side_const(side),
+                            cblas_uplo_const(uplo),
+                            m, n, alpha, &A[ s*strideA ], lda,
+                            &B[ s*strideB ], ldb,
+                            beta, &Cref[ s*strideC ], ldc );
+            }
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            check_gemm( Cm, Cn, An, alpha, beta, Anorm[s], Bnorm[s], Cnorm[s],
+                        &Cref[ s*strideC ], ldc, &C[ s*strideC ], ldc,
+                        verbose, &err, &ok );
+            error = std::max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests the rank-k update herk or syrk (if ! rank2),
+// or the rank-2k update her2k or syr2k (if rank2).
+template <typename scalar_t>
+void test_batch_herk_strided_work(
+    Params& params, bool run, bool herm, bool rank2 )
+{
+    using namespace testsweeper;
+    using std::real;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    blas::Uplo uplo = params.uplo();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    size_t  batch   = params.batch();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // herk has real alpha and beta; her2k has real beta
+    if (herm) {
+        if (! rank2)
+            alpha = real( alpha );
+        beta = real( beta );
+    }
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (trans == Op::NoTrans ? n : k);
+    int64_t An = (trans == Op::NoTrans ? k : n);
+    if (layout == Layout::RowMajor)
+        std::swap( Am, An );
+    int64_t lda = roundup( Am, align );
+    int64_t ldc = roundup(  n, align );
+    int64_t strideA = lda*An;
+    int64_t strideC = ldc*n;
+    std::vector<scalar_t> A( batch*strideA ), B( rank2 ? batch*strideA : 0 ),
+                          C( batch*strideC ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, A.size(), A.data() );
+    if (rank2)
+        lapack_larnv( idist, iseed, B.size(), B.data() );
+    lapack_larnv( idist, iseed, C.size(), C.data() );
+    if (herm) {
+        // C is Hermitian, so its diagonal is real
+        for (size_t s = 0; s < batch; ++s)
+            for (int64_t i = 0; i < n; ++i)
+                C[ s*strideC + i + i*ldc ] = real( C[ s*strideC + i + i*ldc ] );
+    }
+    Cref = C;
+
+    // norms for error check
+    real_t work[1];
+    std::vector<real_t> Anorm( batch ), Bnorm( batch ), Cnorm( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[s] = lapack_lange( "f", Am, An, &A[ s*strideA ], lda, work );
+        Bnorm[s] = (rank2 ? lapack_lange( "f", Am, An, &B[ s*strideA ], lda, work )
+                          : Anorm[s]);
+        Cnorm[s] = lapack_lansy( "f", to_c_string( uplo ), n,
+                                 &C[ s*strideC ], ldc, work );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    if (herm && rank2) {
+        blas::batch::her2k( layout, uplo, trans, n, k,
+                            alpha, A.data(), lda, strideA,
+                                   B.data(), lda, strideA,
+                            real( beta ), C.data(), ldc, strideC, batch );
+    }
+    else if (herm) {
+        blas::batch::herk( layout, uplo, trans, n, k,
+                           real( alpha ), A.data(), lda, strideA,
+                           real( beta ),  C.data(), ldc, strideC, batch );
+    }
+    else if (rank2) {
+        blas::batch::syr2k( layout, uplo, trans, n, k,
+                            alpha, A.data(), lda, strideA,
+                                   B.data(), lda, strideA,
+                            beta,  C.data(), ldc, strideC, batch );
+    }
+    else {
+        blas::batch::syrk( layout, uplo, trans, n, k,
+                           alpha, A.data(), lda, strideA,
+                           beta,  C.data(), ldc, strideC, batch );
+    }
+    time = get_wtime() - time;
+
+    double gflop = batch * (rank2 ? (herm ? blas::Gflop< scalar_t >::her2k( n, k )
+                                          : blas::Gflop< scalar_t >::syr2k( n, k ))
+                                  : (herm ? blas::Gflop< scalar_t >::herk( n, k )
+                                          : blas::Gflop< scalar_t >::syrk( n, k )));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            scalar_t const* As = &A[ s*strideA ];
+            scalar_t const* Bs = (rank2 ? &B[ s*strideA ] : nullptr);
+            scalar_t* Crefs = &Cref[ s*strideC ];
+            if (herm && rank2) {
+                cblas_her2k( cblas_layout_const(layout),
+                             cblas_uplo_const(uplo),
+                             cblas_trans_const(trans),
+                             n, k, alpha, As, lda, Bs, lda,
+                             real( beta ), Crefs, ldc );
+            }
+            else if (herm) {
+                cblas_herk( cblas_layout_const(layout),
+                            cblas_uplo_const(uplo),
+                            cblas_trans_const(trans),
+                            n, k, real( alpha ), As, lda,
+                            real( beta ), Crefs, ldc );
+            }
+            else if (rank2) {
+                cblas_syr2k( cblas_layout_const(layout),
+                             cblas_uplo_const(uplo),
+                             cblas_trans_const(trans),
+                             n, k, alpha, As, lda, Bs, lda,
+                             beta, Crefs, ldc );
+            }
+            else {
+                cblas_syrk( cblas_layout_const(layout),
+                            cblas_uplo_const(uplo),
+                            cblas_trans_const(trans),
+                            n, k, alpha, As, lda,
+                            beta, Crefs, ldc );
+            }
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            check_herk( uplo, n, (rank2 ? 2*k : k), alpha, beta,
+                        Anorm[s], Bnorm[s], Cnorm[s],
+                        &Cref[ s*strideC ], ldc, &C[ s*strideC ], ldc,
+                        verbose, &err, &ok );
+            error = std::max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_batch_trmm_strided_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Side;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side = params.side();
+    blas::Uplo uplo = params.uplo();
+    blas::Op trans  = params.trans();
+    blas::Diag diag = params.diag();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    size_t  batch   = params.batch();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (side == Side::Left ? m : n);
+    int64_t Bm = m;
+    int64_t Bn = n;
+    if (layout == Layout::RowMajor)
+        std::swap( Bm, Bn );
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t strideA = lda*Am;
+    int64_t strideB = ldb*Bn;
+    std::vector<scalar_t> A( batch*strideA ), B( batch*strideB ), Bref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, A.size(), A.data() );
+    lapack_larnv( idist, iseed, B.size(), B.data() );
+    Bref = B;
+
+    // norms for error check
+    real_t work[1];
+    std::vector<real_t> Anorm( batch ), Bnorm( batch );
+    for (size_t s = 0; s < batch; ++s) {
+        Anorm[s] = lapack_lantr( "f", to_c_string( uplo ), to_c_string( diag ),
+                                 Am, Am, &A[ s*strideA ], lda, work );
+        Bnorm[s] = lapack_lange( "f", Bm, Bn, &B[ s*strideB ], ldb, work );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::batch::trmm( layout, side, uplo, trans, diag, m, n,
+                       alpha, A.data(), lda, strideA,
+                              B.data(), ldb, strideB, batch );
+    time = get_wtime() - time;
+
+    double gflop = batch * blas::Gflop< scalar_t >::trmm( side, m, n );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (size_t s = 0; s < batch; ++s) {
+            cblas_trmm( cblas_layout_const(layout),
+                        cblas_side_const(side),
+                        cblas_uplo_const(uplo),
+                        cblas_trans_const(trans),
+                        cblas_diag_const(diag),
+                        m, n, alpha, &A[ s*strideA ], lda,
+                        &Bref[ s*strideB ], ldb );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        // Am is reduction dimension
+        // beta = 0, Cnorm = 0 (initial).
+        real_t err, error = 0;
+        bool ok, okay = true;
+        for (size_t s = 0; s < batch; ++s) {
+            check_gemm( Bm, Bn, Am, alpha, scalar_t(0), Anorm[s], Bnorm[s],
+                        real_t(0), &Bref[ s*strideB ], ldb,
+                        &B[ s*strideB ], ldb, verbose, &err, &ok );
+            error = std::max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_hemm_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_hemm_strided_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_symm_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_hemm_strided_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_herk_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_herk_strided_work< decltype( x ) >(
+            params, run, true, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_her2k_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_herk_strided_work< decltype( x ) >(
+            params, run, true, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_syrk_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_herk_strided_work< decltype( x ) >(
+            params, run, false, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_syr2k_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_herk_strided_work< decltype( x ) >(
+            params, run, false, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_trmm_strided( Params& params, bool run )
+{
+    dispatch_batch_strided( params, [&]( auto x ) {
+        test_batch_trmm_strided_work< decltype( x ) >( params, run );
+    } );
+}
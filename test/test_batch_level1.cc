@@ -0,0 +1,405 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests batched Level 1 routines axpy, dot, nrm2, and scal.
+// The reference is a loop of cblas calls, one per vector, so ref time shows
+// the per-call overhead that batching avoids for short vectors.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_batch_level1( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output columns; times are in msec.
+void mark_batch_level1( Params& params )
+{
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+}
+
+// -----------------------------------------------------------------------------
+// Runs routine, setting time and gflops; or ref_time, ref_gflops if ref.
+template <typename Routine>
+void run_batch_level1( Params& params, bool ref, double gflop,
+                       Routine&& routine )
+{
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    routine();
+    time = testsweeper::get_wtime() - time;
+
+    if (ref) {
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+    }
+    else {
+        params.time()   = time * 1000;  // msec
+        params.gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Allocates batch vectors of n elements with stride inc, stored one after
+// another in data, and sets pointers to them in array.
+template <typename scalar_t>
+void batch_vectors( int64_t n, int64_t inc, size_t batch,
+                    std::vector<scalar_t>& data,
+                    std::vector<scalar_t*>& array )
+{
+    size_t size = std::max( (n - 1) * std::abs( inc ) + 1, int64_t( 1 ) );
+    data.resize( batch * size );
+    array.resize( batch );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, data.size(), data.data() );
+    for (size_t i = 0; i < batch; ++i)
+        array[ i ] = &data[ i * size ];
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_batch_axpy_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha_ = params.alpha.get<scalar_t>();
+    int64_t n_      = params.dim.n();
+    int64_t incx_   = params.incx();
+    int64_t incy_   = params.incy();
+    size_t  batch   = params.batch();
+    int64_t verbose = params.verbose();
+    mark_batch_level1( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> xdata, ydata, yrefdata;
+    std::vector<scalar_t*> x, y, yref;
+    batch_vectors( n_, incx_, batch, xdata, x );
+    batch_vectors( n_, incy_, batch, ydata, y );
+    batch_vectors( n_, incy_, batch, yrefdata, yref );
+    yrefdata = ydata;
+
+    // wrap scalar arguments in std::vector
+    std::vector<int64_t>  n( 1, n_ );
+    std::vector<int64_t>  incx( 1, incx_ );
+    std::vector<int64_t>  incy( 1, incy_ );
+    std::vector<scalar_t> alpha( 1, alpha_ );
+    std::vector<int64_t>  info( 1 );
+
+    // test error exits
+    std::vector<int64_t> n_bad( 1, -1 );
+    assert_throw( blas::batch::axpy( n_bad, alpha, x, incx, y, incy, batch, info ), blas::Error );
+
+    // run test
+    info.resize( 0 );
+    double gflop = batch * blas::Gflop< scalar_t >::axpy( n_ );
+    run_batch_level1( params, false, gflop, [&]() {
+        blas::batch::axpy( n, alpha, x, incx, y, incy, batch, info );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference
+        run_batch_level1( params, true, gflop, [&]() {
+            for (size_t i = 0; i < batch; ++i)
+                cblas_axpy( n_, alpha_, x[ i ], incx_, yref[ i ], incy_ );
+        } );
+
+        // check error compared to reference
+        real_t error = 0;
+        bool okay = true;
+        for (size_t i = 0; i < batch; ++i) {
+            real_t Xnorm = cblas_nrm2( n_, x[ i ], std::abs( incx_ ) );
+            real_t Ynorm = cblas_nrm2( n_, y[ i ], std::abs( incy_ ) );
+            real_t err;
+            bool ok;
+            check_gemm( 1, n_, 1, alpha_, scalar_t( 1 ), Xnorm, real_t( 1 ), Ynorm,
+                        yref[ i ], std::abs( incy_ ), y[ i ], std::abs( incy_ ),
+                        verbose, &err, &ok );
+            error = std::max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_batch_dot_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n_      = params.dim.n();
+    int64_t incx_   = params.incx();
+    int64_t incy_   = params.incy();
+    size_t  batch   = params.batch();
+    int64_t verbose = params.verbose();
+    mark_batch_level1( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> xdata, ydata;
+    std::vector<scalar_t*> x, y;
+    batch_vectors( n_, incx_, batch, xdata, x );
+    batch_vectors( n_, incy_, batch, ydata, y );
+    std::vector<scalar_t> result( batch ), ref( batch );
+
+    // wrap scalar arguments in std::vector
+    std::vector<int64_t> n( 1, n_ );
+    std::vector<int64_t> incx( 1, incx_ );
+    std::vector<int64_t> incy( 1, incy_ );
+    std::vector<int64_t> info( 1 );
+
+    // test error exits
+    std::vector<int64_t> inc_bad( 1, 0 );
+    assert_throw( blas::batch::dot( n, x, inc_bad, y, incy, result, batch, info ), blas::Error );
+
+    // run test
+    info.resize( 0 );
+    double gflop = batch * blas::Gflop< scalar_t >::dot( n_ );
+    run_batch_level1( params, false, gflop, [&]() {
+        blas::batch::dot( n, x, incx, y, incy, result, batch, info );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference
+        run_batch_level1( params, true, gflop, [&]() {
+            for (size_t i = 0; i < batch; ++i)
+                ref[ i ] = cblas_dot( n_, x[ i ], incx_, y[ i ], incy_ );
+        } );
+
+        // check error compared to reference
+        real_t error = 0;
+        bool okay = true;
+        for (size_t i = 0; i < batch; ++i) {
+            real_t Xnorm = cblas_nrm2( n_, x[ i ], std::abs( incx_ ) );
+            real_t Ynorm = cblas_nrm2( n_, y[ i ], std::abs( incy_ ) );
+            real_t err;
+            bool ok;
+            check_gemm( 1, 1, n_, scalar_t( 1 ), scalar_t( 0 ), Xnorm, Ynorm, real_t( 0 ),
+                        &ref[ i ], 1, &result[ i ], 1, verbose, &err, &ok );
+            error = std::max( error, err );
+            okay &= ok;
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_batch_nrm2_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n_      = params.dim.n();
+    int64_t incx_   = params.incx();
+    size_t  batch   = params.batch();
+    int64_t verbose = params.verbose();
+    mark_batch_level1( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> xdata;
+    std::vector<scalar_t*> x;
+    batch_vectors( n_, incx_, batch, xdata, x );
+    std::vector<real_t> result( batch ), ref( batch );
+
+    // wrap scalar arguments in std::vector
+    std::vector<int64_t> n( 1, n_ );
+    std::vector<int64_t> incx( 1, incx_ );
+    std::vector<int64_t> info( 1 );
+
+    // test error exits
+    std::vector<int64_t> inc_bad( 1, -1 );
+    assert_throw( blas::batch::nrm2( n, x, inc_bad, result, batch, info ), blas::Error );
+
+    // run test
+    info.resize( 0 );
+    double gflop = batch * blas::Gflop< scalar_t >::nrm2( n_ );
+    run_batch_level1( params, false, gflop, [&]() {
+        blas::batch::nrm2( n, x, incx, result, batch, info );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference
+        run_batch_level1( params, true, gflop, [&]() {
+            for (size_t i = 0; i < batch; ++i)
+                ref[ i ] = cblas_nrm2( n_, x[ i ], incx_ );
+        } );
+
+        // maximum relative forward error
+        real_t error = 0;
+        for (size_t i = 0; i < batch; ++i) {
+            if (ref[ i ] != 0)
+                error = std::max( error, std::abs( (ref[ i ] - result[ i ])
+                                                   / (std::sqrt( real_t( n_ + 1 ) ) * ref[ i ]) ) );
+            else
+                error = std::max( error, std::abs( result[ i ] ) );
+        }
+
+        // complex needs extra factor; see Higham, 2002, sec. 3.6.
+        if (blas::is_complex_v<scalar_t>) {
+            error /= 2*sqrt(2);
+        }
+
+        real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
+        params.error() = error;
+        params.okay() = (error < u);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_batch_scal_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha_ = params.alpha.get<scalar_t>();
+    int64_t n_      = params.dim.n();
+    int64_t incx_   = params.incx();
+    size_t  batch   = params.batch();
+    int64_t verbose = params.verbose();
+    mark_batch_level1( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> xdata, xrefdata;
+    std::vector<scalar_t*> x, xref;
+    batch_vectors( n_, incx_, batch, xdata, x );
+    batch_vectors( n_, incx_, batch, xrefdata, xref );
+    xrefdata = xdata;
+
+    // wrap scalar arguments in std::vector
+    std::vector<int64_t>  n( 1, n_ );
+    std::vector<int64_t>  incx( 1, incx_ );
+    std::vector<scalar_t> alpha( 1, alpha_ );
+    std::vector<int64_t>  info( 1 );
+
+    // test error exits
+    std::vector<int64_t> n_bad( 1, -1 );
+    assert_throw( blas::batch::scal( n_bad, alpha, x, incx, batch, info ), blas::Error );
+
+    // run test
+    info.resize( 0 );
+    double gflop = batch * blas::Gflop< scalar_t >::scal( n_ );
+    run_batch_level1( params, false, gflop, [&]() {
+        blas::batch::scal( n, alpha, x, incx, batch, info );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference
+        run_batch_level1( params, true, gflop, [&]() {
+            for (size_t i = 0; i < batch; ++i)
+                cblas_scal( n_, alpha_, xref[ i ], incx_ );
+        } );
+
+        // maximum component-wise forward error:
+        // | fl(xi) - xi | / | xi |
+        real_t error = 0;
+        for (size_t i = 0; i < xdata.size(); ++i) {
+            if (xrefdata[ i ] != scalar_t( 0 ))
+                error = std::max( error, std::abs( (xrefdata[ i ] - xdata[ i ])
+                                                   / xrefdata[ i ] ) );
+        }
+
+        // complex needs extra factor; see Higham, 2002, sec. 3.6.
+        if (blas::is_complex_v<scalar_t>) {
+            error /= 2*sqrt(2);
+        }
+
+        real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
+        params.error() = error;
+        params.okay() = (error < u);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_axpy( Params& params, bool run )
+{
+    dispatch_batch_level1( params, [&]( auto x ) {
+        test_batch_axpy_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_dot( Params& params, bool run )
+{
+    dispatch_batch_level1( params, [&]( auto x ) {
+        test_batch_dot_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_nrm2( Params& params, bool run )
+{
+    dispatch_batch_level1( params, [&]( auto x ) {
+        test_batch_nrm2_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_batch_scal( Params& params, bool run )
+{
+    dispatch_batch_level1( params, [&]( auto x ) {
+        test_batch_scal_work< decltype( x ) >( params, run );
+    } );
+}
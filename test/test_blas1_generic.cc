@@ -0,0 +1,372 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the threaded generic Level 1 templates: axpy, scal, copy, dot,
+// dotu, asum, and iamax. Explicit template arguments force the generic
+// template, rather than the vendor BLAS overloads, and run_threaded
+// makes even short vectors take the parallel branch (time),
+// compared to the vendor BLAS (ref_time). Times are in msec.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_blas1_generic( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output columns; times are in msec.
+void mark_blas1_generic( Params& params )
+{
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+}
+
+// -----------------------------------------------------------------------------
+// Tests the vector updates axpy (routine 'a'), scal ('s'), or copy ('c').
+template <typename scalar_t>
+void test_axpy_generic_work( Params& params, bool run, char routine )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+    mark_blas1_generic( params );
+
+    if (! run)
+        return;
+
+    // setup; scal updates x, so it is compared as y
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    if (routine == 's') {
+        y = x;
+        incy = incx;
+    }
+    yref = y;
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        if (routine == 'a')
+            blas::axpy<scalar_t, scalar_t>( n, alpha, x.data(), incx, y.data(), incy );
+        else if (routine == 's')
+            blas::scal<scalar_t>( n, alpha, y.data(), incy );
+        else
+            blas::copy<scalar_t, scalar_t>( n, x.data(), incx, y.data(), incy );
+    } );
+
+    double gflop = (routine == 'a' ? blas::Gflop< scalar_t >::axpy( n )
+                  : routine == 's' ? blas::Gflop< scalar_t >::scal( n )
+                  :                  blas::Gflop< scalar_t >::copy( n ));
+    double gbyte = (routine == 'a' ? blas::Gbyte< scalar_t >::axpy( n )
+                  : routine == 's' ? blas::Gbyte< scalar_t >::scal( n )
+                  :                  blas::Gbyte< scalar_t >::copy( n ));
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        if (routine == 'a')
+            cblas_axpy( n, alpha, x.data(), incx, yref.data(), incy );
+        else if (routine == 's')
+            cblas_scal( n, alpha, yref.data(), incy );
+        else
+            cblas_copy( n, x.data(), incx, yref.data(), incy );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // check error compared to reference
+        // treat y as 1 x n matrix with ld = incy; k = 1 is reduction dimension
+        real_t error;
+        bool okay;
+        if (routine == 'a') {
+            check_gemm( 1, n, 1, alpha, scalar_t(1), Xnorm, real_t(1), Ynorm,
+                        yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                        verbose, &error, &okay );
+        }
+        else if (routine == 's') {
+            check_gemm( 1, n, 1, alpha, scalar_t(0), Ynorm, real_t(1), real_t(0),
+                        yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                        verbose, &error, &okay );
+        }
+        else {
+            // copy is exact
+            error = 0;
+            for (size_t i = 0; i < size_y; ++i)
+                error = std::max( error, real_t( std::abs( y[ i ] - yref[ i ] ) ) );
+            okay = (error == 0);
+        }
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests dot (if conj) or dotu.
+template <typename scalar_t>
+void test_dot_generic_work( Params& params, bool run, bool conj )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+    mark_blas1_generic( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run test
+    scalar_t result = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        result = (conj
+                  ? blas::dot<scalar_t, scalar_t>( n, x.data(), incx, y.data(), incy )
+                  : blas::dotu<scalar_t, scalar_t>( n, x.data(), incx, y.data(), incy ));
+    } );
+
+    double gflop = blas::Gflop< scalar_t >::dot( n );
+    double gbyte = blas::Gbyte< scalar_t >::dot( n );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        scalar_t ref = (conj ? cblas_dot ( n, x.data(), incx, y.data(), incy )
+                             : cblas_dotu( n, x.data(), incx, y.data(), incy ));
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // check error compared to reference
+        // treat result as 1 x 1 matrix; k = n is reduction dimension
+        real_t error;
+        bool okay;
+        check_gemm( 1, 1, n, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                    &ref, 1, &result, 1, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests asum (if ! is_iamax) or iamax.
+template <typename scalar_t>
+void test_asum_generic_work( Params& params, bool run, bool is_iamax )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    mark_blas1_generic( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    std::vector<scalar_t> x( size_x );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+
+    // run test
+    real_t  result = 0;
+    int64_t index  = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        if (is_iamax)
+            index = blas::iamax<scalar_t>( n, x.data(), incx );
+        else
+            result = blas::asum<scalar_t>( n, x.data(), incx );
+    } );
+
+    double gflop = (is_iamax ? blas::Gflop< scalar_t >::iamax( n )
+                             : blas::Gflop< scalar_t >::asum( n ));
+    double gbyte = (is_iamax ? blas::Gbyte< scalar_t >::iamax( n )
+                             : blas::Gbyte< scalar_t >::asum( n ));
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.check() == 'y') {
+        // run reference. For asum, sum in double rather than calling
+        // cblas_asum, as in test_reproducible.
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        int64_t index_ref = 0;
+        real_t ref = 0;
+        if (is_iamax) {
+            index_ref = cblas_iamax( n, x.data(), incx );
+        }
+        else {
+            double sum = 0;
+            for (int64_t i = 0; i < n; ++i) {
+                sum += std::abs( double( std::real( x[ i*incx ] ) ) )
+                    +  std::abs( double( std::imag( x[ i*incx ] ) ) );
+            }
+            ref = real_t( sum );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (is_iamax) {
+            // error = |ref - result|
+            params.error() = std::abs( index_ref - index );
+            params.okay() = (index_ref == index);
+        }
+        else {
+            // relative forward error
+            real_t error = std::abs( (ref - result) / (n * ref) );
+            if (blas::is_complex_v< scalar_t >)
+                error /= 2*sqrt(2);
+            real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
+            params.error() = error;
+            params.okay() = (error < u);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_axpy_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_axpy_generic_work< decltype( x ) >( params, run, 'a' );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_scal_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_axpy_generic_work< decltype( x ) >( params, run, 's' );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_copy_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_axpy_generic_work< decltype( x ) >( params, run, 'c' );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dot_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_dot_generic_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dotu_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_dot_generic_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_asum_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_asum_generic_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_iamax_generic( Params& params, bool run )
+{
+    dispatch_blas1_generic( params, [&]( auto x ) {
+        test_asum_generic_work< decltype( x ) >( params, run, true );
+    } );
+}
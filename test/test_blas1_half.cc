@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the generic Level 1 templates axpy, scal, copy, dot, asum, and iamax
+// with vectors stored in a 16-bit type T16 (float16 or bfloat16) and float
+// arithmetic, compared to the float BLAS on the same values in float.
+// For these types, the unit-stride loops are library kernels dispatched by
+// instruction set, so each routine is rerun for every instruction set the
+// CPU supports (see for_each_simd_isa); error is the largest of them.
+// error is relative to T16's unit roundoff for axpy and scal, which round
+// to T16, and to float's for dot and asum; copy and iamax are exact.
+template <typename T16>
+void test_blas1_half_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = float;
+
+    // get & mark input values
+    real_t alpha    = params.alpha.get<real_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.time.name( "time (ms)" );
+
+    if (! run)
+        return;
+
+    if (incx <= 0 || incy <= 0) {
+        params.msg() = "skipping: requires incx, incy > 0";
+        return;
+    }
+
+    // setup
+    size_t size_x = (n - 1) * incx + 1;
+    size_t size_y = (n - 1) * incy + 1;
+    std::vector<T16> x( size_x ), y( size_y ), x16( size_x ), y16( size_y );
+    std::vector<real_t> xref( size_x ), yref( size_y ),
+                        xout( size_x ), yout( size_y );
+
+    // generate in float, round to T16, then copy back to float,
+    // so the reference gets exactly the same values
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, xref.data() );
+    lapack_larnv( idist, iseed, size_y, yref.data() );
+    for (size_t i = 0; i < size_x; ++i) {
+        x[ i ] = T16( xref[ i ] );
+        xref[ i ] = x[ i ];
+    }
+    for (size_t i = 0; i < size_y; ++i) {
+        y[ i ] = T16( yref[ i ] );
+        yref[ i ] = y[ i ];
+    }
+
+    real_t Xnorm = cblas_nrm2( n, xref.data(), incx );
+    real_t Ynorm = cblas_nrm2( n, yref.data(), incy );
+
+    if (verbose >= 2) {
+        printf( "x = " ); print_vector( n, xref.data(), incx );
+        printf( "y = " ); print_vector( n, yref.data(), incy );
+    }
+
+    // run reference, in float. scal takes alpha in T16.
+    real_t alpha16 = T16( alpha );
+    std::vector<real_t> axpy_ref = yref, scal_ref = xref;
+    cblas_axpy( n, alpha, xref.data(), incx, axpy_ref.data(), incy );
+    cblas_scal( n, alpha16, scal_ref.data(), incx );
+    real_t  dot_ref   = cblas_dot( n, xref.data(), incx, yref.data(), incy );
+    int64_t iamax_ref = cblas_iamax( n, xref.data(), incx );
+    double sum = 0;
+    for (int64_t i = 0; i < n; ++i)
+        sum += std::abs( double( xref[ i*incx ] ) );
+    real_t asum_ref = real_t( sum );
+
+    real_t u16 = 0.5f * float( std::numeric_limits< T16 >::epsilon() );
+    real_t u   = 0.5f * std::numeric_limits< real_t >::epsilon();
+    real_t error = 0;
+    bool okay = true;
+
+    // run test, then check each result
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    for_each_simd_isa( [&]() {
+        real_t err;
+        bool ok;
+
+        // axpy, relative to T16's unit roundoff
+        y16 = y;
+        blas::axpy( n, alpha, x.data(), incx, y16.data(), incy );
+        for (size_t i = 0; i < size_y; ++i)
+            yout[ i ] = y16[ i ];
+        check_gemm( 1, n, 1, alpha, real_t( 1 ), Xnorm, real_t( 1 ), Ynorm,
+                    axpy_ref.data(), incy, yout.data(), incy, verbose,
+                    &err, &ok );
+        error = std::max( error, err * u / u16 );
+
+        // scal, relative to T16's unit roundoff
+        x16 = x;
+        blas::scal( n, T16( alpha ), x16.data(), incx );
+        for (size_t i = 0; i < size_x; ++i)
+            xout[ i ] = x16[ i ];
+        check_gemm( 1, n, 1, alpha16, real_t( 0 ), Xnorm, real_t( 1 ),
+                    real_t( 0 ), scal_ref.data(), incx, xout.data(), incx,
+                    verbose, &err, &ok );
+        error = std::max( error, err * u / u16 );
+
+        // copy, in both directions, is exact
+        std::fill( yout.begin(), yout.end(), real_t( 0 ) );
+        blas::copy( n, x.data(), incx, yout.data(), incy );
+        y16 = y;
+        blas::copy( n, xref.data(), incx, y16.data(), incy );
+        for (int64_t i = 0; i < n; ++i) {
+            okay = okay && yout[ i*incy ] == xref[ i*incx ]
+                        && float( y16[ i*incy ] ) == xref[ i*incx ];
+        }
+
+        // dot, relative to float's unit roundoff
+        real_t result = blas::dot( n, x.data(), incx, y.data(), incy );
+        check_gemm( 1, 1, n, real_t( 1 ), real_t( 0 ), Xnorm, Ynorm,
+                    real_t( 0 ), &dot_ref, 1, &result, 1, verbose, &err, &ok );
+        error = std::max( error, err );
+
+        if (n > 0) {
+            // asum, relative forward error
+            result = blas::asum( n, x.data(), incx );
+            real_t asum_error = std::abs( (asum_ref - result) / asum_ref );
+            error = std::max( error, asum_error / n );
+
+            // iamax is exact
+            okay = okay && blas::iamax( n, x.data(), incx ) == iamax_ref;
+        }
+    } );
+    time = get_wtime() - time;
+    params.time() = time * 1000;  // msec
+
+    // error is scaled so all routines are compared to float's unit roundoff
+    params.error() = error;
+    params.okay() = okay && (error < u);
+}
+
+// -----------------------------------------------------------------------------
+void test_blas1_half( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_blas1_half_work< blas::float16 >( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_blas1_bf16( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_blas1_half_work< blas::bfloat16 >( params, run );
+}
@@ -0,0 +1,545 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the threaded generic Level 3 templates: hemm, symm, herk, her2k,
+// syrk, syr2k, trmm, and trsm. Explicit template arguments force the
+// generic template, rather than the vendor BLAS overloads, and
+// run_threaded makes even small problems take the parallel branch
+// (time), compared to the vendor BLAS (ref_time).
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_blas3_generic( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests hemm (if herm) or symm.
+template <typename scalar_t>
+void test_hemm_generic_work( Params& params, bool run, bool herm )
+{
+    using namespace testsweeper;
+    using blas::Side;
+    using blas::Uplo;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side = params.side();
+    blas::Uplo uplo = params.uplo();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t An = (side == Side::Left ? m : n);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor)
+        std::swap( Cm, Cn );
+    int64_t lda = roundup( An, align );
+    int64_t ldb = roundup( Cm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Cn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<scalar_t> A( size_A ), B( size_B ), C( size_C ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    Cref = C;
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lansy( "f", to_c_string( uplo ), An, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Cm, Cn, B.data(), ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C.data(), ldc, work );
+
+    // set unused triangle of A to nan; in row-major, the stored triangle
+    // is the opposite one in column-major terms
+    bool lower = ((uplo == Uplo::Lower) == (layout == Layout::ColMajor));
+    for (int64_t j = 0; j < An; ++j) {
+        for (int64_t i = 0; i < An; ++i) {
+            if (lower ? i < j : i > j)
+                A[ i + j*lda ] = nan("");
+        }
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A An=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B  m=%5lld,  n=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C  m=%5lld,  n=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( An ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( m ), llong( n ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( m ), llong( n ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        if (herm) {
+            blas::hemm<scalar_t, scalar_t, scalar_t>(
+                layout, side, uplo, m, n, alpha, A.data(), lda,
+                B.data(), ldb, beta, C.data(), ldc );
+        }
+        else {
+            blas::symm<scalar_t, scalar_t, scalar_t>(
+                layout, side, uplo, m, n, alpha, A.data(), lda,
+                B.data(), ldb, beta, C.data(), ldc );
+        }
+    } );
+
+    double gflop = (herm ? blas::Gflop< scalar_t >::hemm( side, m, n )
+                         : blas::Gflop< scalar_t >::symm( side, m, n ));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        if (herm) {
+            cblas_hemm( cblas_layout_const(layout),
+                        cblas_side_const(side),
+                        cblas_uplo_const(uplo),
+                        m, n, alpha, A.data(), lda, B.data(), ldb,
+                        beta, Cref.data(), ldc );
+        }
+        else {
+            cblas_symm( cblas_layout_const(layout),
+                        cblas_side_const(side),
+                        cblas_uplo_const(uplo),
+                        m, n, alpha, A.data(), lda, B.data(), ldb,
+                        beta, Cref.data(), ldc );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( Cm, Cn, An, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref.data(), ldc, C.data(), ldc, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests the rank-k update herk or syrk (if ! rank2),
+// or the rank-2k update her2k or syr2k (if rank2).
+template <typename scalar_t>
+void test_herk_generic_work( Params& params, bool run, bool herm, bool rank2 )
+{
+    using namespace testsweeper;
+    using std::real;
+    using blas::Uplo;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    blas::Uplo uplo = params.uplo();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // herk has real alpha and beta; her2k has real beta
+    if (herm) {
+        if (! rank2)
+            alpha = real( alpha );
+        beta = real( beta );
+    }
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (trans == Op::NoTrans ? n : k);
+    int64_t An = (trans == Op::NoTrans ? k : n);
+    if (layout == Layout::RowMajor)
+        std::swap( Am, An );
+    int64_t lda = roundup( Am, align );
+    int64_t ldc = roundup(  n, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_C = size_t(ldc)*n;
+    std::vector<scalar_t> A( size_A ), B( rank2 ? size_A : 0 ), C( size_C ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    if (rank2)
+        lapack_larnv( idist, iseed, size_A, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    if (herm) {
+        // C is Hermitian, so its diagonal is real
+        for (int64_t i = 0; i < n; ++i)
+            C[ i + i*ldc ] = real( C[ i + i*ldc ] );
+    }
+    Cref = C;
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Bnorm = (rank2 ? lapack_lange( "f", Am, An, B.data(), lda, work )
+                          : Anorm);
+    real_t Cnorm = lapack_lansy( "f", to_c_string( uplo ), n, C.data(), ldc, work );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "C  n=%5lld,  n=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( n ), llong( n ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        if (herm && rank2) {
+            blas::her2k<scalar_t, scalar_t, scalar_t>(
+                layout, uplo, trans, n, k, alpha, A.data(), lda,
+                B.data(), lda, real( beta ), C.data(), ldc );
+        }
+        else if (herm) {
+            blas::herk<scalar_t, scalar_t>(
+                layout, uplo, trans, n, k, real( alpha ), A.data(), lda,
+                real( beta ), C.data(), ldc );
+        }
+        else if (rank2) {
+            blas::syr2k<scalar_t, scalar_t, scalar_t>(
+                layout, uplo, trans, n, k, alpha, A.data(), lda,
+                B.data(), lda, beta, C.data(), ldc );
+        }
+        else {
+            blas::syrk<scalar_t, scalar_t>(
+                layout, uplo, trans, n, k, alpha, A.data(), lda,
+                beta, C.data(), ldc );
+        }
+    } );
+
+    double gflop = (rank2 ? (herm ? blas::Gflop< scalar_t >::her2k( n, k )
+                                  : blas::Gflop< scalar_t >::syr2k( n, k ))
+                          : (herm ? blas::Gflop< scalar_t >::herk( n, k )
+                                  : blas::Gflop< scalar_t >::syrk( n, k )));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        if (herm && rank2) {
+            cblas_her2k( cblas_layout_const(layout),
+                         cblas_uplo_const(uplo),
+                         cblas_trans_const(trans),
+                         n, k, alpha, A.data(), lda, B.data(), lda,
+                         real( beta ), Cref.data(), ldc );
+        }
+        else if (herm) {
+            cblas_herk( cblas_layout_const(layout),
+                        cblas_uplo_const(uplo),
+                        cblas_trans_const(trans),
+                        n, k, real( alpha ), A.data(), lda,
+                        real( beta ), Cref.data(), ldc );
+        }
+        else if (rank2) {
+            cblas_syr2k( cblas_layout_const(layout),
+                         cblas_uplo_const(uplo),
+                         cblas_trans_const(trans),
+                         n, k, alpha, A.data(), lda, B.data(), lda,
+                         beta, Cref.data(), ldc );
+        }
+        else {
+            cblas_syrk( cblas_layout_const(layout),
+                        cblas_uplo_const(uplo),
+                        cblas_trans_const(trans),
+                        n, k, alpha, A.data(), lda,
+                        beta, Cref.data(), ldc );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_herk( uplo, n, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref.data(), ldc, C.data(), ldc, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests trsm (if solve) or trmm.
+template <typename scalar_t>
+void test_trmm_generic_work( Params& params, bool run, bool solve )
+{
+    using namespace testsweeper;
+    using blas::Side;
+    using blas::Uplo;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+    using std::swap;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side = params.side();
+    blas::Uplo uplo = params.uplo();
+    blas::Op trans  = params.trans();
+    blas::Diag diag = params.diag();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (side == Side::Left ? m : n);
+    int64_t Bm = m;
+    int64_t Bn = n;
+    if (layout == Layout::RowMajor)
+        swap( Bm, Bn );
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    size_t size_A = size_t(lda)*Am;
+    size_t size_B = size_t(ldb)*Bn;
+    std::vector<scalar_t> A( size_A ), B( size_B ), Bref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    Bref = B;
+
+    // set unused data to nan
+    for (int64_t j = 0; j < Am; ++j) {
+        for (int64_t i = 0; i < Am; ++i) {
+            if (uplo == Uplo::Lower ? i < j : i > j)
+                A[ i + j*lda ] = nan("");
+        }
+    }
+
+    // Factor A into L L^H or U U^H to get a well-conditioned triangular matrix,
+    // as in test_trsm.
+    for (int64_t i = 0; i < Am; ++i) {
+        A[ i + i*lda ] += Am;
+    }
+    int64_t info = 0;
+    lapack_potrf( to_c_string( uplo ), Am, A.data(), lda, &info );
+    require( info == 0 );
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lantr( "f", to_c_string( uplo ), to_c_string( diag ),
+                                 Am, Am, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B.data(), ldb, work );
+
+    // if row-major, transpose A
+    if (layout == Layout::RowMajor) {
+        for (int64_t j = 0; j < Am; ++j) {
+            for (int64_t i = 0; i < j; ++i) {
+                swap( A[ i + j*lda ], A[ j + i*lda ] );
+            }
+        }
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, Am=%5lld, lda=%5lld, size=%10lld, norm=%.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm=%.2e\n",
+                llong( Am ), llong( Am ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = run_threaded( [&]() {
+        if (solve) {
+            blas::trsm<scalar_t, scalar_t>(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A.data(), lda, B.data(), ldb );
+        }
+        else {
+            blas::trmm<scalar_t, scalar_t>(
+                layout, side, uplo, trans, diag, m, n,
+                alpha, A.data(), lda, B.data(), ldb );
+        }
+    } );
+
+    double gflop = (solve ? blas::Gflop< scalar_t >::trsm( side, m, n )
+                          : blas::Gflop< scalar_t >::trmm( side, m, n ));
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        if (solve) {
+            cblas_trsm( cblas_layout_const(layout),
+                        cblas_side_const(side),
+                        cblas_uplo_const(uplo),
+                        cblas_trans_const(trans),
+                        cblas_diag_const(diag),
+                        m, n, alpha, A.data(), lda, Bref.data(), ldb );
+        }
+        else {
+            cblas_trmm( cblas_layout_const(layout),
+                        cblas_side_const(side),
+                        cblas_uplo_const(uplo),
+                        cblas_trans_const(trans),
+                        cblas_diag_const(diag),
+                        m, n, alpha, A.data(), lda, Bref.data(), ldb );
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        // check error compared to reference
+        // Am is reduction dimension; beta = 0, Cnorm = 0 (initial).
+        real_t error;
+        bool okay;
+        check_gemm( Bm, Bn, Am, alpha, scalar_t(0), Anorm, Bnorm, real_t(0),
+                    Bref.data(), ldb, B.data(), ldb, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_hemm_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_hemm_generic_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_symm_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_hemm_generic_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_herk_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_herk_generic_work< decltype( x ) >( params, run, true, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_her2k_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_herk_generic_work< decltype( x ) >( params, run, true, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_syrk_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_herk_generic_work< decltype( x ) >( params, run, false, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_syr2k_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_herk_generic_work< decltype( x ) >( params, run, false, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_trmm_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_trmm_generic_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_trsm_generic( Params& params, bool run )
+{
+    dispatch_blas3_generic( params, [&]( auto x ) {
+        test_trmm_generic_work< decltype( x ) >( params, run, true );
+    } );
+}
@@ -0,0 +1,447 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests compensated routines dot2, asum2, and gemv2. Inputs are made
+// ill-conditioned, so the result nearly cancels, and the result is checked
+// against a reference computed in long double, with the twice working
+// precision error bound
+//     u |ref| + (gamma_n^2 + n u_ld) |x|^T |y|,
+// where u_ld accounts for the error in the reference.
+// error is this ratio, which should be about 1 or less; usual dot and gemv
+// have errors about 1 / u larger on these inputs.
+// The ref time is for the usual cblas routine, showing the cost of
+// compensation.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_compensated( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output columns; times are in msec.
+void mark_compensated( Params& params )
+{
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+}
+
+// -----------------------------------------------------------------------------
+// Returns | result - ref | / (u |ref| + (gamma_n^2 + n u_ld) mag),
+// with unit roundoff u of scalar_t and u_ld of long double.
+template <typename scalar_t>
+double compensated_error(
+    int64_t n, scalar_t result, std::complex<long double> ref, long double mag )
+{
+    using real_t = blas::real_type< scalar_t >;
+    long double u    = 0.5L * std::numeric_limits< real_t >::epsilon();
+    long double u_ld = 0.5L * std::numeric_limits< long double >::epsilon();
+    long double gamma = n*u / (1 - n*u);
+    std::complex<long double> r( std::real( result ), std::imag( result ) );
+    long double bound = u*std::abs( ref ) + (gamma*gamma + n*u_ld)*mag;
+    long double diff  = std::abs( r - ref );
+    if (diff == 0)
+        return 0;
+    return double( diff / bound );
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_dot2_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using ld_t = std::complex<long double>;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    mark_compensated( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    // element i of x is x[ ix0 + i*incx ]
+    int64_t ix0 = (incx > 0 ? 0 : (1 - n)*incx);
+    int64_t iy0 = (incy > 0 ? 0 : (1 - n)*incy);
+
+    // Choose the last element of y so x^H y nearly cancels.
+    ld_t sum = 0;
+    for (int64_t i = 0; i < n - 1; ++i) {
+        sum += std::conj( ld_t( x[ ix0 + i*incx ] ) ) * ld_t( y[ iy0 + i*incy ] );
+    }
+    if (n > 1) {
+        ld_t xn = std::conj( ld_t( x[ ix0 + (n - 1)*incx ] ) );
+        y[ iy0 + (n - 1)*incy ] = blas::make_scalar<scalar_t>(
+            std::real( -sum / xn ), std::imag( -sum / xn ) );
+    }
+
+    // reference in long double, and |x|^T |y|
+    ld_t ref = 0;
+    long double mag = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        ld_t xi = std::conj( ld_t( x[ ix0 + i*incx ] ) );
+        ld_t yi = ld_t( y[ iy0 + i*incy ] );
+        ref += xi * yi;
+        mag += std::abs( xi ) * std::abs( yi );
+    }
+
+    // test error exits
+    assert_throw( blas::dot2( -1, x.data(), incx, y.data(), incy ), blas::Error );
+    assert_throw( blas::dot2(  n, x.data(),    0, y.data(), incy ), blas::Error );
+    assert_throw( blas::dot2(  n, x.data(), incx, y.data(),    0 ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "x = " ); print_vector( n, x.data(), incx );
+        printf( "y = " ); print_vector( n, y.data(), incy );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    scalar_t result = blas::dot2( n, x.data(), incx, y.data(), incy );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::dot( n );
+    double gbyte = blas::Gbyte< scalar_t >::dot( n );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run usual dot for time
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        scalar_t result_dot = cblas_dot( n, x.data(), incx, y.data(), incy );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 1) {
+            printf( "\ndot2 error %.2e, dot error %.2e\n",
+                    compensated_error( n, result, ref, mag ),
+                    compensated_error( n, result_dot, ref, mag ) );
+        }
+
+        // check error compared to long double reference
+        params.error() = compensated_error( n, result, ref, mag );
+        params.okay() = (params.error() <= 2);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_asum2_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t verbose = params.verbose();
+
+    mark_compensated( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    std::vector<scalar_t> x( size_x );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+
+    // Scale elements over a wide range, so small ones are lost in a usual sum.
+    for (int64_t i = 0; i < n; ++i) {
+        x[ i*incx ] *= real_t( std::ldexp( 1.0, int( i % 37 ) - 18 ) );
+    }
+
+    // reference in long double; all terms are nonnegative, so mag = ref
+    long double ref = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        ref += std::abs( (long double) std::real( x[ i*incx ] ) )
+            +  std::abs( (long double) std::imag( x[ i*incx ] ) );
+    }
+
+    // test error exits
+    assert_throw( blas::asum2( -1, x.data(), incx ), blas::Error );
+    assert_throw( blas::asum2(  n, x.data(),    0 ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "x = " ); print_vector( n, x.data(), incx );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    real_t result = blas::asum2( n, x.data(), incx );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::asum( n );
+    double gbyte = blas::Gbyte< scalar_t >::asum( n );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run usual asum for time
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        real_t result_asum = cblas_asum( n, x.data(), incx );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 1) {
+            printf( "\nasum2 error %.2e, asum error %.2e\n",
+                    compensated_error( 2*n, result, ref, ref ),
+                    compensated_error( 2*n, result_asum, ref, ref ) );
+        }
+
+        // check error compared to long double reference
+        params.error() = compensated_error( 2*n, result, ref, ref );
+        params.okay() = (params.error() <= 2);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemv2_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using ld_t = std::complex<long double>;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    mark_compensated( params );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( Am, align );
+    int64_t Xm = (trans == Op::NoTrans ? n : m);
+    int64_t Ym = (trans == Op::NoTrans ? m : n);
+    size_t size_A = size_t(lda)*An;
+    size_t size_x = (Xm - 1) * std::abs(incx) + 1;
+    size_t size_y = (Ym - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> A( size_A ), x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    // element i of x is x[ ix0 + i*incx ]
+    int64_t ix0 = (incx > 0 ? 0 : (1 - Xm)*incx);
+    int64_t iy0 = (incy > 0 ? 0 : (1 - Ym)*incy);
+
+    // element (i, j) of op(A), in long double
+    auto opA = [&]( int64_t i, int64_t j ) {
+        if (trans != Op::NoTrans)
+            std::swap( i, j );
+        ld_t a = (layout == Layout::ColMajor ? A[ i + j*lda ] : A[ j + i*lda ]);
+        return (trans == Op::ConjTrans ? std::conj( a ) : a);
+    };
+
+    // Choose y so alpha op(A) x + beta y nearly cancels.
+    ld_t alpha_ = alpha;
+    ld_t beta_  = beta;
+    if (beta != scalar_t( 0 )) {
+        for (int64_t i = 0; i < Ym; ++i) {
+            ld_t sum = 0;
+            for (int64_t j = 0; j < Xm; ++j)
+                sum += opA( i, j ) * ld_t( x[ ix0 + j*incx ] );
+            ld_t yi = -alpha_ * sum / beta_;
+            y[ iy0 + i*incy ] = blas::make_scalar<scalar_t>(
+                std::real( yi ), std::imag( yi ) );
+        }
+    }
+    yref = y;
+
+    // reference in long double, and |alpha| |op(A)| |x| + |beta| |y|
+    std::vector<ld_t> ref( Ym );
+    std::vector<long double> mag( Ym );
+    for (int64_t i = 0; i < Ym; ++i) {
+        ld_t sum = 0;
+        long double mag_i = 0;
+        for (int64_t j = 0; j < Xm; ++j) {
+            ld_t xj = x[ ix0 + j*incx ];
+            sum   += opA( i, j ) * xj;
+            mag_i += std::abs( opA( i, j ) ) * std::abs( xj );
+        }
+        ld_t yi = y[ iy0 + i*incy ];
+        ref[ i ] = alpha_*sum;
+        mag[ i ] = std::abs( alpha_ )*mag_i;
+        if (beta != scalar_t( 0 )) {
+            ref[ i ] += beta_*yi;
+            mag[ i ] += std::abs( beta_ )*std::abs( yi );
+        }
+    }
+
+    // test error exits
+    assert_throw( blas::gemv2( Layout(0), trans,  m,  n, alpha, A.data(), lda, x.data(), incx, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::gemv2( layout,    Op(0),  m,  n, alpha, A.data(), lda, x.data(), incx, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::gemv2( layout,    trans, -1,  n, alpha, A.data(), lda, x.data(), incx, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::gemv2( layout,    trans,  m, -1, alpha, A.data(), lda, x.data(), incx, beta, y.data(), incy ), blas::Error );
+
+    assert_throw( blas::gemv2( Layout::ColMajor, trans,  m,  n, alpha, A.data(), m-1, x.data(), incx, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::gemv2( Layout::RowMajor, trans,  m,  n, alpha, A.data(), n-1, x.data(), incx, beta, y.data(), incy ), blas::Error );
+
+    assert_throw( blas::gemv2( layout,    trans,  m,  n, alpha, A.data(), lda, x.data(), 0,    beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::gemv2( layout,    trans,  m,  n, alpha, A.data(), lda, x.data(), incx, beta, y.data(), 0    ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( Am, An, A.data(), lda );
+        printf( "x = " ); print_vector( Xm, x.data(), incx );
+        printf( "y = " ); print_vector( Ym, y.data(), incy );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemv2( layout, trans, m, n, alpha, A.data(), lda,
+                 x.data(), incx, beta, y.data(), incy );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::gemv( m, n );
+    double gbyte = blas::Gbyte< scalar_t >::gemv( m, n );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "y2 = " ); print_vector( Ym, y.data(), incy );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run usual gemv for time
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemv( cblas_layout_const(layout), cblas_trans_const(trans), m, n,
+                    alpha, A.data(), lda, x.data(), incx, beta, yref.data(), incy );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // check error compared to long double reference;
+        // gemv, like gemv2, leaves y unchanged if m or n is 0.
+        // Each y_i has Xm products, plus beta y_i.
+        double error = 0, error_gemv = 0;
+        for (int64_t i = 0; i < Ym; ++i) {
+            ld_t ref_i = (m == 0 || n == 0 ? ld_t( yref[ iy0 + i*incy ] )
+                                           : ref[ i ]);
+            error = std::max( error, compensated_error(
+                Xm + 2, y[ iy0 + i*incy ], ref_i, mag[ i ] ) );
+            error_gemv = std::max( error_gemv, compensated_error(
+                Xm + 2, yref[ iy0 + i*incy ], ref_i, mag[ i ] ) );
+        }
+
+        if (verbose >= 1) {
+            printf( "\ngemv2 error %.2e, gemv error %.2e\n",
+                    error, error_gemv );
+        }
+        params.error() = error;
+        params.okay() = (error <= 2);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_dot2( Params& params, bool run )
+{
+    dispatch_compensated( params, [&]( auto x ) {
+        test_dot2_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_asum2( Params& params, bool run )
+{
+    dispatch_compensated( params, [&]( auto x ) {
+        test_asum2_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv2( Params& params, bool run )
+{
+    dispatch_compensated( params, [&]( auto x ) {
+        test_gemv2_work< decltype( x ) >( params, run );
+    } );
+}
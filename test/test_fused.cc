@@ -0,0 +1,451 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests fused Level 1 routines axpby, waxpby, dot_axpy, mdot, and maxpy.
+// The reference is the unfused sequence of cblas calls, so ref time shows
+// the gain from streaming each vector through memory once.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_fused( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output columns; times are in msec.
+void mark_fused( Params& params )
+{
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+}
+
+// -----------------------------------------------------------------------------
+// Runs routine, setting time, gflops, gbytes; or ref_time, etc. if ref.
+// The fused routine runs in run_threaded, so even short vectors take
+// the parallel branch of the fused templates.
+template <typename Routine>
+void run_fused( Params& params, bool ref, double gflop, double gbyte,
+                Routine&& routine )
+{
+    testsweeper::flush_cache( params.cache() );
+    double time;
+    if (ref) {
+        time = testsweeper::get_wtime();
+        routine();
+        time = testsweeper::get_wtime() - time;
+    }
+    else {
+        time = run_threaded( routine );
+    }
+
+    if (ref) {
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+    }
+    else {
+        params.time()   = time * 1000;  // msec
+        params.gflops() = gflop / time;
+        params.gbytes() = gbyte / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_axpby_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+    mark_fused( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    yref = y;
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::axpby( -1, alpha, x.data(), incx, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::axpby(  n, alpha, x.data(),    0, beta, y.data(), incy ), blas::Error );
+    assert_throw( blas::axpby(  n, alpha, x.data(), incx, beta, y.data(),    0 ), blas::Error );
+
+    // run test
+    double gflop = blas::Gflop< scalar_t >::axpby( n );
+    double gbyte = blas::Gbyte< scalar_t >::axpby( n );
+    run_fused( params, false, gflop, gbyte, [&]() {
+        blas::axpby( n, alpha, x.data(), incx, beta, y.data(), incy );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference: scal, then axpy
+        run_fused( params, true, gflop, gbyte, [&]() {
+            cblas_scal( n, beta, yref.data(), std::abs(incy) );
+            cblas_axpy( n, alpha, x.data(), incx, yref.data(), incy );
+        } );
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( 1, n, 1, alpha, beta, Xnorm, real_t(1), Ynorm,
+                    yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                    verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_waxpby_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+    mark_fused( params );
+
+    if (! run)
+        return;
+
+    // setup; w has the same stride as y
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y ), w( size_y ), wref( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::waxpby( n, alpha, x.data(), incx, beta, y.data(), incy, w.data(), 0 ), blas::Error );
+
+    // run test
+    double gflop = blas::Gflop< scalar_t >::waxpby( n );
+    double gbyte = blas::Gbyte< scalar_t >::waxpby( n );
+    run_fused( params, false, gflop, gbyte, [&]() {
+        blas::waxpby( n, alpha, x.data(), incx, beta, y.data(), incy,
+                      w.data(), incy );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference: copy, scal, then axpy
+        run_fused( params, true, gflop, gbyte, [&]() {
+            cblas_copy( n, y.data(), incy, wref.data(), incy );
+            cblas_scal( n, beta, wref.data(), std::abs(incy) );
+            cblas_axpy( n, alpha, x.data(), incx, wref.data(), incy );
+        } );
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( 1, n, 1, alpha, beta, Xnorm, real_t(1), Ynorm,
+                    wref.data(), std::abs(incy), w.data(), std::abs(incy),
+                    verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_dot_axpy_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+    mark_fused( params );
+
+    if (! run)
+        return;
+
+    // setup; z has the same stride as x
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y ), z( size_x ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    lapack_larnv( idist, iseed, size_x, z.data() );
+    yref = y;
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+    real_t Znorm = cblas_nrm2( n, z.data(), std::abs(incx) );
+
+    // test error exits
+    assert_throw( blas::dot_axpy( n, alpha, x.data(), incx, y.data(), incy, z.data(), 0 ), blas::Error );
+
+    // run test
+    scalar_t result = 0, ref = 0;
+    double gflop = blas::Gflop< scalar_t >::dot_axpy( n );
+    double gbyte = blas::Gbyte< scalar_t >::dot_axpy( n );
+    run_fused( params, false, gflop, gbyte, [&]() {
+        result = blas::dot_axpy( n, alpha, x.data(), incx, y.data(), incy,
+                                 z.data(), incx );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference: axpy, then dot
+        run_fused( params, true, gflop, gbyte, [&]() {
+            cblas_axpy( n, alpha, x.data(), incx, yref.data(), incy );
+            ref = cblas_dot( n, yref.data(), incy, z.data(), incx );
+        } );
+
+        // check error compared to reference, for both y and y^H z
+        real_t error, error2;
+        bool okay, okay2;
+        check_gemm( 1, n, 1, alpha, scalar_t(1), Xnorm, real_t(1), Ynorm,
+                    yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                    verbose, &error, &okay );
+        real_t Ynorm2 = cblas_nrm2( n, yref.data(), std::abs(incy) );
+        check_gemm( 1, 1, n, scalar_t(1), scalar_t(0), Ynorm2, Znorm, real_t(0),
+                    &ref, 1, &result, 1, verbose, &error2, &okay2 );
+        params.error() = error + error2;
+        params.okay() = okay && okay2;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_mdot_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+    mark_fused( params );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t ldx = roundup( std::max( n, int64_t( 1 ) ), align );
+    size_t size_X = size_t(ldx)*k;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> X( size_X ), y( size_y ), r( k ), rref( k );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_X, X.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t work[1];
+    real_t Xnorm = lapack_lange( "f", n, k, X.data(), ldx, work );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::mdot( n, -1, X.data(), ldx, y.data(), incy, r.data() ), blas::Error );
+    assert_throw( blas::mdot( n,  k, X.data(), n-1, y.data(), incy, r.data() ), blas::Error );
+
+    // run test
+    double gflop = blas::Gflop< scalar_t >::mdot( n, k );
+    double gbyte = blas::Gbyte< scalar_t >::mdot( n, k );
+    run_fused( params, false, gflop, gbyte, [&]() {
+        blas::mdot( n, k, X.data(), ldx, y.data(), incy, r.data() );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference: k dot
+        run_fused( params, true, gflop, gbyte, [&]() {
+            for (int64_t j = 0; j < k; ++j)
+                rref[ j ] = cblas_dot( n, &X[ j*ldx ], 1, y.data(), incy );
+        } );
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( 1, k, n, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                    rref.data(), 1, r.data(), 1, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_maxpy_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+    mark_fused( params );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t ldx = roundup( std::max( n, int64_t( 1 ) ), align );
+    size_t size_X = size_t(ldx)*k;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> X( size_X ), y( size_y ), alpha( k ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_X, X.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    lapack_larnv( idist, iseed, k, alpha.data() );
+    yref = y;
+
+    real_t work[1];
+    real_t Xnorm = lapack_lange( "f", n, k, X.data(), ldx, work );
+    real_t Anorm = cblas_nrm2( k, alpha.data(), 1 );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::maxpy( n, k, alpha.data(), X.data(), ldx, y.data(), 0 ), blas::Error );
+
+    // run test
+    double gflop = blas::Gflop< scalar_t >::maxpy( n, k );
+    double gbyte = blas::Gbyte< scalar_t >::maxpy( n, k );
+    run_fused( params, false, gflop, gbyte, [&]() {
+        blas::maxpy( n, k, alpha.data(), X.data(), ldx, y.data(), incy );
+    } );
+
+    if (params.check() == 'y') {
+        // run reference: k axpy
+        run_fused( params, true, gflop, gbyte, [&]() {
+            for (int64_t j = 0; j < k; ++j)
+                cblas_axpy( n, alpha[ j ], &X[ j*ldx ], 1, yref.data(), incy );
+        } );
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( 1, n, k, scalar_t(1), scalar_t(1), Anorm, Xnorm, Ynorm,
+                    yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                    verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_axpby( Params& params, bool run )
+{
+    dispatch_fused( params, [&]( auto x ) {
+        test_axpby_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_waxpby( Params& params, bool run )
+{
+    dispatch_fused( params, [&]( auto x ) {
+        test_waxpby_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dot_axpy( Params& params, bool run )
+{
+    dispatch_fused( params, [&]( auto x ) {
+        test_dot_axpy_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_mdot( Params& params, bool run )
+{
+    dispatch_fused( params, [&]( auto x ) {
+        test_mdot_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_maxpy( Params& params, bool run )
+{
+    dispatch_fused( params, [&]( auto x ) {
+        test_maxpy_work< decltype( x ) >( params, run );
+    } );
+}
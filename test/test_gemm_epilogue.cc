@@ -0,0 +1,284 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+// Reference activation, f(x), for the --activation parameter.
+template <typename scalar_t>
+scalar_t activation_ref( char activation, scalar_t x )
+{
+    if constexpr (blas::is_complex_v< scalar_t >) {
+        return x;
+    }
+    else {
+        switch (activation) {
+            case 'r': return (x < 0 ? scalar_t( 0 ) : x);
+            case 'c': return std::min( std::max( x, scalar_t( -1 ) ),
+                                       scalar_t( 1 ) );
+            case 's': return 1 / (1 + std::exp( -x ));
+            case 't': return std::tanh( x );
+            case 'g': return x * (1 + std::erf( x / std::sqrt( scalar_t( 2 ) ) ))
+                             / 2;
+            default:  return x;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests gemm_epilogue, with per-row and per-column scaling and bias,
+// and the activation given by --activation (clamp uses [-1, 1]).
+// The generic fused engine is also run (time2, gflops2), and the
+// reference is gemm followed by a separate pass over C (ref_time).
+template <typename TA, typename TB, typename TC>
+void test_gemm_epilogue_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using std::real;
+    using std::imag;
+    using blas::Op;
+    using blas::Layout;
+    using scalar_t = blas::scalar_type< TA, TB, TC >;
+    using real_t   = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    char activation = params.activation();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.time2();
+    params.gflops2();
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+
+    params.time2.name( "generic (s)" );
+    params.gflops2.name( "generic gflop/s" );
+    params.error2.name( "generic error" );
+    params.gflops2.width( 15 );
+    params.error2.width( 13 );
+
+    if (! run)
+        return;
+
+    if (blas::is_complex_v< scalar_t > && activation != 'n') {
+        params.msg() = "skipping: activation requires a real type";
+        return;
+    }
+
+    blas::Activation act;
+    switch (activation) {
+        case 'r': act = blas::Activation::ReLU;    break;
+        case 'c': act = blas::Activation::Clamp;   break;
+        case 's': act = blas::Activation::Sigmoid; break;
+        case 't': act = blas::Activation::Tanh;    break;
+        case 'g': act = blas::Activation::GELU;    break;
+        default:  act = blas::Activation::None;    break;
+    }
+    auto func = [activation]( scalar_t x ) {
+        return activation_ref( activation, x );
+    };
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<TA> A( size_A );
+    std::vector<TB> B( size_B );
+    std::vector<TC> C( size_C ), Cgen, Cref;
+    std::vector<scalar_t> scale_row( m ), scale_col( n ),
+                          bias_row( m ), bias_col( n );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    lapack_larnv( idist, iseed, m, scale_row.data() );
+    lapack_larnv( idist, iseed, n, scale_col.data() );
+    lapack_larnv( idist, iseed, m, bias_row.data() );
+    lapack_larnv( idist, iseed, n, bias_col.data() );
+    Cgen = C;
+    Cref = C;
+
+    // norms for error check. Scales are in [0, 1], so they don't increase
+    // the bound; biases are added to ||C||.
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B.data(), ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C.data(), ldc, work );
+    real_t bias_norm = sqrt( real_t( n ) ) * cblas_nrm2( m, bias_row.data(), 1 )
+                     + sqrt( real_t( m ) ) * cblas_nrm2( n, bias_col.data(), 1 );
+
+    // test error exits
+    assert_throw( blas::gemm_epilogue( Layout(0), transA, transB,  m,  n,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    Op(0),  transB,  m,  n,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    transA, Op(0),   m,  n,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    transA, transB, -1,  n,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    transA, transB,  m, -1,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    transA, transB,  m,  n, -1, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, act ), blas::Error );
+    assert_throw( blas::gemm_epilogue( layout,    transA, transB,  m,  n,  k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nullptr, nullptr, nullptr, nullptr, blas::Activation( 0 ) ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( Cm ), llong( Cn ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei; beta = %.4e + %.4ei;\n",
+                real(alpha), imag(alpha),
+                real(beta),  imag(beta) );
+        printf( "A = "    ); print_matrix( Am, An, A.data(), lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, B.data(), ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, C.data(), ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemm_epilogue( layout, transA, transB, m, n, k,
+                         alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc,
+                         scale_row.data(), scale_col.data(),
+                         bias_row.data(), bias_col.data(),
+                         act, real_t( -1 ), real_t( 1 ) );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( Cm, Cn, C.data(), ldc );
+    }
+
+    // run generic fused engine, which is column-major only
+    testsweeper::flush_cache( params.cache() );
+    time = get_wtime();
+    if (m > 0 && n > 0) {
+        if (layout == Layout::RowMajor) {
+            blas::internal::gemm_epilogue_op< scalar_t, decltype( func ) > ep {
+                scale_col.data(), scale_row.data(),
+                bias_col.data(), bias_row.data(), &func };
+            blas::internal::gemm_epilogue_generic<TB, TA, TC>(
+                transB, transA, n, m, k,
+                alpha, B.data(), ldb, A.data(), lda, beta, Cgen.data(), ldc, ep );
+        }
+        else {
+            blas::internal::gemm_epilogue_op< scalar_t, decltype( func ) > ep {
+                scale_row.data(), scale_col.data(),
+                bias_row.data(), bias_col.data(), &func };
+            blas::internal::gemm_epilogue_generic<TA, TB, TC>(
+                transA, transB, m, n, k,
+                alpha, A.data(), lda, B.data(), ldb, beta, Cgen.data(), ldc, ep );
+        }
+    }
+    time = get_wtime() - time;
+
+    params.time2()   = time;
+    params.gflops2() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference: W = op(A) op(B), then a separate pass over C
+        std::vector<TC> W( size_C );
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, scalar_t( 1 ), A.data(), lda, B.data(), ldb,
+                    scalar_t( 0 ), W.data(), ldc );
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                int64_t ij = (layout == Layout::ColMajor ? i + j*ldc : j + i*ldc);
+                scalar_t c = alpha * scale_row[ i ] * scale_col[ j ] * W[ ij ]
+                           + beta * Cref[ ij ] + bias_row[ i ] + bias_col[ j ];
+                Cref[ ij ] = func( c );
+            }
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref.data(), ldc );
+        }
+
+        // check error compared to reference. Activations are Lipschitz
+        // with constant about 1, so the gemm error bound applies.
+        real_t error, error2;
+        bool okay, okay2;
+        check_gemm( Cm, Cn, k, alpha, scalar_t( 1 ), Anorm, Bnorm,
+                    std::abs( beta )*Cnorm + bias_norm,
+                    Cref.data(), ldc, C.data(), ldc, verbose, &error, &okay );
+        check_gemm( Cm, Cn, k, alpha, scalar_t( 1 ), Anorm, Bnorm,
+                    std::abs( beta )*Cnorm + bias_norm,
+                    Cref.data(), ldc, Cgen.data(), ldc, verbose, &error2, &okay2 );
+        params.error()  = error;
+        params.error2() = error2;
+        params.okay()   = okay && okay2;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_epilogue( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gemm_epilogue_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gemm_epilogue_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gemm_epilogue_work< std::complex<float>, std::complex<float>,
+                                     std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gemm_epilogue_work< std::complex<double>, std::complex<double>,
+                                     std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
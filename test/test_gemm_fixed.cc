@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+using blas::fixed::dynamic;
+
+// -----------------------------------------------------------------------------
+// Calls blas::fixed::gemm with all extents static if m = n = k is one of
+// the instantiated sizes; else with static k and dynamic m, n if k is one
+// of them; else with all extents dynamic.
+template <typename TA, typename TB, typename TC>
+void gemm_fixed(
+    blas::Layout layout, blas::Op transA, blas::Op transB,
+    int64_t m, int64_t n, int64_t k,
+    blas::scalar_type<TA, TB, TC> alpha,
+    TA const* A, int64_t lda,
+    TB const* B, int64_t ldb,
+    blas::scalar_type<TA, TB, TC> beta,
+    TC*       C, int64_t ldc )
+{
+    using blas::fixed::gemm;
+
+    #define GEMM_FIXED( M_, N_, K_ ) \
+        gemm< M_, N_, K_ >( layout, transA, transB, m, n, k, \
+                            alpha, A, lda, B, ldb, beta, C, ldc )
+
+    if (m == n && n == k) {
+        switch (k) {
+            case  3: GEMM_FIXED(  3,  3,  3 ); return;
+            case  4: GEMM_FIXED(  4,  4,  4 ); return;
+            case  8: GEMM_FIXED(  8,  8,  8 ); return;
+            case 13: GEMM_FIXED( 13, 13, 13 ); return;
+            case 16: GEMM_FIXED( 16, 16, 16 ); return;
+            case 32: GEMM_FIXED( 32, 32, 32 ); return;
+        }
+    }
+    switch (k) {
+        case  4: GEMM_FIXED( dynamic, dynamic,  4 ); return;
+        case  8: GEMM_FIXED( dynamic, dynamic,  8 ); return;
+        case 16: GEMM_FIXED( dynamic, dynamic, 16 ); return;
+        case 32: GEMM_FIXED( dynamic, dynamic, 32 ); return;
+    }
+    GEMM_FIXED( dynamic, dynamic, dynamic );
+
+    #undef GEMM_FIXED
+}
+
+// -----------------------------------------------------------------------------
+template <typename TA, typename TB, typename TC>
+void test_gemm_fixed_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using std::real;
+    using std::imag;
+    using blas::Op;
+    using blas::Layout;
+    using scalar_t = blas::scalar_type< TA, TB, TC >;
+    using real_t   = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    TA* A    = new TA[ size_A ];
+    TB* B    = new TB[ size_B ];
+    TC* C    = new TC[ size_C ];
+    TC* Cref = new TC[ size_C ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A );
+    lapack_larnv( idist, iseed, size_B, B );
+    lapack_larnv( idist, iseed, size_C, C );
+    lapack_lacpy( "g", Cm, Cn, C, ldc, Cref, ldc );
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A, lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B, ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C, ldc, work );
+
+    // no error exits: fixed::gemm does not check arguments
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( Cm ), llong( Cn ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei; beta = %.4e + %.4ei;\n",
+                real(alpha), imag(alpha),
+                real(beta),  imag(beta) );
+        printf( "A = "    ); print_matrix( Am, An, A, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, B, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    gemm_fixed( layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, alpha, A, lda, B, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
+        }
+
+        // check error compared to reference
+        real_t error;
+        bool okay;
+        check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref, ldc, C, ldc, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gemm_fixed_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gemm_fixed_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gemm_fixed_work< std::complex<float>, std::complex<float>,
+                                  std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gemm_fixed_work< std::complex<double>, std::complex<double>,
+                                  std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
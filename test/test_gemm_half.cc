@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+// Tests gemm with A, B, C stored in a 16-bit type T16 (float16 or bfloat16)
+// and float arithmetic, compared to sgemm on the same values in float.
+template <typename T16>
+void test_gemm_half_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = float;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    real_t alpha    = params.alpha.get<real_t>();
+    real_t beta     = params.beta.get<real_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    T16*    A    = new T16[ size_A ];
+    T16*    B    = new T16[ size_B ];
+    T16*    C    = new T16[ size_C ];
+    real_t* Aref = new real_t[ size_A ];
+    real_t* Bref = new real_t[ size_B ];
+    real_t* Cref = new real_t[ size_C ];
+    real_t* Cout = new real_t[ size_C ];
+
+    // generate in float, round to T16, then copy back to float,
+    // so the reference gets exactly the same values
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, Aref );
+    lapack_larnv( idist, iseed, size_B, Bref );
+    lapack_larnv( idist, iseed, size_C, Cref );
+    for (size_t i = 0; i < size_A; ++i) {
+        A[ i ] = T16( Aref[ i ] );
+        Aref[ i ] = A[ i ];
+    }
+    for (size_t i = 0; i < size_B; ++i) {
+        B[ i ] = T16( Bref[ i ] );
+        Bref[ i ] = B[ i ];
+    }
+    for (size_t i = 0; i < size_C; ++i) {
+        C[ i ] = T16( Cref[ i ] );
+        Cref[ i ] = C[ i ];
+    }
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, Aref, lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, Bref, ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, Cref, ldc, work );
+
+    // test error exits
+    assert_throw( blas::gemm( Layout(0), transA, transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    Op(0),  transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, Op(0),   m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB, -1,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m, -1,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m,  n, -1, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( Cm ), llong( Cn ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e; beta = %.4e;\n", alpha, beta );
+        printf( "A = "    ); print_matrix( Am, An, Aref, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, Bref, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, Cref, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemm( layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< T16 >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    for (size_t i = 0; i < size_C; ++i)
+        Cout[ i ] = C[ i ];
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( Cm, Cn, Cout, ldc );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference, sgemm in float
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, alpha, Aref, lda, Bref, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
+        }
+
+        // check error compared to reference. Accumulating in float, the
+        // error is dominated by rounding the result to T16, so the
+        // tolerance is T16's unit roundoff rather than float's.
+        real_t error;
+        bool okay;
+        check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref, ldc, Cout, ldc, verbose, &error, &okay );
+        real_t u16 = 0.5f * float( std::numeric_limits< T16 >::epsilon() );
+        params.error() = error;
+        params.okay() = (error < u16);
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Aref;
+    delete[] Bref;
+    delete[] Cref;
+    delete[] Cout;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_half( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_gemm_half_work< blas::float16 >( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_bf16( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_gemm_half_work< blas::bfloat16 >( params, run );
+}
@@ -0,0 +1,349 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+// Fills n entries of x with random integers in [lo, hi].
+template <typename T>
+void random_int( int64_t n, int lo, int hi, int iseed[4], T* x )
+{
+    std::vector<double> r( n );
+    lapack_larnv( 1, iseed, n, r.data() );  // uniform (0, 1)
+    for (int64_t i = 0; i < n; ++i)
+        x[ i ] = T( lo + int( r[ i ] * (hi - lo + 1) ) );
+}
+
+// -----------------------------------------------------------------------------
+// Tests gemm with int8 A, B and int32 C. Results are exact, so they are
+// compared exactly to dgemm on the same values, which is also exact
+// for k < 2^53 / 2^14.
+void test_gemm_int8_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    int32_t alpha   = int32_t( params.alpha.get<double>() );
+    int32_t beta    = int32_t( params.beta.get<double>() );
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops.name( "gop/s" );
+    params.ref_gflops.name( "ref gflop/s" );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    int8_t*  A    = new int8_t [ size_A ];
+    int8_t*  B    = new int8_t [ size_B ];
+    int32_t* C    = new int32_t[ size_C ];
+    double*  Aref = new double [ size_A ];
+    double*  Bref = new double [ size_B ];
+    double*  Cref = new double [ size_C ];
+
+    int iseed[4] = { 0, 0, 0, 1 };
+    random_int( size_A, -128, 127, iseed, A );
+    random_int( size_B, -128, 127, iseed, B );
+    random_int( size_C, -1000, 1000, iseed, C );
+    std::copy( A, A + size_A, Aref );
+    std::copy( B, B + size_B, Bref );
+    std::copy( C, C + size_C, Cref );
+
+    // test error exits
+    assert_throw( blas::gemm( Layout(0), transA, transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    Op(0),  transB,  m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, Op(0),   m,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB, -1,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m, -1,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm( layout,    transA, transB,  m,  n, -1, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ),
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ),
+                llong( Cm ), llong( Cn ), llong( ldc ), llong( size_C ) );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %d; beta = %d;\n", alpha, beta );
+        printf( "A = "    ); print_matrix( Am, An, Aref, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, Bref, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, Cref, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemm( layout, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< double >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, alpha, Aref, lda, Bref, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
+        }
+
+        // check error compared to reference: max abs difference, exact
+        double error = 0;
+        for (int64_t j = 0; j < Cn; ++j)
+            for (int64_t i = 0; i < Cm; ++i)
+                error = std::max( error, std::abs( C[ i + j*ldc ] - Cref[ i + j*ldc ] ) );
+        params.error() = error;
+        params.okay() = (error == 0);
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Aref;
+    delete[] Bref;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+// Tests gemm_quantized with int8 A, B, per-row scales and zero points of
+// op(A), per-column scales and zero points of op(B), and float C.
+// The reference is dgemm on the dequantized matrices.
+void test_gemm_quantized_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = float;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    real_t alpha    = params.alpha.get<real_t>();
+    real_t beta     = params.beta.get<real_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops.name( "gop/s" );
+    params.ref_gflops.name( "ref gflop/s" );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    int8_t* A     = new int8_t[ size_A ];
+    int8_t* B     = new int8_t[ size_B ];
+    real_t* C     = new real_t[ size_C ];
+    double* Aref  = new double[ size_A ];
+    double* Bref  = new double[ size_B ];
+    double* Cref  = new double[ size_C ];
+    real_t* Cout  = new real_t[ size_C ];
+    std::vector<real_t>  scale_A( m ), scale_B( n );
+    std::vector<int32_t> zero_A( m ), zero_B( n );
+
+    int iseed[4] = { 0, 0, 0, 1 };
+    random_int( size_A, -128, 127, iseed, A );
+    random_int( size_B, -128, 127, iseed, B );
+    random_int( m, -10, 10, iseed, zero_A.data() );
+    random_int( n, -10, 10, iseed, zero_B.data() );
+    lapack_larnv( 1, iseed, m, scale_A.data() );
+    lapack_larnv( 1, iseed, n, scale_B.data() );
+    lapack_larnv( 1, iseed, size_C, C );
+    std::copy( C, C + size_C, Cref );
+
+    // Dequantize for reference. Element (r, c) of the stored array is
+    // in row r of op(A) if op(A) is stored column-wise, else in row c;
+    // similarly for columns of op(B).
+    bool colA = ((layout == Layout::ColMajor) == (transA == Op::NoTrans));
+    bool colB = ((layout == Layout::ColMajor) == (transB == Op::NoTrans));
+    for (int64_t c = 0; c < An; ++c) {
+        for (int64_t r = 0; r < Am; ++r) {
+            int64_t i = (colA ? r : c);
+            Aref[ r + c*lda ] = scale_A[ i ] * double( A[ r + c*lda ] - zero_A[ i ] );
+        }
+    }
+    for (int64_t c = 0; c < Bn; ++c) {
+        for (int64_t r = 0; r < Bm; ++r) {
+            int64_t j = (colB ? c : r);
+            Bref[ r + c*ldb ] = scale_B[ j ] * double( B[ r + c*ldb ] - zero_B[ j ] );
+        }
+    }
+
+    // norms for error check
+    double work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, Aref, lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, Bref, ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, Cref, ldc, work );
+
+    // test error exits
+    assert_throw( blas::gemm_quantized( Layout(0), transA, transB,  m,  n,  k, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm_quantized( layout,    Op(0),  transB,  m,  n,  k, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm_quantized( layout,    transA, Op(0),   m,  n,  k, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm_quantized( layout,    transA, transB, -1,  n,  k, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm_quantized( layout,    transA, transB,  m, -1,  k, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemm_quantized( layout,    transA, transB,  m,  n, -1, alpha, A, lda, nullptr, nullptr, B, ldb, nullptr, nullptr, beta, C, ldc ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C Cm=%5lld, Cn=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( Cm ), llong( Cn ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e; beta = %.4e;\n", alpha, beta );
+        printf( "A = "    ); print_matrix( Am, An, Aref, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, Bref, ldb );
+        printf( "C = "    ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemm_quantized( layout, transA, transB, m, n, k, alpha,
+                          A, lda, scale_A.data(), zero_A.data(),
+                          B, ldb, scale_B.data(), zero_B.data(),
+                          beta, C, ldc );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< double >::gemm( m, n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( Cm, Cn, C, ldc );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    m, n, k, alpha, Aref, lda, Bref, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( Cm, Cn, Cref, ldc );
+        }
+
+        // check error compared to reference, in float. The epilogue
+        // rounds the product alpha scale_A[ i ] scale_B[ j ] (ab) in float,
+        // which is a few unit roundoffs, regardless of k.
+        std::copy( Cref, Cref + size_C, Cout );
+        real_t error;
+        bool okay;
+        check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cout, ldc, C, ldc, verbose, &error, &okay );
+        real_t u = 0.5f * std::numeric_limits< real_t >::epsilon();
+        params.error() = error;
+        params.okay() = (error < 4*u);
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Aref;
+    delete[] Bref;
+    delete[] Cref;
+    delete[] Cout;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_int8( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Integer)
+        throw std::exception();
+    test_gemm_int8_work( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_quantized( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Integer)
+        throw std::exception();
+    test_gemm_quantized_work( params, run );
+}
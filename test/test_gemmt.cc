@@ -0,0 +1,242 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+// Tests gemmt. The generic template is also run (time2, gflops2),
+// and the reference is a full gemm (ref_time). Also checks that
+// the opposite triangle of C is not modified.
+template <typename TA, typename TB, typename TC>
+void test_gemmt_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using std::real;
+    using std::imag;
+    using blas::Uplo;
+    using blas::Op;
+    using blas::Layout;
+    using scalar_t = blas::scalar_type< TA, TB, TC >;
+    using real_t   = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Uplo uplo = params.uplo();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.time2();
+    params.gflops2();
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+
+    params.time2.name( "generic (s)" );
+    params.gflops2.name( "generic gflop/s" );
+    params.error2.name( "generic error" );
+    params.gflops2.width( 15 );
+    params.error2.width( 13 );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? n : k);
+    int64_t An = (transA == Op::NoTrans ? k : n);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup(  n, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*n;
+    TA* A    = new TA[ size_A ];
+    TB* B    = new TB[ size_B ];
+    TC* C    = new TC[ size_C ];
+    TC* Cgen = new TC[ size_C ];
+    TC* Cref = new TC[ size_C ];
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A );
+    lapack_larnv( idist, iseed, size_B, B );
+    lapack_larnv( idist, iseed, size_C, C );
+    lapack_lacpy( "g", n, n, C, ldc, Cgen, ldc );
+    lapack_lacpy( "g", n, n, C, ldc, Cref, ldc );
+
+    // column-major triangle, for checks
+    Uplo uplo_col = uplo;
+    if (layout == Layout::RowMajor)
+        uplo_col = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A, lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B, ldb, work );
+    real_t Cnorm = lapack_lange( "f",  n,  n, C, ldc, work );
+
+    // test error exits
+    assert_throw( blas::gemmt( Layout(0), uplo,    transA, transB,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( layout,    Uplo(0), transA, transB,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( layout,    uplo,    Op(0),  transB,  n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( layout,    uplo,    transA, Op(0),   n,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( layout,    uplo,    transA, transB, -1,  k, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( layout,    uplo,    transA, transB,  n, -1, alpha, A, lda, B, ldb, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemmt( Layout::ColMajor, uplo, Op::NoTrans,   Op::NoTrans, n, k, alpha, A, n-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::ColMajor, uplo, Op::Trans,     Op::NoTrans, n, k, alpha, A, k-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::RowMajor, uplo, Op::NoTrans,   Op::NoTrans, n, k, alpha, A, k-1, B, ldb, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::RowMajor, uplo, Op::Trans,     Op::NoTrans, n, k, alpha, A, n-1, B, ldb, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemmt( Layout::ColMajor, uplo, Op::NoTrans, Op::NoTrans, n, k, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::ColMajor, uplo, Op::NoTrans, Op::Trans,   n, k, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::RowMajor, uplo, Op::NoTrans, Op::NoTrans, n, k, alpha, A, lda, B, n-1, beta, C, ldc ), blas::Error );
+    assert_throw( blas::gemmt( Layout::RowMajor, uplo, Op::NoTrans, Op::Trans,   n, k, alpha, A, lda, B, k-1, beta, C, ldc ), blas::Error );
+
+    assert_throw( blas::gemmt( layout, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, n-1 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "layout %c, uplo %c, transA %c, transB %c\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "B Bm=%5lld, Bn=%5lld, ldb=%5lld, size=%10lld, norm %.2e\n"
+                "C  n=%5lld,  n=%5lld, ldc=%5lld, size=%10lld, norm %.2e\n",
+                to_char( layout ), to_char( uplo ),
+                to_char( transA ), to_char( transB ),
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Bm ), llong( Bn ), llong( ldb ), llong( size_B ), Bnorm,
+                llong( n ), llong( n ), llong( ldc ), llong( size_C ), Cnorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei; beta = %.4e + %.4ei;\n",
+                real(alpha), imag(alpha),
+                real(beta),  imag(beta) );
+        printf( "A = "    ); print_matrix( Am, An, A, lda );
+        printf( "B = "    ); print_matrix( Bm, Bn, B, ldb );
+        printf( "C = "    ); print_matrix(  n,  n, C, ldc );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemmt( layout, uplo, transA, transB, n, k,
+                 alpha, A, lda, B, ldb, beta, C, ldc );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::gemmt( n, k );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "C2 = " ); print_matrix( n, n, C, ldc );
+    }
+
+    // run generic template
+    testsweeper::flush_cache( params.cache() );
+    time = get_wtime();
+    blas::gemmt< TA, TB, TC >( layout, uplo, transA, transB, n, k,
+                               alpha, A, lda, B, ldb, beta, Cgen, ldc );
+    time = get_wtime() - time;
+
+    params.time2()   = time;
+    params.gflops2() = gflop / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference: full gemm
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemm( cblas_layout_const(layout),
+                    cblas_trans_const(transA),
+                    cblas_trans_const(transB),
+                    n, n, k, alpha, A, lda, B, ldb, beta, Cref, ldc );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Cref = " ); print_matrix( n, n, Cref, ldc );
+        }
+
+        // the opposite triangle must be unchanged,
+        // i.e., still differ from the full gemm
+        int64_t changed = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t i0 = (uplo_col == Uplo::Lower ? 0 : j + 1);
+            int64_t i1 = (uplo_col == Uplo::Lower ? j : n);
+            for (int64_t i = i0; i < i1; ++i) {
+                if (k > 0 && alpha != scalar_t( 0 )
+                    && (C   [ i + j*ldc ] == Cref[ i + j*ldc ]
+                        || Cgen[ i + j*ldc ] == Cref[ i + j*ldc ]))
+                    ++changed;
+            }
+        }
+
+        // check error compared to reference
+        real_t error, error2;
+        bool okay, okay2;
+        check_herk( uplo_col, n, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref, ldc, C, ldc, verbose, &error, &okay );
+        check_herk( uplo_col, n, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref, ldc, Cgen, ldc, verbose, &error2, &okay2 );
+        params.error()  = error;
+        params.error2() = error2;
+        params.okay()   = okay && okay2 && changed == 0;
+        if (changed > 0)
+            params.msg() = "opposite triangle modified";
+    }
+
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] Cgen;
+    delete[] Cref;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemmt( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gemmt_work< float, float, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gemmt_work< double, double, double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gemmt_work< std::complex<float>, std::complex<float>,
+                             std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gemmt_work< std::complex<double>, std::complex<double>,
+                             std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests gemv with A, x, y stored in a 16-bit type T16 (float16 or bfloat16)
+// and float arithmetic, compared to sgemv on the same values in float.
+template <typename T16>
+void test_gemv_half_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = float;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    real_t alpha    = params.alpha.get<real_t>();
+    real_t beta     = params.beta.get<real_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    // adjust header to msec
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( Am, align );
+    int64_t Xm = (trans == Op::NoTrans ? n : m);
+    int64_t Ym = (trans == Op::NoTrans ? m : n);
+    size_t size_A = size_t(lda)*An;
+    size_t size_x = (Xm - 1) * std::abs(incx) + 1;
+    size_t size_y = (Ym - 1) * std::abs(incy) + 1;
+    T16*    A    = new T16[ size_A ];
+    T16*    x    = new T16[ size_x ];
+    T16*    y    = new T16[ size_y ];
+    T16*    y0   = new T16[ size_y ];
+    real_t* Aref = new real_t[ size_A ];
+    real_t* xref = new real_t[ size_x ];
+    real_t* yref = new real_t[ size_y ];
+    real_t* yout = new real_t[ size_y ];
+
+    // generate in float, round to T16, then copy back to float,
+    // so the reference gets exactly the same values
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, Aref );
+    lapack_larnv( idist, iseed, size_x, xref );
+    lapack_larnv( idist, iseed, size_y, yref );
+    for (size_t i = 0; i < size_A; ++i) {
+        A[ i ] = T16( Aref[ i ] );
+        Aref[ i ] = A[ i ];
+    }
+    for (size_t i = 0; i < size_x; ++i) {
+        x[ i ] = T16( xref[ i ] );
+        xref[ i ] = x[ i ];
+    }
+    for (size_t i = 0; i < size_y; ++i) {
+        y[ i ] = T16( yref[ i ] );
+        yref[ i ] = y[ i ];
+        y0[ i ] = y[ i ];
+    }
+
+    // norms for error check
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, Aref, lda, work );
+    real_t Xnorm = cblas_nrm2( Xm, xref, std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( Ym, yref, std::abs(incy) );
+
+    // test error exits
+    assert_throw( blas::gemv( Layout(0), trans,  m,  n, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::gemv( layout,    Op(0),  m,  n, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::gemv( layout,    trans, -1,  n, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::gemv( layout,    trans,  m, -1, alpha, A, lda, x, incx, beta, y, incy ), blas::Error );
+    assert_throw( blas::gemv( layout,    trans,  m,  n, alpha, A, lda, x, 0,    beta, y, incy ), blas::Error );
+    assert_throw( blas::gemv( layout,    trans,  m,  n, alpha, A, lda, x, incx, beta, y, 0    ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm=%.2e\n"
+                "x Xm=%5lld, inc=%5lld,           size=%10lld, norm=%.2e\n"
+                "y Ym=%5lld, inc=%5lld,           size=%10lld, norm=%.2e\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( Xm ), llong( incx ), llong( size_x ), Xnorm,
+                llong( Ym ), llong( incy ), llong( size_y ), Ynorm );
+    }
+    if (verbose >= 2) {
+        printf( "alpha = %.4e; beta = %.4e;\n", alpha, beta );
+        printf( "A = "    ); print_matrix( Am, An, Aref, lda );
+        printf( "x    = " ); print_vector( Xm, xref, incx );
+        printf( "y    = " ); print_vector( Ym, yref, incy );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::gemv( layout, trans, m, n, alpha, A, lda, x, incx, beta, y, incy );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< T16 >::gemv( m, n );
+    double gbyte = blas::Gbyte< T16 >::gemv( m, n );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    for (size_t i = 0; i < size_y; ++i)
+        yout[ i ] = y[ i ];
+
+    if (verbose >= 2) {
+        printf( "y2   = " ); print_vector( Ym, yout, incy );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference, sgemv in float
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_gemv( cblas_layout_const(layout), cblas_trans_const(trans), m, n,
+                    alpha, Aref, lda, xref, incx, beta, yref, incy );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = 2 * gbyte / time;  // float is twice T16
+
+        if (verbose >= 2) {
+            printf( "yref = " ); print_vector( Ym, yref, incy );
+        }
+
+        // check error compared to reference, with tolerance T16's unit
+        // roundoff, as the error is dominated by rounding y to T16.
+        // treat y as 1 x Ym matrix with ld = incy; k = Xm is reduction dimension
+        real_t u16 = 0.5f * float( std::numeric_limits< T16 >::epsilon() );
+
+        // Exact check with a long reduction: with A and x all ones and
+        // 4096 terms, each y_i = 4096, which T16 represents exactly, and
+        // so do the float partial sums. Adding each column into y in T16
+        // would stall at 2048 (float16) or 256 (bfloat16).
+        int64_t ml = 4;
+        int64_t kl = 4096;
+        int64_t Aml = (trans == Op::NoTrans ? ml : kl);
+        int64_t Anl = (trans == Op::NoTrans ? kl : ml);
+        int64_t ldal = (layout == Layout::ColMajor ? Aml : Anl);
+        std::vector<T16> Al( ml*kl, T16( 1.0f ) ), xl( kl, T16( 1.0f ) ),
+                         yl( ml );
+
+        // The kernel for 16-bit A is dispatched by instruction set,
+        // so rerun with each variant; error is the largest.
+        real_t error = 0;
+        bool exact = true;
+        for_each_simd_isa( [&]() {
+            std::copy( y0, y0 + size_y, y );
+            blas::gemv( layout, trans, m, n, alpha, A, lda, x, incx,
+                        beta, y, incy );
+            for (size_t i = 0; i < size_y; ++i)
+                yout[ i ] = y[ i ];
+
+            real_t error_isa;
+            bool okay_isa;
+            check_gemm( 1, Ym, Xm, alpha, beta, Anorm, Xnorm, Ynorm,
+                        yref, std::abs(incy), yout, std::abs(incy), verbose,
+                        &error_isa, &okay_isa );
+            error = std::max( error, error_isa );
+
+            std::fill( yl.begin(), yl.end(), T16( 1.0f ) );
+            blas::gemv( layout, trans, Aml, Anl, 1.0f, Al.data(), ldal,
+                        xl.data(), 1, 0.0f, yl.data(), 1 );
+            for (int64_t i = 0; i < ml; ++i)
+                exact = exact && (float( yl[ i ] ) == float( kl ));
+        } );
+
+        params.error() = error;
+        params.okay() = (error < u16) && exact;
+    }
+
+    delete[] A;
+    delete[] x;
+    delete[] y;
+    delete[] y0;
+    delete[] Aref;
+    delete[] xref;
+    delete[] yref;
+    delete[] yout;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv_half( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_gemv_half_work< blas::float16 >( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv_bf16( Params& params, bool run )
+{
+    // Fields are marked (run = false) with the default type, double.
+    if (run && params.datatype() != testsweeper::DataType::Half)
+        throw std::exception();
+    test_gemv_half_work< blas::bfloat16 >( params, run );
+}
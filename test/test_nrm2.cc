@@ -29,11 +29,18 @@ void test_nrm2_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.ref_gbytes();
+    params.time2();
+    params.error2();
+    params.error3();
 
     // adjust header to msec
     params.time.name( "time (ms)" );
     params.ref_time.name( "ref time (ms)" );
     params.ref_time.width( 13 );
+    params.time2.name( "generic (ms)" );
+    params.time2.width( 12 );
+    params.error2.name( "generic error" );
+    params.error3.name( "scaled error" );
 
     if (! run)
         return;
@@ -101,7 +108,43 @@ void test_nrm2_work( Params& params, bool run )
 
         real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
         params.error() = error;
-        params.okay() = (error < u);
+
+        // generic template, which scales to avoid over- and underflow
+        time = get_wtime();
+        real_t result2 = blas::nrm2< T >( n, x, incx );
+        time = get_wtime() - time;
+        params.time2() = time * 1000;  // msec
+
+        real_t error2 = abs( (ref - result2) / (sqrt(n+1) * ref) );
+        if (blas::is_complex_v<scalar_t>) {
+            error2 /= 2*sqrt(2);
+        }
+        params.error2() = error2;
+
+        // Scale x by powers of 2 so its squares overflow or underflow,
+        // with exactly known norm. |x_i| <= sqrt(2), so the large scaling
+        // is reduced by about log2( sqrt(n) ) to keep the norm finite.
+        const int maxexp = std::numeric_limits< real_t >::max_exponent;
+        const int minexp = std::numeric_limits< real_t >::min_exponent;
+        const int e_large
+            = maxexp - 3 - std::ilogb( std::sqrt( real_t( n+1 ) ) );
+        real_t error3 = 0;
+        for (int e : { e_large, minexp/2 - 4 }) {
+            real_t scale = std::ldexp( real_t( 1 ), e );
+            T* xs = new T[ size_x ];
+            for (size_t i = 0; i < size_x; ++i)
+                xs[ i ] = x[ i ] * scale;
+            real_t result3 = blas::nrm2< T >( n, xs, incx ) / scale;
+            real_t err = abs( (ref - result3) / (sqrt(n+1) * ref) );
+            error3 = std::max( error3, err );
+            delete[] xs;
+        }
+        if (blas::is_complex_v<scalar_t>) {
+            error3 /= 2*sqrt(2);
+        }
+        params.error3() = error3;
+
+        params.okay() = (error < u && error2 < u && error3 < u);
     }
 
     delete[] x;
@@ -0,0 +1,400 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <cstring>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests reproducible mode (see blas::set_reproducible): each routine is run
+// with several thread counts, and the results must be bitwise identical.
+// The result is also checked against the reference BLAS as usual.
+
+// -----------------------------------------------------------------------------
+// Runs routine in reproducible mode with 1, 3, and 8 threads, resetting
+// the size-length output out to its input values before each run.
+// Even small problems run in parallel.
+// Returns true if all results are bitwise identical;
+// time is for the run with 1 thread.
+template <typename T, typename Routine>
+bool run_reproducible( size_t size, T* out, Routine&& routine, double* time )
+{
+    std::vector<T> out0( out, out + size );
+    std::vector<T> out1;
+
+    int64_t threshold = blas::get_parallel_threshold();
+    blas::set_parallel_threshold( 0 );
+    blas::set_reproducible( true );
+
+    bool same = true;
+    for (int nthreads : { 1, 3, 8 }) {
+        blas::set_num_threads( nthreads );
+        std::copy( out0.begin(), out0.end(), out );
+        double t = testsweeper::get_wtime();
+        routine();
+        t = testsweeper::get_wtime() - t;
+        if (nthreads == 1) {
+            *time = t;
+            out1.assign( out, out + size );
+        }
+        else {
+            same = same && memcmp( out1.data(), out, size * sizeof(T) ) == 0;
+        }
+    }
+
+    blas::set_reproducible( false );
+    blas::set_num_threads( 0 );
+    blas::set_parallel_threshold( threshold );
+    return same;
+}
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_repro( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_dot_repro_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run test
+    scalar_t result = 0;
+    double time;
+    bool same = run_reproducible( 1, &result, [&]() {
+        result = blas::dot( n, x.data(), incx, y.data(), incy );
+    }, &time );
+    params.time() = time;
+
+    // run reference
+    time = get_wtime();
+    scalar_t ref = cblas_dot( n, x.data(), incx, y.data(), incy );
+    params.ref_time() = get_wtime() - time;
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( 1, 1, n, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                &ref, 1, &result, 1, verbose, &error, &okay );
+    params.error() = error;
+    params.okay() = okay && same;
+}
+
+// -----------------------------------------------------------------------------
+// Tests nrm2 if is_nrm2, else asum.
+template <typename scalar_t>
+void test_norm_repro_work( Params& params, bool run, bool is_nrm2 )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    std::vector<scalar_t> x( size_x );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+
+    // run test
+    real_t result = 0;
+    double time;
+    bool same = run_reproducible( 1, &result, [&]() {
+        result = (is_nrm2 ? blas::nrm2( n, x.data(), incx )
+                          : blas::asum( n, x.data(), incx ));
+    }, &time );
+    params.time() = time;
+
+    // run reference. For asum, sum in double rather than calling
+    // cblas_asum, as some vendor complex asum kernels are inaccurate.
+    time = get_wtime();
+    real_t ref;
+    if (is_nrm2) {
+        ref = cblas_nrm2( n, x.data(), incx );
+    }
+    else {
+        double sum = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            sum += std::abs( double( std::real( x[ i*incx ] ) ) )
+                +  std::abs( double( std::imag( x[ i*incx ] ) ) );
+        }
+        ref = real_t( sum );
+    }
+    params.ref_time() = get_wtime() - time;
+
+    // relative forward error
+    real_t error = std::abs( (ref - result)
+                             / ((is_nrm2 ? sqrt(n+1) : n) * ref) );
+    if (blas::is_complex_v< scalar_t >)
+        error /= 2*sqrt(2);
+    real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
+    params.error() = error;
+    params.okay() = (error < u) && same;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemv_repro_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( Am, align );
+    int64_t Xm = (trans == Op::NoTrans ? n : m);
+    int64_t Ym = (trans == Op::NoTrans ? m : n);
+    size_t size_A = size_t(lda)*An;
+    size_t size_x = (Xm - 1) * std::abs(incx) + 1;
+    size_t size_y = (Ym - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> A( size_A ), x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    yref = y;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Xnorm = cblas_nrm2( Xm, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( Ym, y.data(), std::abs(incy) );
+
+    // run test
+    double time;
+    bool same = run_reproducible( size_y, y.data(), [&]() {
+        blas::gemv( layout, trans, m, n, alpha, A.data(), lda,
+                    x.data(), incx, beta, y.data(), incy );
+    }, &time );
+    params.time() = time;
+
+    // run reference
+    time = get_wtime();
+    cblas_gemv( cblas_layout_const(layout), cblas_trans_const(trans), m, n,
+                alpha, A.data(), lda, x.data(), incx, beta, yref.data(), incy );
+    params.ref_time() = get_wtime() - time;
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( 1, Ym, Xm, alpha, beta, Anorm, Xnorm, Ynorm,
+                yref.data(), std::abs(incy), y.data(), std::abs(incy), verbose,
+                &error, &okay );
+    params.error() = error;
+    params.okay() = okay && same;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemm_repro_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<scalar_t> A( size_A ), B( size_B ), C( size_C ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    Cref = C;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B.data(), ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C.data(), ldc, work );
+
+    // run test
+    double time;
+    bool same = run_reproducible( size_C, C.data(), [&]() {
+        blas::gemm( layout, transA, transB, m, n, k,
+                    alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc );
+    }, &time );
+    params.time() = time;
+
+    // run reference
+    time = get_wtime();
+    cblas_gemm( cblas_layout_const(layout),
+                cblas_trans_const(transA),
+                cblas_trans_const(transB),
+                m, n, k, alpha, A.data(), lda, B.data(), ldb,
+                beta, Cref.data(), ldc );
+    params.ref_time() = get_wtime() - time;
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                Cref.data(), ldc, C.data(), ldc, verbose, &error, &okay );
+    params.error() = error;
+    params.okay() = okay && same;
+}
+
+// -----------------------------------------------------------------------------
+void test_dot_repro( Params& params, bool run )
+{
+    dispatch_repro( params, [&]( auto x ) {
+        test_dot_repro_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_nrm2_repro( Params& params, bool run )
+{
+    dispatch_repro( params, [&]( auto x ) {
+        test_norm_repro_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_asum_repro( Params& params, bool run )
+{
+    dispatch_repro( params, [&]( auto x ) {
+        test_norm_repro_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv_repro( Params& params, bool run )
+{
+    dispatch_repro( params, [&]( auto x ) {
+        test_gemv_repro_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_repro( Params& params, bool run )
+{
+    dispatch_repro( params, [&]( auto x ) {
+        test_gemm_repro_work< decltype( x ) >( params, run );
+    } );
+}
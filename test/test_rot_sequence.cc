@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+// -----------------------------------------------------------------------------
+template <typename TA>
+void test_rot_sequence_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Layout, blas::Side, blas::Direction;
+    using real_t = blas::real_type< TA >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Side side     = params.side();
+    blas::Direction direction = params.direction();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    // adjust header to msec
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t nrot = (side == Side::Left ? m : n) - 1;
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( std::max( Am, int64_t( 1 ) ), align );
+    int64_t ldc = roundup( std::max( nrot, int64_t( 1 ) ), align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_C = size_t(ldc)*k;
+    std::vector<TA> A( size_A ), S( size_C ), Aref;
+    std::vector<real_t> C( size_C );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    Aref = A;
+
+    // Generate each rotation from random data, as in rot.
+    for (size_t i = 0; i < size_C; ++i) {
+        TA data[ 2 ];
+        lapack_larnv( idist, iseed, 2, data );
+        blas::rotg( &data[0], &data[1], &C[ i ], &S[ i ] );
+    }
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+
+    // test error exits
+    assert_throw( blas::rot_sequence( Layout(0), side, direction, m, n, k, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, Side(0), direction, m, n, k, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, Direction(0), m, n, k, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, -1, n, k, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, m, -1, k, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, m, n, -1, C.data(), ldc, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, m, n, k, C.data(), nrot - 1, S.data(), ldc, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, m, n, k, C.data(), ldc, S.data(), nrot - 1, A.data(), lda ), blas::Error );
+    assert_throw( blas::rot_sequence( layout, side, direction, m, n, k, C.data(), ldc, S.data(), ldc, A.data(), Am - 1 ), blas::Error );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A Am=%5lld, An=%5lld, lda=%5lld, size=%10lld, norm %.2e\n"
+                "C nrot=%5lld, k=%5lld, ldc=%5lld, size=%10lld\n",
+                llong( Am ), llong( An ), llong( lda ), llong( size_A ), Anorm,
+                llong( nrot ), llong( k ), llong( ldc ), llong( size_C ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( Am, An, A.data(), lda );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::rot_sequence( layout, side, direction, m, n, k,
+                        C.data(), ldc, S.data(), ldc, A.data(), lda );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< TA >::rot_sequence( side, m, n, k );
+    double gbyte = blas::Gbyte< TA >::rot_sequence( side, m, n, k );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "A2 = " ); print_matrix( Am, An, A.data(), lda );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // run reference: k*nrot rot, on rows or columns of A
+        // element (i, j) of op(A) is A[ i*inc_row + j*inc_col ]
+        int64_t inc_row = (layout == Layout::ColMajor ? 1 : lda);
+        int64_t inc_col = (layout == Layout::ColMajor ? lda : 1);
+        int64_t inc_rot = (side == Side::Left ? inc_row : inc_col);
+        int64_t inc_vec = (side == Side::Left ? inc_col : inc_row);
+        int64_t len     = (side == Side::Left ? n : m);
+
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        for (int64_t j = 0; j < k; ++j) {
+            for (int64_t ii = 0; ii < nrot; ++ii) {
+                int64_t i = (direction == Direction::Forward ? ii : nrot - 1 - ii);
+                cblas_rot( len, &Aref[ i*inc_rot ], inc_vec,
+                           &Aref[ (i + 1)*inc_rot ], inc_vec,
+                           C[ i + j*ldc ], S[ i + j*ldc ] );
+            }
+        }
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 2) {
+            printf( "Aref = " ); print_matrix( Am, An, Aref.data(), lda );
+        }
+
+        // check error compared to reference
+        // A2 = A Q for orthogonal Q; treat as gemm with ||Q||_F = sqrt( n ),
+        // and k sequences of rotations accumulating error.
+        real_t Qnorm = sqrt( real_t( (side == Side::Left ? m : n) * (k + 1) ) );
+        real_t error;
+        bool okay;
+        check_gemm( Am, An, nrot + 1, TA(1), TA(0), Anorm, Qnorm, real_t(0),
+                    Aref.data(), lda, A.data(), lda, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_rot_sequence( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_rot_sequence_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_rot_sequence_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_rot_sequence_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_rot_sequence_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
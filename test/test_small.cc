@@ -0,0 +1,400 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the inline kernels for tiny problems (see blas::set_small_threshold).
+// Each routine is timed with the inline kernel and with the vendor BLAS,
+// reporting the average latency per call, to find the crossover.
+// The result of the inline kernel is checked against the reference BLAS,
+// for each instruction set variant of the kernel the CPU supports.
+
+// -----------------------------------------------------------------------------
+// Number of calls averaged for the latency.
+const int small_reps = 1000;
+
+// -----------------------------------------------------------------------------
+// Runs routine small_reps times on a scratch copy of the size-length
+// output out, first with the inline kernel, setting time (ns per call),
+// then with the vendor BLAS, setting time2 (ns per call).
+// Finally, for each instruction set (see for_each_simd_isa), runs routine
+// once with the inline kernel on out itself, restored to its input values,
+// and calls check( &error, &okay ). Sets error to the largest error, and
+// okay if all variants pass.
+template <typename T, typename real_t, typename Routine, typename Check>
+void run_small( size_t size, T* out, Routine&& routine, Check&& check,
+                double* time, double* time2, real_t* error, bool* okay )
+{
+    std::vector<T> out0( out, out + size );
+    int64_t threshold = blas::get_small_threshold();
+
+    for (int iter = 0; iter < 2; ++iter) {
+        // iter 0: inline kernel; iter 1: vendor BLAS
+        blas::set_small_threshold( iter == 0 ? 1000000 : 0 );
+        routine();  // warmup
+        double t = testsweeper::get_wtime();
+        for (int rep = 0; rep < small_reps; ++rep)
+            routine();
+        t = testsweeper::get_wtime() - t;
+        *(iter == 0 ? time : time2) = t / small_reps * 1e9;
+    }
+
+    *error = 0;
+    *okay = true;
+    blas::set_small_threshold( 1000000 );
+    for_each_simd_isa( [&]() {
+        std::copy( out0.begin(), out0.end(), out );
+        routine();
+
+        real_t error_isa;
+        bool okay_isa;
+        check( &error_isa, &okay_isa );
+        *error = std::max( *error, error_isa );
+        *okay = *okay && okay_isa;
+    } );
+    blas::set_small_threshold( threshold );
+}
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_small( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output values common to the small testers.
+void mark_small( Params& params )
+{
+    params.time.name( "time (ns)" );
+    params.time2.name( "vendor (ns)" );
+    params.time2.width( 11 );
+    params.time();
+    params.time2();
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemm_small_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    mark_small( params );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<scalar_t> A( size_A ), B( size_B ), C( size_C ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    Cref = C;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B.data(), ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C.data(), ldc, work );
+
+    // run reference
+    cblas_gemm( cblas_layout_const(layout),
+                cblas_trans_const(transA),
+                cblas_trans_const(transB),
+                m, n, k, alpha, A.data(), lda, B.data(), ldb,
+                beta, Cref.data(), ldc );
+
+    // run test, checking error compared to reference
+    double time, time2;
+    real_t error;
+    bool okay;
+    run_small( size_C, C.data(), [&]() {
+        blas::gemm( layout, transA, transB, m, n, k,
+                    alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc );
+    }, [&]( real_t* error_isa, bool* okay_isa ) {
+        check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                    Cref.data(), ldc, C.data(), ldc, verbose,
+                    error_isa, okay_isa );
+    }, &time, &time2, &error, &okay );
+    params.time()  = time;
+    params.time2() = time2;
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemv_small_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    mark_small( params );
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( Am, align );
+    int64_t Xm = (trans == Op::NoTrans ? n : m);
+    int64_t Ym = (trans == Op::NoTrans ? m : n);
+    size_t size_A = size_t(lda)*An;
+    size_t size_x = (Xm - 1) * std::abs(incx) + 1;
+    size_t size_y = (Ym - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> A( size_A ), x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    yref = y;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Xnorm = cblas_nrm2( Xm, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( Ym, y.data(), std::abs(incy) );
+
+    // run reference
+    cblas_gemv( cblas_layout_const(layout), cblas_trans_const(trans), m, n,
+                alpha, A.data(), lda, x.data(), incx, beta, yref.data(), incy );
+
+    // run test, checking error compared to reference
+    double time, time2;
+    real_t error;
+    bool okay;
+    run_small( size_y, y.data(), [&]() {
+        blas::gemv( layout, trans, m, n, alpha, A.data(), lda,
+                    x.data(), incx, beta, y.data(), incy );
+    }, [&]( real_t* error_isa, bool* okay_isa ) {
+        check_gemm( 1, Ym, Xm, alpha, beta, Anorm, Xnorm, Ynorm,
+                    yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                    verbose, error_isa, okay_isa );
+    }, &time, &time2, &error, &okay );
+    params.time()  = time;
+    params.time2() = time2;
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_axpy_small_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    mark_small( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    yref = y;
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run reference
+    cblas_axpy( n, alpha, x.data(), incx, yref.data(), incy );
+
+    // run test, checking error compared to reference;
+    // treat y as 1 x n matrix with ld = incy; k = 1 is reduction dimension
+    double time, time2;
+    real_t error;
+    bool okay;
+    run_small( size_y, y.data(), [&]() {
+        blas::axpy( n, alpha, x.data(), incx, y.data(), incy );
+    }, [&]( real_t* error_isa, bool* okay_isa ) {
+        check_gemm( 1, n, 1, alpha, scalar_t(1), Xnorm, real_t(1), Ynorm,
+                    yref.data(), std::abs(incy), y.data(), std::abs(incy),
+                    verbose, error_isa, okay_isa );
+    }, &time, &time2, &error, &okay );
+    params.time()  = time;
+    params.time2() = time2;
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_dot_small_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    mark_small( params );
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run reference
+    scalar_t ref = cblas_dot( n, x.data(), incx, y.data(), incy );
+
+    // run test, checking error compared to reference
+    scalar_t result = 0;
+    double time, time2;
+    real_t error;
+    bool okay;
+    run_small( 1, &result, [&]() {
+        result = blas::dot( n, x.data(), incx, y.data(), incy );
+    }, [&]( real_t* error_isa, bool* okay_isa ) {
+        check_gemm( 1, 1, n, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                    &ref, 1, &result, 1, verbose, error_isa, okay_isa );
+    }, &time, &time2, &error, &okay );
+    params.time()  = time;
+    params.time2() = time2;
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_small( Params& params, bool run )
+{
+    dispatch_small( params, [&]( auto x ) {
+        test_gemm_small_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv_small( Params& params, bool run )
+{
+    dispatch_small( params, [&]( auto x ) {
+        test_gemv_small_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_axpy_small( Params& params, bool run )
+{
+    dispatch_small( params, [&]( auto x ) {
+        test_axpy_small_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dot_small( Params& params, bool run )
+{
+    dispatch_small( params, [&]( auto x ) {
+        test_dot_small_work< decltype( x ) >( params, run );
+    } );
+}
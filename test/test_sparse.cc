@@ -0,0 +1,473 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests sparse Level 1 routines axpyi, doti, dotui, gthr, gthrz, and sctr.
+// The sparse vector x has nz nonzeros, with distinct indices in random order
+// into a dense vector y of length 2 nz.
+// The ref time is for the dense cblas routine (axpy, dot, dotu, or copy)
+// on y(indx) gathered into a contiguous vector, showing the cost of
+// indirect access.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_sparse( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Marks output columns; times are in msec.
+void mark_sparse( Params& params )
+{
+    params.gflops();
+    params.gbytes();
+    params.ref_time();
+    params.ref_gflops();
+    params.ref_gbytes();
+
+    params.time.name( "time (ms)" );
+    params.ref_time.name( "ref time (ms)" );
+    params.ref_time.width( 13 );
+}
+
+// -----------------------------------------------------------------------------
+// Sets up sparse x with nz nonzeros and distinct random indices indx
+// into dense y of length 2 nz, with random values.
+template <typename scalar_t>
+void setup_sparse(
+    int64_t nz,
+    std::vector<scalar_t>& x, std::vector<int64_t>& indx,
+    std::vector<scalar_t>& y )
+{
+    int64_t ny = 2*nz;
+    x.resize( std::max( nz, int64_t( 1 ) ) );
+    y.resize( std::max( ny, int64_t( 1 ) ) );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, x.size(), x.data() );
+    lapack_larnv( idist, iseed, y.size(), y.data() );
+
+    // first nz of a random permutation of 0, ..., ny-1
+    std::vector<int64_t> perm( ny );
+    std::iota( perm.begin(), perm.end(), 0 );
+    std::mt19937 gen( 1 );
+    std::shuffle( perm.begin(), perm.end(), gen );
+    indx.assign( perm.begin(), perm.begin() + nz );
+    indx.resize( std::max( nz, int64_t( 1 ) ) );
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_axpyi_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    int64_t nz      = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    mark_sparse( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> x, y, yg( std::max( nz, int64_t( 1 ) ) );
+    std::vector<int64_t> indx;
+    setup_sparse( nz, x, indx, y );
+    std::vector<scalar_t> y0 = y;
+    for (int64_t i = 0; i < nz; ++i)
+        yg[ i ] = y[ indx[ i ] ];
+
+    // test error exits
+    assert_throw( blas::axpyi( -1, alpha, x.data(), indx.data(), y.data() ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "alpha = %.4e + %.4ei;\n",
+                std::real( alpha ), std::imag( alpha ) );
+        printf( "x    = " ); print_vector( nz, x.data(), 1 );
+        printf( "y    = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::axpyi( nz, alpha, x.data(), indx.data(), y.data() );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::axpy( nz );
+    double gbyte = blas::Gbyte< scalar_t >::axpyi( nz );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "y2   = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    if (params.check() == 'y') {
+        // run dense axpy on gathered y for reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_axpy( nz, alpha, x.data(), 1, yg.data(), 1 );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // maximum component-wise forward error, as in test_axpy:
+        // | fl(yi) - yi | / (2 |alpha xi| + |y0_i|)
+        real_t error = 0;
+        for (int64_t i = 0; i < nz; ++i) {
+            int64_t k = indx[ i ];
+            real_t err_i = std::abs( y[ k ] - yg[ i ] )
+                         / (2*(std::abs( alpha * x[ i ] ) + std::abs( y0[ k ] )));
+            error = std::max( error, err_i );
+        }
+        // elements of y not in indx must be unchanged
+        std::vector<bool> in_indx( 2*nz );
+        for (int64_t i = 0; i < nz; ++i)
+            in_indx[ indx[ i ] ] = true;
+        for (int64_t k = 0; k < 2*nz; ++k) {
+            if (! in_indx[ k ] && y[ k ] != y0[ k ])
+                error = std::numeric_limits< real_t >::infinity();
+        }
+
+        // complex needs extra factor; see Higham, 2002, sec. 3.6.
+        if (blas::is_complex_v<scalar_t>) {
+            error /= 2*sqrt(2);
+        }
+
+        real_t u = 0.5 * std::numeric_limits< real_t >::epsilon();
+        params.error() = error;
+        params.okay() = (error < u);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests doti if conj_x, else dotui.
+template <typename scalar_t>
+void test_doti_work( Params& params, bool run, bool conj_x )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t nz      = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    mark_sparse( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> x, y, yg( std::max( nz, int64_t( 1 ) ) );
+    std::vector<int64_t> indx;
+    setup_sparse( nz, x, indx, y );
+    for (int64_t i = 0; i < nz; ++i)
+        yg[ i ] = y[ indx[ i ] ];
+
+    // norms for error check
+    real_t Xnorm = cblas_nrm2( nz, x.data(), 1 );
+    real_t Ynorm = cblas_nrm2( nz, yg.data(), 1 );
+
+    // test error exits
+    assert_throw( blas::doti ( -1, x.data(), indx.data(), y.data() ), blas::Error );
+    assert_throw( blas::dotui( -1, x.data(), indx.data(), y.data() ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "x = " ); print_vector( nz, x.data(), 1 );
+        printf( "y = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    scalar_t result = conj_x
+                    ? blas::doti ( nz, x.data(), indx.data(), y.data() )
+                    : blas::dotui( nz, x.data(), indx.data(), y.data() );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::dot( nz );
+    double gbyte = blas::Gbyte< scalar_t >::doti( nz );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 1) {
+        printf( "dot = %.4e + %.4ei\n", std::real( result ), std::imag( result ) );
+    }
+
+    if (params.check() == 'y') {
+        // run dense dot on gathered y for reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        scalar_t ref = conj_x
+                     ? cblas_dot ( nz, x.data(), 1, yg.data(), 1 )
+                     : cblas_dotu( nz, x.data(), 1, yg.data(), 1 );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        if (verbose >= 1) {
+            printf( "ref = %.4e + %.4ei\n", std::real( ref ), std::imag( ref ) );
+        }
+
+        // check error compared to reference
+        // treat result as 1 x 1 matrix; k = nz is reduction dimension
+        // alpha=1, beta=0, Cnorm=0
+        real_t error;
+        bool okay;
+        check_gemm( 1, 1, nz, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                    &ref, 1, &result, 1, verbose, &error, &okay );
+        params.error() = error;
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests gthrz if zero, else gthr.
+template <typename scalar_t>
+void test_gthr_work( Params& params, bool run, bool zero )
+{
+    using namespace testsweeper;
+
+    // get & mark input values
+    int64_t nz      = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    mark_sparse( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> x, y, xref( std::max( nz, int64_t( 1 ) ) );
+    std::vector<int64_t> indx;
+    setup_sparse( nz, x, indx, y );
+    std::vector<scalar_t> y0 = y;
+
+    // gathered y for reference, made contiguous for the timed copy
+    std::vector<scalar_t> yg( xref.size() );
+    for (int64_t i = 0; i < nz; ++i)
+        yg[ i ] = y[ indx[ i ] ];
+
+    // test error exits
+    assert_throw( blas::gthr ( -1, y.data(), x.data(), indx.data() ), blas::Error );
+    assert_throw( blas::gthrz( -1, y.data(), x.data(), indx.data() ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "y  = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    if (zero)
+        blas::gthrz( nz, y.data(), x.data(), indx.data() );
+    else
+        blas::gthr ( nz, y.data(), x.data(), indx.data() );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::copy( nz );
+    double gbyte = zero ? blas::Gbyte< scalar_t >::gthrz( nz )
+                        : blas::Gbyte< scalar_t >::gthr( nz );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "x  = " ); print_vector( nz, x.data(), 1 );
+        printf( "y2 = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    if (params.check() == 'y') {
+        // run dense copy of gathered y for reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_copy( nz, yg.data(), 1, xref.data(), 1 );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // result is exact; count mismatches in x and y
+        int64_t nerr = 0;
+        for (int64_t i = 0; i < nz; ++i) {
+            if (x[ i ] != xref[ i ])
+                ++nerr;
+        }
+        std::vector<bool> in_indx( 2*nz );
+        for (int64_t i = 0; i < nz; ++i)
+            in_indx[ indx[ i ] ] = true;
+        for (int64_t k = 0; k < 2*nz; ++k) {
+            scalar_t yk = (zero && in_indx[ k ] ? scalar_t( 0 ) : y0[ k ]);
+            if (y[ k ] != yk)
+                ++nerr;
+        }
+        params.error() = nerr;
+        params.okay() = (nerr == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_sctr_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+
+    // get & mark input values
+    int64_t nz      = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    mark_sparse( params );
+
+    if (! run)
+        return;
+
+    // setup
+    std::vector<scalar_t> x, y, yg( std::max( nz, int64_t( 1 ) ) );
+    std::vector<int64_t> indx;
+    setup_sparse( nz, x, indx, y );
+    std::vector<scalar_t> y0 = y;
+
+    // test error exits
+    assert_throw( blas::sctr( -1, x.data(), indx.data(), y.data() ), blas::Error );
+
+    if (verbose >= 2) {
+        printf( "x  = " ); print_vector( nz, x.data(), 1 );
+        printf( "y  = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    // run test
+    testsweeper::flush_cache( params.cache() );
+    double time = get_wtime();
+    blas::sctr( nz, x.data(), indx.data(), y.data() );
+    time = get_wtime() - time;
+
+    double gflop = blas::Gflop< scalar_t >::copy( nz );
+    double gbyte = blas::Gbyte< scalar_t >::sctr( nz );
+    params.time()   = time * 1000;  // msec
+    params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "y2 = " ); print_vector( 2*nz, y.data(), 1 );
+    }
+
+    if (params.check() == 'y') {
+        // run dense copy into contiguous y for reference
+        testsweeper::flush_cache( params.cache() );
+        time = get_wtime();
+        cblas_copy( nz, x.data(), 1, yg.data(), 1 );
+        time = get_wtime() - time;
+
+        params.ref_time()   = time * 1000;  // msec
+        params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
+
+        // result is exact; count mismatches in y
+        std::vector<scalar_t> yref = y0;
+        for (int64_t i = 0; i < nz; ++i)
+            yref[ indx[ i ] ] = yg[ i ];
+        int64_t nerr = 0;
+        for (int64_t k = 0; k < 2*nz; ++k) {
+            if (y[ k ] != yref[ k ])
+                ++nerr;
+        }
+        params.error() = nerr;
+        params.okay() = (nerr == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_axpyi( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_axpyi_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_doti( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_doti_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dotui( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_doti_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gthr( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_gthr_work< decltype( x ) >( params, run, false );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gthrz( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_gthr_work< decltype( x ) >( params, run, true );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_sctr( Params& params, bool run )
+{
+    dispatch_sparse( params, [&]( auto x ) {
+        test_sctr_work< decltype( x ) >( params, run );
+    } );
+}
@@ -0,0 +1,319 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "cblas_wrappers.hh"
+#include "lapack_wrappers.hh"
+#include "blas/flops.hh"
+#include "print_matrix.hh"
+#include "check_gemm.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests splitting of dimensions that overflow blas_int into blocks.
+// Problems big enough to overflow a 32-bit blas_int don't fit in memory
+// for routine testing, so this lowers the split size to params.cutoff
+// (see blas::set_split_size) and checks the result against the reference
+// BLAS, called without splitting.
+
+// -----------------------------------------------------------------------------
+// Calls f( T() ) for the datatype in params.
+template <typename Func>
+void dispatch_split( Params& params, Func&& f )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            f( float() );
+            break;
+
+        case testsweeper::DataType::Double:
+            f( double() );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            f( std::complex<float>() );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            f( std::complex<double>() );
+            break;
+
+        default:
+            throw std::exception();
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Runs routine with the split size set to params.cutoff, setting time.
+template <typename Routine>
+void run_split( Params& params, Routine&& routine )
+{
+    blas::set_split_size( params.cutoff() );
+    double time = testsweeper::get_wtime();
+    routine();
+    params.time() = testsweeper::get_wtime() - time;
+    blas::set_split_size( 0 );
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemm_split_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op transA = params.transA();
+    blas::Op transB = params.transB();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t k       = params.dim.k();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (transA == Op::NoTrans ? m : k);
+    int64_t An = (transA == Op::NoTrans ? k : m);
+    int64_t Bm = (transB == Op::NoTrans ? k : n);
+    int64_t Bn = (transB == Op::NoTrans ? n : k);
+    int64_t Cm = m;
+    int64_t Cn = n;
+    if (layout == Layout::RowMajor) {
+        std::swap( Am, An );
+        std::swap( Bm, Bn );
+        std::swap( Cm, Cn );
+    }
+    int64_t lda = roundup( Am, align );
+    int64_t ldb = roundup( Bm, align );
+    int64_t ldc = roundup( Cm, align );
+    size_t size_A = size_t(lda)*An;
+    size_t size_B = size_t(ldb)*Bn;
+    size_t size_C = size_t(ldc)*Cn;
+    std::vector<scalar_t> A( size_A ), B( size_B ), C( size_C ), Cref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_B, B.data() );
+    lapack_larnv( idist, iseed, size_C, C.data() );
+    Cref = C;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Bnorm = lapack_lange( "f", Bm, Bn, B.data(), ldb, work );
+    real_t Cnorm = lapack_lange( "f", Cm, Cn, C.data(), ldc, work );
+
+    // run test
+    run_split( params, [&]() {
+        blas::gemm( layout, transA, transB, m, n, k,
+                    alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc );
+    } );
+
+    // run reference
+    cblas_gemm( cblas_layout_const(layout),
+                cblas_trans_const(transA),
+                cblas_trans_const(transB),
+                m, n, k, alpha, A.data(), lda, B.data(), ldb,
+                beta, Cref.data(), ldc );
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( Cm, Cn, k, alpha, beta, Anorm, Bnorm, Cnorm,
+                Cref.data(), ldc, C.data(), ldc, verbose, &error, &okay );
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_gemv_split_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using blas::Op;
+    using blas::Layout;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    blas::Layout layout = params.layout();
+    blas::Op trans  = params.trans();
+    scalar_t alpha  = params.alpha.get<scalar_t>();
+    scalar_t beta   = params.beta.get<scalar_t>();
+    int64_t m       = params.dim.m();
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t align   = params.align();
+    int64_t verbose = params.verbose();
+
+    if (! run)
+        return;
+
+    // setup
+    int64_t Am = (layout == Layout::ColMajor ? m : n);
+    int64_t An = (layout == Layout::ColMajor ? n : m);
+    int64_t lda = roundup( Am, align );
+    int64_t Xm = (trans == Op::NoTrans ? n : m);
+    int64_t Ym = (trans == Op::NoTrans ? m : n);
+    size_t size_A = size_t(lda)*An;
+    size_t size_x = (Xm - 1) * std::abs(incx) + 1;
+    size_t size_y = (Ym - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> A( size_A ), x( size_x ), y( size_y ), yref;
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_A, A.data() );
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+    yref = y;
+
+    real_t work[1];
+    real_t Anorm = lapack_lange( "f", Am, An, A.data(), lda, work );
+    real_t Xnorm = cblas_nrm2( Xm, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( Ym, y.data(), std::abs(incy) );
+
+    // run test
+    run_split( params, [&]() {
+        blas::gemv( layout, trans, m, n, alpha, A.data(), lda,
+                    x.data(), incx, beta, y.data(), incy );
+    } );
+
+    // run reference
+    cblas_gemv( cblas_layout_const(layout), cblas_trans_const(trans), m, n,
+                alpha, A.data(), lda, x.data(), incx, beta, yref.data(), incy );
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( 1, Ym, Xm, alpha, beta, Anorm, Xnorm, Ynorm,
+                yref.data(), std::abs(incy), y.data(), std::abs(incy), verbose,
+                &error, &okay );
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_dot_split_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+    int64_t incy    = params.incy();
+    int64_t verbose = params.verbose();
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    size_t size_y = (n - 1) * std::abs(incy) + 1;
+    std::vector<scalar_t> x( size_x ), y( size_y );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+    lapack_larnv( idist, iseed, size_y, y.data() );
+
+    real_t Xnorm = cblas_nrm2( n, x.data(), std::abs(incx) );
+    real_t Ynorm = cblas_nrm2( n, y.data(), std::abs(incy) );
+
+    // run test
+    scalar_t result = 0;
+    run_split( params, [&]() {
+        result = blas::dot( n, x.data(), incx, y.data(), incy );
+    } );
+
+    // run reference
+    scalar_t ref = cblas_dot( n, x.data(), incx, y.data(), incy );
+
+    // check error compared to reference
+    real_t error;
+    bool okay;
+    check_gemm( 1, 1, n, scalar_t(1), scalar_t(0), Xnorm, Ynorm, real_t(0),
+                &ref, 1, &result, 1, verbose, &error, &okay );
+    params.error() = error;
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+void test_iamax_split_work( Params& params, bool run )
+{
+    using namespace testsweeper;
+
+    // get & mark input values
+    int64_t n       = params.dim.n();
+    int64_t incx    = params.incx();
+
+    if (! run)
+        return;
+
+    // setup
+    size_t size_x = (n - 1) * std::abs(incx) + 1;
+    std::vector<scalar_t> x( size_x );
+
+    int64_t idist = 1;
+    int iseed[4] = { 0, 0, 0, 1 };
+    lapack_larnv( idist, iseed, size_x, x.data() );
+
+    // run test
+    int64_t result = 0;
+    run_split( params, [&]() {
+        result = blas::iamax( n, x.data(), incx );
+    } );
+
+    // run reference; cblas returns 0-based index
+    int64_t ref = cblas_iamax( n, x.data(), incx );
+
+    // check error compared to reference
+    params.error() = std::abs( result - ref );
+    params.okay() = (result == ref);
+}
+
+// -----------------------------------------------------------------------------
+void test_gemm_split( Params& params, bool run )
+{
+    dispatch_split( params, [&]( auto x ) {
+        test_gemm_split_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_gemv_split( Params& params, bool run )
+{
+    dispatch_split( params, [&]( auto x ) {
+        test_gemv_split_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_dot_split( Params& params, bool run )
+{
+    dispatch_split( params, [&]( auto x ) {
+        test_dot_split_work< decltype( x ) >( params, run );
+    } );
+}
+
+// -----------------------------------------------------------------------------
+void test_iamax_split( Params& params, bool run )
+{
+    dispatch_split( params, [&]( auto x ) {
+        test_iamax_split_work< decltype( x ) >( params, run );
+    } );
+}